@@ -78,10 +78,13 @@ void AmbientForceController::copyTo(SimObject* object)
 
 void AmbientForceController::integrate( Scene* pScene, const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
 {
+    // Fetch the controller buffer.
+    SceneControllerBuffer* pControllerBuffer = pScene->getControllerBuffer();
+
     // Process all the scene objects.
     for( SceneObjectSet::iterator itr = begin(); itr != end(); ++itr )
     {
-        // Apply the force.
-        (*itr)->applyForce( mForce, true );
+        // Accumulate the force.
+        pControllerBuffer->addForce( pControllerBuffer->gather( *itr ), mForce.x, mForce.y );
     }
 }
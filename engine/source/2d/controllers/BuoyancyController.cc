@@ -109,22 +109,20 @@ void BuoyancyController::integrate( Scene* pScene, const F32 totalTime, const F3
     // Query for candidate objects.
     pWorldQuery->anyQueryAABB( mFluidArea ); 
 
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    // Fetch the controller buffer.
+    SceneControllerBuffer* pControllerBuffer = pScene->getControllerBuffer();
 
-    // Iterate the results.
-    for ( U32 n = 0; n < (U32)queryResults.size(); n++ )
-    {
-        // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+    // Gather the awake candidate bodies.
+    const U32 bodyCount = pControllerBuffer->gatherQuery( pWorldQuery->getQueryResults(), NULL, true, mBodyIndices );
 
-        // Skip if asleep.
-        if ( !pSceneObject->getAwake() )
-            continue;
+    // Iterate the bodies.
+    for ( U32 n = 0; n < bodyCount; n++ )
+    {
+        // Fetch the body index.
+        const U32 bodyIndex = mBodyIndices[n];
 
-        // Ignore if it's a static body.
-        if ( pSceneObject->getBodyType() == b2_staticBody )
-            continue;
+        // Fetch the scene object.
+        SceneObject* pSceneObject = pControllerBuffer->getObject( bodyIndex );
 
         // Fetch the shape count.
         const U32 shapeCount = pSceneObject->getCollisionShapeCount();
@@ -197,14 +195,14 @@ void BuoyancyController::integrate( Scene* pScene, const F32 totalTime, const F3
 
         // Buoyancy
         const Vector2 buoyancyForce = -mFluidDensity * area * mFluidGravity;
-        pSceneObject->applyForce(buoyancyForce, massCenter);
+        pControllerBuffer->addForce( bodyIndex, buoyancyForce, massCenter );
 
         // Linear drag
-        const Vector2 dragForce = (pSceneObject->getLinearVelocityFromWorldPoint(areaCenter) - mFlowVelocity) * (-mLinearDrag * area);
-        pSceneObject->applyForce(dragForce, areaCenter );
+        const Vector2 dragForce = (pControllerBuffer->getLinearVelocityFromWorldPoint( bodyIndex, areaCenter ) - mFlowVelocity) * (-mLinearDrag * area);
+        pControllerBuffer->addForce( bodyIndex, dragForce, areaCenter );
 
         // Angular drag
-        pSceneObject->applyTorque( -pSceneObject->getInertia() / pSceneObject->getMass() * area * pSceneObject->getAngularVelocity()*mAngularDrag );
+        pControllerBuffer->addTorque( bodyIndex, -pSceneObject->getInertia() / pSceneObject->getMass() * area * pControllerBuffer->getAngularVelocity( bodyIndex )*mAngularDrag );
     }
 }
 
@@ -385,6 +383,10 @@ void BuoyancyController::renderOverlay( Scene* pScene, const SceneRenderState* p
     // Call parent.
     Parent::renderOverlay( pScene, pSceneRenderState, pBatchRenderer );
 
+    // Finish if the fluid area is culled.
+    if ( pScene->mDebugDraw.getCulled( Scene::SCENE_DEBUG_CONTROLLERS, mFluidArea ) )
+        return;
+
     // Draw fluid area.
     pScene->mDebugDraw.DrawAABB( mFluidArea, ColorF(0.7f, 0.7f, 0.9f) );
 }
\ No newline at end of file
@@ -62,6 +62,9 @@ private:
     /// The outer fluid surface normal.
     Vector2 mSurfaceNormal;
 
+    /// Per-tick scratch buffer.
+    Vector<U32> mBodyIndices;
+
 protected:
     F32 ComputeCircleSubmergedArea( const b2Transform& bodyTransform, const b2CircleShape* pShape, Vector2& center );
     F32 ComputePolygonSubmergedArea( const b2Transform& bodyTransform, const b2PolygonShape* pShape, Vector2& center );
@@ -114,14 +114,14 @@ void PointForceController::integrate( Scene* pScene, const F32 totalTime, const
     // Query for candidate objects.
     pWorldQuery->anyQueryAABB( aabb ); 
 
-    // Fetch results.
-    typeWorldQueryResultVector& queryResults = pWorldQuery->getQueryResults();
+    // Fetch the controller buffer.
+    SceneControllerBuffer* pControllerBuffer = pScene->getControllerBuffer();
 
-    // Fetch result count.
-    const U32 resultCount = (U32)queryResults.size();
+    // Gather the candidate bodies.
+    const U32 bodyCount = pControllerBuffer->gatherQuery( pWorldQuery->getQueryResults(), mTrackedObject, false, mBodyIndices );
 
     // Finish if nothing to process.
-    if ( resultCount == 0 )
+    if ( bodyCount == 0 )
         return;
 
     // Calculate the radius squared.
@@ -134,73 +134,76 @@ void PointForceController::integrate( Scene* pScene, const F32 totalTime, const
     const F32 linearDrag = mClampF( mLinearDrag, 0.0f, 1.0f ) * elapsedTime;
     const F32 angularDrag = mClampF( mAngularDrag, 0.0f, 1.0f ) * elapsedTime;
 
-    // Fetch the tracked object.
-    const SceneObject* pTrackedObject = mTrackedObject;
+    // Size the scratch buffers.
+    mForceX.setSize( bodyCount );
+    mForceY.setSize( bodyCount );
+    mForceScale.setSize( bodyCount );
 
-    // Iterate the results.
-    for ( U32 n = 0; n < resultCount; n++ )
-    {
-        // Fetch the scene object.
-        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
-
-        // Ignore if it's the tracked object.
-        if ( pSceneObject == pTrackedObject )
-            continue;
-
-        // Ignore if it's a static body.
-        if ( pSceneObject->getBodyType() == b2_staticBody )
-            continue;
-
-        // Calculate the force distance to the controllers current position.
-        Vector2 distanceForce = currentPosition - pSceneObject->getPosition();
+    const U32* pBodyIndices = mBodyIndices.address();
+    const F32* pPositionX = pControllerBuffer->getPositionX();
+    const F32* pPositionY = pControllerBuffer->getPositionY();
+    F32* pForceX = mForceX.address();
+    F32* pForceY = mForceY.address();
+    F32* pForceScale = mForceScale.address();
 
-        // Fetch distance squared.
-        const F32 distanceSqr = distanceForce.LengthSquared();
-
-        // Skip if the position is outside the radius or is centered on the controller.
-        if ( distanceSqr > radiusSqr || distanceSqr < FLT_EPSILON )
-            continue;
+    // Calculate the force distance to the controllers current position.
+    for ( U32 n = 0; n < bodyCount; n++ )
+    {
+        pForceX[n] = currentPosition.x - pPositionX[pBodyIndices[n]];
+        pForceY[n] = currentPosition.y - pPositionY[pBodyIndices[n]];
+    }
 
-        // Non-Linear force?
-        if ( mNonLinear )
+    // Calculate the force scales.
+    // NOTE: These loops are kept branch-free so that they can be vectorized.  A zero scale
+    // marks a body that is outside the radius or is centered on the controller.
+    if ( mNonLinear )
+    {
+        // Use an approximation of the inverse-square law.
+        for ( U32 n = 0; n < bodyCount; n++ )
         {
-            // Yes, so use an approximation of the inverse-square law.
-            distanceForce *= (1.0f / distanceSqr) * forceSqr;
+            const F32 distanceSqr = pForceX[n] * pForceX[n] + pForceY[n] * pForceY[n];
+            const F32 scale = forceSqr / (distanceSqr < FLT_EPSILON ? FLT_EPSILON : distanceSqr);
+            pForceScale[n] = (distanceSqr > radiusSqr || distanceSqr < FLT_EPSILON) ? 0.0f : scale;
         }
-        else
+    }
+    else
+    {
+        // Normalize to the specified force (linear).
+        for ( U32 n = 0; n < bodyCount; n++ )
         {
-            // No, so normalize to the specified force (linear).
-            distanceForce.Normalize( mForce );
+            const F32 distanceSqr = pForceX[n] * pForceX[n] + pForceY[n] * pForceY[n];
+            const F32 scale = mForce / mSqrt(distanceSqr < FLT_EPSILON ? FLT_EPSILON : distanceSqr);
+            pForceScale[n] = (distanceSqr > radiusSqr || distanceSqr < FLT_EPSILON) ? 0.0f : scale;
         }
+    }
+
+    // Scale the forces.
+    for ( U32 n = 0; n < bodyCount; n++ )
+    {
+        pForceX[n] *= pForceScale[n];
+        pForceY[n] *= pForceScale[n];
+    }
 
-        // Apply the force.
-        pSceneObject->applyForce( distanceForce, true );
+    // Accumulate the results.
+    for ( U32 n = 0; n < bodyCount; n++ )
+    {
+        // Skip if not affected.
+        if ( pForceScale[n] == 0.0f )
+            continue;
 
-        // Linear drag?
-        if ( linearDrag > 0.0f )
-        {
-            // Yes, so fetch linear velocity.
-            Vector2 linearVelocity = pSceneObject->getLinearVelocity();
+        // Fetch the body index.
+        const U32 bodyIndex = pBodyIndices[n];
 
-            // Calculate linear velocity change.
-            const Vector2 linearVelocityDelta = linearVelocity * linearDrag;
+        // Accumulate the force.
+        pControllerBuffer->addForce( bodyIndex, pForceX[n], pForceY[n] );
 
-            // Set linear velocity.
-            pSceneObject->setLinearVelocity( linearVelocity - linearVelocityDelta );
-        }
+        // Linear drag?
+        if ( linearDrag > 0.0f )
+            pControllerBuffer->scaleLinearVelocity( bodyIndex, 1.0f - linearDrag );
 
         // Angular drag?
         if ( angularDrag > 0.0f )
-        {
-            // Yes, so fetch angular velocity.
-            F32 angularVelocity = pSceneObject->getAngularVelocity();
-
-            // Calculate angular velocity change.
-            const F32 angularVelocityDelta = angularVelocity * angularDrag;
-
-            // Set angular velocity.
-            pSceneObject->setAngularVelocity( angularVelocity - angularVelocityDelta );
-        }
+            pControllerBuffer->scaleAngularVelocity( bodyIndex, 1.0f - angularDrag );
     }
 }
 
@@ -211,6 +214,16 @@ void PointForceController::renderOverlay( Scene* pScene, const SceneRenderState*
     // Call parent.
     Parent::renderOverlay( pScene, pSceneRenderState, pBatchRenderer );
 
+    // Fetch the force area.
+    const Vector2 position = getCurrentPosition();
+    b2AABB forceAABB;
+    forceAABB.lowerBound.Set( position.x - mRadius, position.y - mRadius );
+    forceAABB.upperBound.Set( position.x + mRadius, position.y + mRadius );
+
+    // Finish if the force area is culled.
+    if ( pScene->mDebugDraw.getCulled( Scene::SCENE_DEBUG_CONTROLLERS, forceAABB ) )
+        return;
+
     // Draw force radius.
-    pScene->mDebugDraw.DrawCircle( getCurrentPosition(), mRadius, ColorF(1.0f, 1.0f, 0.0f ) );
+    pScene->mDebugDraw.DrawCircle( position, mRadius, ColorF(1.0f, 1.0f, 0.0f ) );
 }
\ No newline at end of file
@@ -59,6 +59,12 @@ private:
     /// Tracked object.
     SimObjectPtr<SceneObject> mTrackedObject;
 
+    /// Per-tick scratch buffers.
+    Vector<U32> mBodyIndices;
+    Vector<F32> mForceX;
+    Vector<F32> mForceY;
+    Vector<F32> mForceScale;
+
 public:
     PointForceController();
     virtual ~PointForceController();
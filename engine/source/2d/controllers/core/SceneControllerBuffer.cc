@@ -0,0 +1,221 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CONTROLLER_BUFFER_H_
+#include "2d/controllers/core/SceneControllerBuffer.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//------------------------------------------------------------------------------
+
+U32 SceneControllerBuffer::smMasterBufferKey = 0;
+
+//------------------------------------------------------------------------------
+
+SceneControllerBuffer::SceneControllerBuffer() :
+    mInTick( false )
+{
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerBuffer::beginTick( void )
+{
+    // Sanity!
+    AssertFatal( !mInTick, "SceneControllerBuffer::beginTick() - Already in a tick." );
+
+    // Change the buffer key so that previously gathered bodies are gathered again.
+    smMasterBufferKey++;
+
+    // Reset the bodies.
+    mObjects.clear();
+    mPositionX.clear();
+    mPositionY.clear();
+    mCenterX.clear();
+    mCenterY.clear();
+    mForceOffsetX.clear();
+    mForceOffsetY.clear();
+    mLinearVelocityX.clear();
+    mLinearVelocityY.clear();
+    mAngularVelocity.clear();
+    mForceX.clear();
+    mForceY.clear();
+    mTorque.clear();
+    mLinearScale.clear();
+    mAngularScale.clear();
+    mApplied.clear();
+
+    mInTick = true;
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerBuffer::endTick( void )
+{
+    // Sanity!
+    AssertFatal( mInTick, "SceneControllerBuffer::endTick() - Not in a tick." );
+
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneControllerBuffer_EndTick);
+
+    mInTick = false;
+
+    // Fetch the body count.
+    const U32 bodyCount = getCount();
+
+    // Write the results back to the bodies.
+    for ( U32 index = 0; index < bodyCount; ++index )
+    {
+        // Fetch the scene object.
+        SceneObject* pSceneObject = mObjects[index];
+
+        // Apply any linear drag.
+        if ( mLinearScale[index] != 1.0f )
+            pSceneObject->setLinearVelocity( pSceneObject->getLinearVelocity() * mLinearScale[index] );
+
+        // Apply any angular drag.
+        if ( mAngularScale[index] != 1.0f )
+            pSceneObject->setAngularVelocity( pSceneObject->getAngularVelocity() * mAngularScale[index] );
+
+        // Skip if nothing was applied.
+        if ( !mApplied[index] )
+            continue;
+
+        // Apply the accumulated force at the center of mass and the accumulated torque.
+        pSceneObject->applyForce( Vector2( mForceX[index], mForceY[index] ), Vector2( mCenterX[index], mCenterY[index] ), true );
+
+        if ( mNotZero( mTorque[index] ) )
+            pSceneObject->applyTorque( mTorque[index], true );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+U32 SceneControllerBuffer::gather( SceneObject* pSceneObject )
+{
+    // Sanity!
+    AssertFatal( mInTick, "SceneControllerBuffer::gather() - Not in a tick." );
+    AssertFatal( pSceneObject != NULL, "SceneControllerBuffer::gather() - Invalid scene object." );
+
+    // Finish if the body has already been gathered this tick.
+    if ( pSceneObject->getControllerBufferKey() == smMasterBufferKey )
+        return pSceneObject->getControllerBufferIndex();
+
+    // Fetch the new index.
+    const U32 index = getCount();
+
+    // Flag the body as gathered.
+    pSceneObject->setControllerBufferKey( smMasterBufferKey, index );
+
+    // Fetch the body state.
+    const Vector2 position = pSceneObject->getPosition();
+    const Vector2 worldCenter = pSceneObject->getWorldCenter();
+    const Vector2 linearVelocity = pSceneObject->getLinearVelocity();
+
+    // A force without a point is applied at the (unrotated) local center so keep the offset from the center of mass.
+    const Vector2 forceOffset = position + pSceneObject->getLocalCenter() - worldCenter;
+
+    mObjects.push_back( pSceneObject );
+    mPositionX.push_back( position.x );
+    mPositionY.push_back( position.y );
+    mCenterX.push_back( worldCenter.x );
+    mCenterY.push_back( worldCenter.y );
+    mForceOffsetX.push_back( forceOffset.x );
+    mForceOffsetY.push_back( forceOffset.y );
+    mLinearVelocityX.push_back( linearVelocity.x );
+    mLinearVelocityY.push_back( linearVelocity.y );
+    mAngularVelocity.push_back( pSceneObject->getAngularVelocity() );
+    mForceX.push_back( 0.0f );
+    mForceY.push_back( 0.0f );
+    mTorque.push_back( 0.0f );
+    mLinearScale.push_back( 1.0f );
+    mAngularScale.push_back( 1.0f );
+    mApplied.push_back( false );
+
+    return index;
+}
+
+//------------------------------------------------------------------------------
+
+U32 SceneControllerBuffer::gatherQuery( const typeWorldQueryResultVector& queryResults, const SceneObject* pIgnoreObject, const bool awakeOnly, Vector<U32>& indices )
+{
+    // Reset the indices.
+    indices.clear();
+
+    // Fetch result count.
+    const U32 resultCount = (U32)queryResults.size();
+
+    // Iterate the results.
+    for ( U32 n = 0; n < resultCount; n++ )
+    {
+        // Fetch the scene object.
+        SceneObject* pSceneObject = queryResults[n].mpSceneObject;
+
+        // Ignore if it's the ignored object.
+        if ( pSceneObject == pIgnoreObject )
+            continue;
+
+        // Ignore if it's a static body.
+        if ( pSceneObject->getBodyType() == b2_staticBody )
+            continue;
+
+        // Skip if asleep and only awake bodies are required.
+        // NOTE: A body already affected by a controller this tick will be woken so is treated as awake.
+        if ( awakeOnly && !pSceneObject->getAwake() )
+        {
+            if ( pSceneObject->getControllerBufferKey() != smMasterBufferKey || !mApplied[pSceneObject->getControllerBufferIndex()] )
+                continue;
+        }
+
+        indices.push_back( gather( pSceneObject ) );
+    }
+
+    return (U32)indices.size();
+}
+
+//------------------------------------------------------------------------------
+
+Vector2 SceneControllerBuffer::getLinearVelocityFromWorldPoint( const U32 index, const Vector2& worldPoint ) const
+{
+    const Vector2 linearVelocity = getLinearVelocity( index );
+    const F32 angularVelocity = getAngularVelocity( index );
+
+    return Vector2(
+        linearVelocity.x - angularVelocity * (worldPoint.y - mCenterY[index]),
+        linearVelocity.y + angularVelocity * (worldPoint.x - mCenterX[index]) );
+}
+
+//------------------------------------------------------------------------------
+
+void SceneControllerBuffer::addForce( const U32 index, const Vector2& worldForce, const Vector2& worldPoint )
+{
+    mForceX[index] += worldForce.x;
+    mForceY[index] += worldForce.y;
+    mTorque[index] += (worldPoint.x - mCenterX[index]) * worldForce.y - (worldPoint.y - mCenterY[index]) * worldForce.x;
+    mApplied[index] = true;
+}
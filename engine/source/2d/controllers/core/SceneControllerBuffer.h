@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CONTROLLER_BUFFER_H_
+#define _SCENE_CONTROLLER_BUFFER_H_
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+#ifndef _WORLD_QUERY_RESULT_H_
+#include "2d/scene/WorldQueryResult.h"
+#endif
+
+//------------------------------------------------------------------------------
+
+class SceneObject;
+
+//------------------------------------------------------------------------------
+
+/// A structure-of-arrays snapshot of the bodies affected by scene controllers during a single tick.
+/// Each body is gathered only once per tick no matter how many controllers affect it.  Controllers
+/// accumulate forces, torques and velocity drag into the buffer which are then written back to
+/// the bodies in a single pass once all the controllers have been integrated.
+class SceneControllerBuffer
+{
+public:
+    SceneControllerBuffer();
+    ~SceneControllerBuffer() {}
+
+    /// Tick.
+    void                    beginTick( void );
+    void                    endTick( void );
+    inline bool             getInTick( void ) const                     { return mInTick; }
+
+    /// Gathering.
+    U32                     gather( SceneObject* pSceneObject );
+    U32                     gatherQuery( const typeWorldQueryResultVector& queryResults, const SceneObject* pIgnoreObject, const bool awakeOnly, Vector<U32>& indices );
+    inline U32              getCount( void ) const                      { return (U32)mObjects.size(); }
+    inline SceneObject*     getObject( const U32 index ) const          { return mObjects[index]; }
+
+    /// Body state.
+    inline const F32*       getPositionX( void ) const                  { return mPositionX.address(); }
+    inline const F32*       getPositionY( void ) const                  { return mPositionY.address(); }
+    inline Vector2          getWorldCenter( const U32 index ) const     { return Vector2( mCenterX[index], mCenterY[index] ); }
+    inline Vector2          getLinearVelocity( const U32 index ) const  { return Vector2( mLinearVelocityX[index] * mLinearScale[index], mLinearVelocityY[index] * mLinearScale[index] ); }
+    inline F32              getAngularVelocity( const U32 index ) const { return mAngularVelocity[index] * mAngularScale[index]; }
+    Vector2                 getLinearVelocityFromWorldPoint( const U32 index, const Vector2& worldPoint ) const;
+
+    /// Accumulation.
+    inline void             addForce( const U32 index, const F32 forceX, const F32 forceY )
+    {
+        mForceX[index] += forceX;
+        mForceY[index] += forceY;
+        mTorque[index] += mForceOffsetX[index] * forceY - mForceOffsetY[index] * forceX;
+        mApplied[index] = true;
+    }
+    void                    addForce( const U32 index, const Vector2& worldForce, const Vector2& worldPoint );
+    inline void             addTorque( const U32 index, const F32 torque ) { mTorque[index] += torque; mApplied[index] = true; }
+    inline void             scaleLinearVelocity( const U32 index, const F32 scale ) { mLinearScale[index] *= scale; }
+    inline void             scaleAngularVelocity( const U32 index, const F32 scale ) { mAngularScale[index] *= scale; }
+
+private:
+    static U32              smMasterBufferKey;
+
+    bool                    mInTick;
+
+    /// Bodies.
+    Vector<SceneObject*>    mObjects;
+
+    /// Gathered body state.
+    Vector<F32>             mPositionX;
+    Vector<F32>             mPositionY;
+    Vector<F32>             mCenterX;
+    Vector<F32>             mCenterY;
+    Vector<F32>             mForceOffsetX;
+    Vector<F32>             mForceOffsetY;
+    Vector<F32>             mLinearVelocityX;
+    Vector<F32>             mLinearVelocityY;
+    Vector<F32>             mAngularVelocity;
+
+    /// Accumulated results.
+    Vector<F32>             mForceX;
+    Vector<F32>             mForceY;
+    Vector<F32>             mTorque;
+    Vector<F32>             mLinearScale;
+    Vector<F32>             mAngularScale;
+    Vector<bool>            mApplied;
+};
+
+#endif // _SCENE_CONTROLLER_BUFFER_H_
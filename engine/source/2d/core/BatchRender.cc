@@ -286,47 +286,8 @@ void BatchRender::flushInternal( void )
     // Stats.
     mpDebugStats->batchFlushes++;
 
-    if ( mWireframeMode )
-    {
-        // Disable texturing.    
-        glDisable( GL_TEXTURE_2D );
-
-        // Set the polygon mode to line.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
-    }
-    else
-    {
-        // Enable texturing.    
-        glEnable( GL_TEXTURE_2D );
-        glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
-
-        // Set the polygon mode to fill.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
-    }
-
-    // Set blend mode.
-    if ( mBlendMode )
-    {
-        glEnable( GL_BLEND );
-        glBlendFunc( mSrcBlendFactor, mDstBlendFactor );
-        glColor4f(mBlendColor.red, mBlendColor.green, mBlendColor.blue, mBlendColor.alpha );
-    }
-    else
-    {
-        glDisable( GL_BLEND );
-        glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
-    }
-
-    // Set alpha-blend mode.
-    if ( mAlphaTestMode >= 0.0f )
-    {
-        glEnable( GL_ALPHA_TEST );
-        glAlphaFunc( GL_GREATER, mAlphaTestMode );
-    }
-    else
-    {
-        glDisable( GL_ALPHA_TEST );
-    }
+    // Set common render state.
+    setRenderState();
 
     // Enable vertex and texture arrays.
     glEnableClientState( GL_VERTEX_ARRAY );
@@ -444,13 +405,7 @@ void BatchRender::flushInternal( void )
     }
 
     // Reset common render state.
-    glDisableClientState( GL_VERTEX_ARRAY );
-    glDisableClientState( GL_TEXTURE_COORD_ARRAY );
-    glDisableClientState( GL_COLOR_ARRAY );
-    glDisable( GL_ALPHA_TEST );
-    glDisable( GL_BLEND );
-    glDisable( GL_TEXTURE_2D );
-    glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+    resetRenderState();
 
     // Reset batch state.
     mQuadCount = 0;
@@ -464,6 +419,125 @@ void BatchRender::flushInternal( void )
 
 //-----------------------------------------------------------------------------
 
+void BatchRender::RenderTriangles(
+        const Vector2* pVertexPositions,
+        const Vector2* pTexturePositions,
+        const U32 vertexCount,
+        TextureHandle& texture,
+        const b2Transform& transform )
+{
+    // Sanity!
+    AssertFatal( mpDebugStats != NULL, "Debug stats have not been configured." );
+    AssertFatal( vertexCount % 3 == 0, "Cannot render an incomplete triangle list." );
+
+    // Finish if nothing to render.
+    if ( vertexCount == 0 )
+        return;
+
+    PROFILE_SCOPE(BatchRender_RenderTriangles);
+
+    // Flush any pending batches to preserve render order.
+    flush();
+
+    // Set common render state.
+    setRenderState();
+
+    // Apply the transform.
+    glMatrixMode( GL_MODELVIEW );
+    glPushMatrix();
+    glTranslatef( transform.p.x, transform.p.y, 0.0f );
+    glRotatef( mRadToDeg( transform.q.GetAngle() ), 0.0f, 0.0f, 1.0f );
+
+    // Enable vertex and texture arrays.
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glVertexPointer( 2, GL_FLOAT, 0, pVertexPositions );
+    glTexCoordPointer( 2, GL_FLOAT, 0, pTexturePositions );
+
+    // Use the texture coordinates and bind the texture if not in wireframe mode.
+    if ( !mWireframeMode )
+    {
+        glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+        glBindTexture( GL_TEXTURE_2D, texture.getGLName() );
+    }
+
+    // Draw the triangles.
+    glDrawArrays( GL_TRIANGLES, 0, vertexCount );
+
+    // Restore the transform.
+    glPopMatrix();
+
+    // Reset common render state.
+    resetRenderState();
+
+    // Stats.
+    mpDebugStats->batchDrawCallsSorted++;
+    mpDebugStats->batchTrianglesSubmitted += vertexCount / 3;
+    if ( vertexCount / 3 > mpDebugStats->batchMaxTriangleDrawn )
+        mpDebugStats->batchMaxTriangleDrawn = vertexCount / 3;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::setRenderState( void )
+{
+    if ( mWireframeMode )
+    {
+        // Disable texturing.    
+        glDisable( GL_TEXTURE_2D );
+
+        // Set the polygon mode to line.
+        glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
+    }
+    else
+    {
+        // Enable texturing.    
+        glEnable( GL_TEXTURE_2D );
+        glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+
+        // Set the polygon mode to fill.
+        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+    }
+
+    // Set blend mode.
+    if ( mBlendMode )
+    {
+        glEnable( GL_BLEND );
+        glBlendFunc( mSrcBlendFactor, mDstBlendFactor );
+        glColor4f(mBlendColor.red, mBlendColor.green, mBlendColor.blue, mBlendColor.alpha );
+    }
+    else
+    {
+        glDisable( GL_BLEND );
+        glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
+    }
+
+    // Set alpha-blend mode.
+    if ( mAlphaTestMode >= 0.0f )
+    {
+        glEnable( GL_ALPHA_TEST );
+        glAlphaFunc( GL_GREATER, mAlphaTestMode );
+    }
+    else
+    {
+        glDisable( GL_ALPHA_TEST );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::resetRenderState( void )
+{
+    glDisableClientState( GL_VERTEX_ARRAY );
+    glDisableClientState( GL_TEXTURE_COORD_ARRAY );
+    glDisableClientState( GL_COLOR_ARRAY );
+    glDisable( GL_ALPHA_TEST );
+    glDisable( GL_BLEND );
+    glDisable( GL_TEXTURE_2D );
+    glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+}
+
+//-----------------------------------------------------------------------------
+
 void BatchRender::RenderQuad(
         const Vector2& vertexPos0,
         const Vector2& vertexPos1,
@@ -43,6 +43,10 @@
 #include "collection/hashTable.h"
 #endif
 
+#ifndef _FLATHASHMAP_H_
+#include "collection/flatHashMap.h"
+#endif
+
 #ifndef _COLOR_H_
 #include "graphics/color.h"
 #endif
@@ -202,6 +206,16 @@ public:
             const Vector2& texturePos2,
             const Vector2& texturePos3 );
 
+    /// Render a cached triangle list immediately using the current blend and alpha-test state.
+    /// Any pending batches are flushed first so that the render order is preserved.
+    /// The vertex positions are transformed by the specified transform.
+    void RenderTriangles(
+            const Vector2* pVertexPositions,
+            const Vector2* pTexturePositions,
+            const U32 vertexCount,
+            TextureHandle& texture,
+            const b2Transform& transform );
+
     /// Flush (render) any pending batches with a reason metric.
     void flush( U32& reasonMetric );
 
@@ -212,9 +226,13 @@ private:
     /// Flush (render) any pending batches.
     void flushInternal( void );
 
+    /// Set/reset the render state common to all batches.
+    void setRenderState( void );
+    void resetRenderState( void );
+
 private:
     typedef Vector<U32> indexVectorType;
-    typedef HashMap<U32, indexVectorType*> textureBatchType;
+    typedef FlatHashMap<U32, indexVectorType*> textureBatchType;
 
     VectorPtr< indexVectorType* > mIndexVectorPool;
     textureBatchType    mTextureBatchMap;
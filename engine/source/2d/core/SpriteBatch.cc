@@ -46,7 +46,10 @@ SpriteBatch::SpriteBatch() :
     mDefaultSpriteSize( 1.0f, 1.0f ),
     mDefaultSpriteAngle( 0.0f ),
     mpSpriteBatchQuery( NULL ),
-    mBatchCulling( true )
+    mBatchCulling( true ),
+    mBatchCache( false ),
+    mBatchCacheDirty( true ),
+    mBatchCacheRegionSize( 16.0f )
 {
     // Reset batch transform.
     mBatchTransform.SetIdentity();
@@ -62,6 +65,8 @@ SpriteBatch::SpriteBatch() :
 
 SpriteBatch::~SpriteBatch()
 {
+    // Destroy the batch cache.
+    destroyBatchCache();
 }
 
 //-----------------------------------------------------------------------------
@@ -99,6 +104,17 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
     // Calculate local AABB.
     const b2AABB localAABB = calculateLocalAABB( pSceneRenderState->mRenderAABB );
 
+    // Is the batch cache on?
+    if ( mBatchCache )
+    {
+        // Yes, so update the batch cache if it's dirty.
+        if ( mBatchCacheDirty )
+            updateBatchCache();
+
+        // Prepare the cached sprites.
+        prepareBatchCacheRender( pSceneRenderObject, localAABB, pSceneRenderQueue );
+    }
+
     // Do we have a sprite batch query?
     if ( mpSpriteBatchQuery != NULL )
     {
@@ -130,8 +146,8 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
             // Fetch sprite batch Item.
             SpriteBatchItem* pSpriteBatchItem = queryResults[n].mpSpriteBatchItem;
 
-            // Skip if not visible.
-            if ( !pSpriteBatchItem->getVisible() )
+            // Skip if not visible or it's cached.
+            if ( !pSpriteBatchItem->getVisible() || pSpriteBatchItem->getBatchCached() )
                 continue;
 
             // Create a render request.
@@ -158,8 +174,8 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
             // Fetch sprite batch Item.
             SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
 
-            // Skip if not visible.
-            if ( !pSpriteBatchItem->getVisible() )
+            // Skip if not visible or it's cached.
+            if ( !pSpriteBatchItem->getVisible() || pSpriteBatchItem->getBatchCached() )
                 continue;
 
             // Create a render request.
@@ -181,6 +197,29 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
 
 void SpriteBatch::render( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
+    // Is this a batch cache group?
+    if ( pSceneRenderRequest->mpCustomData2 == this )
+    {
+        // Yes, so fetch the batch cache group.
+        BatchCacheGroup* pBatchCacheGroup = (BatchCacheGroup*)pSceneRenderRequest->mpCustomData1;
+
+        // Set the blend mode.
+        pBatchRenderer->setBlendMode( pSceneRenderRequest );
+
+        // Set the alpha test mode.
+        pBatchRenderer->setAlphaTestMode( pSceneRenderRequest );
+
+        // Render the cached vertices.
+        pBatchRenderer->RenderTriangles(
+            pBatchCacheGroup->mVertexPositions.address(),
+            pBatchCacheGroup->mTexturePositions.address(),
+            (U32)pBatchCacheGroup->mVertexPositions.size(),
+            pBatchCacheGroup->mTexture,
+            mBatchTransform );
+
+        return;
+    }
+
     // Fetch sprite batch Item.
     SpriteBatchItem* pSpriteBatchItem = (SpriteBatchItem*)pSceneRenderRequest->mpCustomData1;
 
@@ -275,6 +314,10 @@ void SpriteBatch::copyTo( SpriteBatch* pSpriteBatch ) const
     // Set batch culling.
     pSpriteBatch->setBatchCulling( getBatchCulling() );
 
+    // Set batch cache.
+    pSpriteBatch->setBatchCache( getBatchCache() );
+    pSpriteBatch->setBatchCacheRegionSize( getBatchCacheRegionSize() );
+
     // Set sprite default size and angle.
     pSpriteBatch->setDefaultSpriteStride( getDefaultSpriteStride() );
     pSpriteBatch->setDefaultSpriteSize( getDefaultSpriteSize() );
@@ -318,6 +361,9 @@ U32 SpriteBatch::addSprite( const SpriteBatchItem::LogicalPosition& logicalPosit
     // Flag local extents as dirty.
     setLocalExtentsDirty();
 
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
+
     return mSelectedSprite->getBatchId();
 }
 
@@ -351,6 +397,9 @@ bool SpriteBatch::removeSprite( void )
     // Flag local extents as dirty.
     setLocalExtentsDirty();
 
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
+
     return true;
 }
 
@@ -370,6 +419,9 @@ void SpriteBatch::clearSprites( void )
     // Clear sprite names.
     mSpriteNames.clear();
 
+    // Destroy the batch cache.
+    destroyBatchCache();
+
     // Cache all sprites.
     for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
     {
@@ -402,6 +454,39 @@ void SpriteBatch::setBatchCulling( const bool batchCulling )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::setBatchCache( const bool batchCache )
+{
+    // Finish if no change.
+    if ( mBatchCache == batchCache )
+        return;
+
+    // Set batch cache.
+    mBatchCache = batchCache;
+
+    // Destroy any existing batch cache.
+    destroyBatchCache();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::setBatchCacheRegionSize( const F32 regionSize )
+{
+    // Sanity!
+    if ( regionSize <= 0.0f )
+    {
+        Con::warnf( "SpriteBatch::setBatchCacheRegionSize() - Invalid region size of '%g'.", regionSize );
+        return;
+    }
+
+    // Set batch cache region size.
+    mBatchCacheRegionSize = regionSize;
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::selectSprite( const SpriteBatchItem::LogicalPosition& logicalPosition )
 {
     // Select sprite.
@@ -471,6 +556,9 @@ void SpriteBatch::setSpriteImage( const char* pAssetId, const U32 imageFrame )
 
     // Set image and frame.
     mSelectedSprite->setImage( pAssetId, imageFrame );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -495,6 +583,9 @@ void SpriteBatch::setSpriteImageFrame( const U32 imageFrame )
 
     // Set image frame.
     mSelectedSprite->setImageFrame( imageFrame );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -525,6 +616,9 @@ void SpriteBatch::setSpriteAnimation( const char* pAssetId )
 
     // Set animation.
     mSelectedSprite->setAnimation( pAssetId );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -549,6 +643,9 @@ void SpriteBatch::clearSpriteAsset( void )
 
     // Clear the asset.
     mSelectedSprite->clearAssets();
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -561,6 +658,9 @@ void SpriteBatch::setSpriteVisible( const bool visible )
 
     // Set visibility.
     mSelectedSprite->setVisible( visible );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -588,6 +688,9 @@ void SpriteBatch::setSpriteLocalPosition( const Vector2& localPosition )
 
     // Flag local extents as dirty.
     setLocalExtentsDirty();
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -615,6 +718,9 @@ void SpriteBatch::setSpriteAngle( const F32 localAngle )
 
     // Flag local extents as dirty.
     setLocalExtentsDirty();
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -639,6 +745,9 @@ void SpriteBatch::setSpriteDepth( const F32 depth )
 
     // Set depth.
     mSelectedSprite->setDepth( depth );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -666,6 +775,9 @@ void SpriteBatch::setSpriteSize( const Vector2& size )
 
     // Flag local extents as dirty.
     setLocalExtentsDirty();
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -690,6 +802,9 @@ void SpriteBatch::setSpriteFlipX( const bool flipX )
 
     // Set flip X.
     mSelectedSprite->setFlipX( flipX );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -714,6 +829,9 @@ void SpriteBatch::setSpriteFlipY( const bool flipY )
 
     // Set flip Y.
     mSelectedSprite->setFlipY( flipY );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -738,6 +856,9 @@ void SpriteBatch::setSpriteSortPoint( const Vector2& sortPoint )
 
     // Set sort point.
     mSelectedSprite->setSortPoint( sortPoint );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -762,6 +883,9 @@ void SpriteBatch::setSpriteRenderGroup( const char* pRenderGroup )
 
     // Set render group.
     mSelectedSprite->setRenderGroup( pRenderGroup );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -786,6 +910,9 @@ void SpriteBatch::setSpriteBlendMode( const bool blendMode )
 
     // Set blend mode.
     mSelectedSprite->setBlendMode( blendMode );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -810,6 +937,9 @@ void SpriteBatch::setSpriteSrcBlendFactor( GLenum srcBlendFactor )
 
     // Set source blend factor.
     mSelectedSprite->setSrcBlendFactor( srcBlendFactor );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -834,6 +964,9 @@ void SpriteBatch::setSpriteDstBlendFactor( GLenum dstBlendFactor )
 
     // Set destination blend factor.
     mSelectedSprite->setDstBlendFactor( dstBlendFactor );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -858,6 +991,9 @@ void SpriteBatch::setSpriteBlendColor( const ColorF& blendColor )
 
     // Set blend color.
     mSelectedSprite->setBlendColor( blendColor );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -882,6 +1018,9 @@ void SpriteBatch::setSpriteBlendAlpha( const F32 alpha )
 
     // Set blend alpha.
     mSelectedSprite->setBlendAlpha( alpha );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -906,6 +1045,9 @@ void SpriteBatch::setSpriteAlphaTest( const F32 alphaTestMode )
 
     // Set alpha-test mode.
     mSelectedSprite->setAlphaTest( alphaTestMode );
+
+    // Flag the batch cache as dirty.
+    setBatchCacheDirty();
 }
 
 //------------------------------------------------------------------------------
@@ -1237,6 +1379,198 @@ void SpriteBatch::destroySpriteBatchQuery( void )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::updateBatchCache( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_UpdateBatchCache);
+
+    // Destroy the existing batch cache.
+    destroyBatchCache();
+
+    typedef HashMap< U32, BatchCacheGroup* > typeBatchCacheGroupHash;
+    typeBatchCacheGroupHash batchCacheGroupHash;
+
+    // Iterate the sprites.
+    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch Item.
+        SpriteBatchItem* pSpriteBatchItem = spriteItr->value;
+
+        // Skip if not visible, animated or cannot render.
+        if ( !pSpriteBatchItem->getVisible() || !pSpriteBatchItem->isStaticFrameProvider() || !pSpriteBatchItem->validRender() )
+            continue;
+
+        // Fetch the local AABB.
+        // NOTE: This also updates the local OOBB if required.
+        const b2AABB& localAABB = pSpriteBatchItem->getLocalAABB();
+
+        // Calculate the cache region.
+        const Vector2 localCenter = localAABB.GetCenter();
+        const S32 regionX = (S32)mFloor( localCenter.x / mBatchCacheRegionSize );
+        const S32 regionY = (S32)mFloor( localCenter.y / mBatchCacheRegionSize );
+
+        // Fetch the texture.
+        TextureHandle& texture = pSpriteBatchItem->getProviderTexture();
+
+        // Calculate the group key.
+        const U32 groupKey = ((U32)regionX * 73856093) ^ ((U32)regionY * 19349663) ^ (texture.getGLName() * 83492791);
+
+        // Find a group with the same region, texture and render state.
+        typeBatchCacheGroupHash::iterator groupItr = batchCacheGroupHash.find( groupKey );
+        BatchCacheGroup* pBatchCacheGroup = groupItr == batchCacheGroupHash.end() ? NULL : groupItr->value;
+        while( pBatchCacheGroup != NULL )
+        {
+            if (    pBatchCacheGroup->mRegionX == regionX &&
+                    pBatchCacheGroup->mRegionY == regionY &&
+                    pBatchCacheGroup->mTexture == texture &&
+                    pBatchCacheGroup->mDepth == pSpriteBatchItem->getDepth() &&
+                    pBatchCacheGroup->mRenderGroup == pSpriteBatchItem->getRenderGroup() &&
+                    pBatchCacheGroup->mBlendMode == pSpriteBatchItem->getBlendMode() &&
+                    pBatchCacheGroup->mSrcBlendFactor == pSpriteBatchItem->getSrcBlendFactor() &&
+                    pBatchCacheGroup->mDstBlendFactor == pSpriteBatchItem->getDstBlendFactor() &&
+                    pBatchCacheGroup->mBlendColor == pSpriteBatchItem->getBlendColor() &&
+                    mIsEqual( pBatchCacheGroup->mAlphaTest, pSpriteBatchItem->getAlphaTest() ) )
+                break;
+
+            pBatchCacheGroup = pBatchCacheGroup->mpNext;
+        }
+
+        // Create a group if one was not found.
+        if ( pBatchCacheGroup == NULL )
+        {
+            pBatchCacheGroup = new BatchCacheGroup();
+            pBatchCacheGroup->mRegionX = regionX;
+            pBatchCacheGroup->mRegionY = regionY;
+            pBatchCacheGroup->mTexture = texture;
+            pBatchCacheGroup->mDepth = pSpriteBatchItem->getDepth();
+            pBatchCacheGroup->mSortPoint = pSpriteBatchItem->getSortPoint();
+            pBatchCacheGroup->mSerialId = pSpriteBatchItem->getBatchId();
+            pBatchCacheGroup->mRenderGroup = pSpriteBatchItem->getRenderGroup();
+            pBatchCacheGroup->mBlendMode = pSpriteBatchItem->getBlendMode();
+            pBatchCacheGroup->mSrcBlendFactor = pSpriteBatchItem->getSrcBlendFactor();
+            pBatchCacheGroup->mDstBlendFactor = pSpriteBatchItem->getDstBlendFactor();
+            pBatchCacheGroup->mBlendColor = pSpriteBatchItem->getBlendColor();
+            pBatchCacheGroup->mAlphaTest = pSpriteBatchItem->getAlphaTest();
+            pBatchCacheGroup->mLocalAABB = localAABB;
+
+            // Chain any existing groups with the same key.
+            pBatchCacheGroup->mpNext = groupItr == batchCacheGroupHash.end() ? NULL : groupItr->value;
+            batchCacheGroupHash[groupKey] = pBatchCacheGroup;
+
+            mBatchCacheGroups.push_back( pBatchCacheGroup );
+        }
+        else
+        {
+            // Combine the group AABB.
+            pBatchCacheGroup->mLocalAABB.Combine( localAABB );
+        }
+
+        // Fetch texel area.
+        ImageAsset::FrameArea::TexelArea texelArea = pSpriteBatchItem->getProviderImageFrameArea().mTexelArea;
+
+        // Flip texture coordinates appropriately.
+        texelArea.setFlip( pSpriteBatchItem->getFlipX(), pSpriteBatchItem->getFlipY() );
+
+        // Fetch lower/upper texture coordinates.
+        const Vector2& texLower = texelArea.mTexelLower;
+        const Vector2& texUpper = texelArea.mTexelUpper;
+
+        // Fetch the local OOBB.
+        const Vector2* pLocalOOBB = pSpriteBatchItem->mLocalOOBB;
+
+        const Vector2 texturePos0( texLower.x, texUpper.y );
+        const Vector2 texturePos1( texUpper.x, texUpper.y );
+        const Vector2 texturePos2( texUpper.x, texLower.y );
+        const Vector2 texturePos3( texLower.x, texLower.y );
+
+        // Add the quad as two triangles.
+        Vector<Vector2>& vertexPositions = pBatchCacheGroup->mVertexPositions;
+        Vector<Vector2>& texturePositions = pBatchCacheGroup->mTexturePositions;
+        vertexPositions.push_back( pLocalOOBB[0] );
+        vertexPositions.push_back( pLocalOOBB[1] );
+        vertexPositions.push_back( pLocalOOBB[2] );
+        vertexPositions.push_back( pLocalOOBB[0] );
+        vertexPositions.push_back( pLocalOOBB[2] );
+        vertexPositions.push_back( pLocalOOBB[3] );
+        texturePositions.push_back( texturePos0 );
+        texturePositions.push_back( texturePos1 );
+        texturePositions.push_back( texturePos2 );
+        texturePositions.push_back( texturePos0 );
+        texturePositions.push_back( texturePos2 );
+        texturePositions.push_back( texturePos3 );
+
+        // Flag the sprite as cached.
+        pSpriteBatchItem->setBatchCached( true );
+    }
+
+    // Flag the batch cache as NOT dirty.
+    mBatchCacheDirty = false;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::destroyBatchCache( void )
+{
+    // Delete the batch cache groups.
+    for( Vector<BatchCacheGroup*>::iterator groupItr = mBatchCacheGroups.begin(); groupItr != mBatchCacheGroups.end(); ++groupItr )
+    {
+        delete (*groupItr);
+    }
+    mBatchCacheGroups.clear();
+
+    // Flag all the sprites as not cached.
+    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        spriteItr->value->setBatchCached( false );
+    }
+
+    // Flag the batch cache as dirty.
+    mBatchCacheDirty = true;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::prepareBatchCacheRender( SceneRenderObject* pSceneRenderObject, const b2AABB& localAABB, SceneRenderQueue* pSceneRenderQueue )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_PrepareBatchCacheRender);
+
+    // Iterate the batch cache groups.
+    for( Vector<BatchCacheGroup*>::iterator groupItr = mBatchCacheGroups.begin(); groupItr != mBatchCacheGroups.end(); ++groupItr )
+    {
+        // Fetch the batch cache group.
+        BatchCacheGroup* pBatchCacheGroup = *groupItr;
+
+        // Skip if culling and the group is not in view.
+        if ( mBatchCulling && !b2TestOverlap( pBatchCacheGroup->mLocalAABB, localAABB ) )
+            continue;
+
+        // Create a render request.
+        SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
+
+        pSceneRenderRequest->mWorldPosition = b2Mul( mBatchTransform, pBatchCacheGroup->mLocalAABB.GetCenter() );
+        pSceneRenderRequest->mDepth = pBatchCacheGroup->mDepth;
+        pSceneRenderRequest->mSortPoint = pBatchCacheGroup->mSortPoint;
+        pSceneRenderRequest->mSerialId = pBatchCacheGroup->mSerialId;
+        pSceneRenderRequest->mRenderGroup = pBatchCacheGroup->mRenderGroup;
+        pSceneRenderRequest->mBlendMode = pBatchCacheGroup->mBlendMode;
+        pSceneRenderRequest->mSrcBlendFactor = pBatchCacheGroup->mSrcBlendFactor;
+        pSceneRenderRequest->mDstBlendFactor = pBatchCacheGroup->mDstBlendFactor;
+        pSceneRenderRequest->mBlendColor = pBatchCacheGroup->mBlendColor;
+        pSceneRenderRequest->mAlphaTest = pBatchCacheGroup->mAlphaTest;
+
+        // Set identity.
+        pSceneRenderRequest->mpSceneRenderObject = pSceneRenderObject;
+
+        // Set custom data.
+        // NOTE: The sprite batch is used to identify the request as a batch cache group.
+        pSceneRenderRequest->mpCustomData1 = pBatchCacheGroup;
+        pSceneRenderRequest->mpCustomData2 = this;
+    }
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::destroySprite( const U32 batchId )
 {
     // Debug Profiling.
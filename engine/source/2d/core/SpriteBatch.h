@@ -31,6 +31,10 @@
 #include "2d/scene/SceneRenderObject.h"
 #endif
 
+#ifndef _FLATHASHMAP_H_
+#include "collection/flatHashMap.h"
+#endif
+
 //------------------------------------------------------------------------------  
 
 class SpriteBatchQuery;
@@ -42,10 +46,34 @@ class SpriteBatch
 public:
     static const S32                INVALID_SPRITE_PROXY = -1;  
 
+    /// A group of static sprites sharing a cache region, texture and render state.
+    /// The vertices are held in batch-local space so are unaffected by the batch transform.
+    struct BatchCacheGroup
+    {
+        S32                 mRegionX;
+        S32                 mRegionY;
+        TextureHandle       mTexture;
+        F32                 mDepth;
+        Vector2             mSortPoint;
+        U32                 mSerialId;
+        StringTableEntry    mRenderGroup;
+        bool                mBlendMode;
+        GLenum              mSrcBlendFactor;
+        GLenum              mDstBlendFactor;
+        ColorF              mBlendColor;
+        F32                 mAlphaTest;
+
+        b2AABB              mLocalAABB;
+        Vector<Vector2>     mVertexPositions;
+        Vector<Vector2>     mTexturePositions;
+
+        BatchCacheGroup*    mpNext;
+    };
+
 protected:
-    typedef HashMap< U32, SpriteBatchItem* > typeSpriteBatchHash;
-    typedef HashMap< SpriteBatchItem::LogicalPosition, SpriteBatchItem* > typeSpritePositionHash;
-    typedef HashMap< StringTableEntry, SpriteBatchItem* > typeSpriteNameHash;
+    typedef FlatHashMap< U32, SpriteBatchItem* > typeSpriteBatchHash;
+    typedef FlatHashMap< SpriteBatchItem::LogicalPosition, SpriteBatchItem* > typeSpritePositionHash;
+    typedef FlatHashMap< StringTableEntry, SpriteBatchItem* > typeSpriteNameHash;
 
     typeSpriteBatchHash             mSprites;
     typeSpritePositionHash          mSpritePositions;
@@ -53,6 +81,8 @@ protected:
     SpriteBatchItem*                mSelectedSprite;
     SceneRenderQueue::RenderSort    mBatchSortMode;
     bool                            mBatchCulling;
+    bool                            mBatchCache;
+    F32                             mBatchCacheRegionSize;
     Vector2                         mDefaultSpriteStride;
     Vector2                         mDefaultSpriteSize;
     F32                             mDefaultSpriteAngle;
@@ -68,6 +98,9 @@ private:
     Vector2                         mLocalExtents;
     bool                            mLocalExtentsDirty;
 
+    bool                            mBatchCacheDirty;
+    Vector<BatchCacheGroup*>        mBatchCacheGroups;
+
 public:
     SpriteBatch();
     virtual ~SpriteBatch();
@@ -83,6 +116,9 @@ public:
     inline U32 getBatchTransformId( void ) { return mBatchTransformId; }
     const b2Transform& getBatchTransform( void ) const { return mBatchTransform; }
 
+    inline void setBatchCacheDirty( void ) { mBatchCacheDirty = true; }
+    inline bool getBatchCacheDirty( void ) const { return mBatchCacheDirty; }
+
     inline void setLocalExtentsDirty( void ) { mLocalExtentsDirty = true; }
     inline bool getLocalExtentsDirty( void ) const { return mLocalExtentsDirty; }
     inline const Vector2& getLocalExtents( void ) { if ( getLocalExtentsDirty() ) updateLocalExtents(); return mLocalExtents; }
@@ -106,6 +142,11 @@ public:
     void setBatchCulling( const bool batchCulling );
     inline bool getBatchCulling( void ) const { return mBatchCulling; }
 
+    void setBatchCache( const bool batchCache );
+    inline bool getBatchCache( void ) const { return mBatchCache; }
+    void setBatchCacheRegionSize( const F32 regionSize );
+    inline F32 getBatchCacheRegionSize( void ) const { return mBatchCacheRegionSize; }
+
     inline void setDefaultSpriteStride( const Vector2& defaultStride ) { mDefaultSpriteStride = defaultStride; }
     inline const Vector2& getDefaultSpriteStride( void ) const { return mDefaultSpriteStride; }
 
@@ -195,6 +236,10 @@ protected:
     void createSpriteBatchQuery( void );
     void destroySpriteBatchQuery( void );
 
+    void updateBatchCache( void );
+    void destroyBatchCache( void );
+    void prepareBatchCacheRender( SceneRenderObject* pSceneRenderObject, const b2AABB& localAABB, SceneRenderQueue* pSceneRenderQueue );
+
     void onTamlCustomWrite( TamlCustomNodes& customNodes  );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
 
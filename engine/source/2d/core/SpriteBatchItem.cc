@@ -125,6 +125,8 @@ void SpriteBatchItem::resetState( void )
 
     mSpriteBatchQueryKey = 0;
 
+    mBatchCached = false;
+
     mUserData = NULL;
 
     // Require self ticking.
@@ -303,6 +305,18 @@ void SpriteBatchItem::updateWorldTransform( const U32 batchTransformId )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatchItem::onAssetRefreshed( AssetPtrBase* pAssetPtrBase )
+{
+    // Call parent.
+    Parent::onAssetRefreshed( pAssetPtrBase );
+
+    // The cached sprite vertices may now be stale.
+    if ( mSpriteBatch != NULL )
+        mSpriteBatch->setBatchCacheDirty();
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::onTamlCustomWrite( TamlCustomNode* pParentNode )
 {
     // Add sprite node.
@@ -713,4 +727,4 @@ void SpriteBatchItem::WriteCustomTamlSchema( const AbstractClassRep* pClassRep,
     pBatchItemLogicalPosition->SetAttribute( "name", spriteLogicalPositionName );
     pBatchItemLogicalPosition->SetAttribute( "type", "xs:string" );
     pBatchItemComplexTypeElement->LinkEndChild( pBatchItemLogicalPosition );
-}
+}
@@ -221,6 +221,8 @@ protected:
 
     U32                 mSpriteBatchQueryKey;
 
+    bool                mBatchCached;
+
     void*               mUserData;
 
 public:
@@ -289,6 +291,9 @@ public:
     inline void setSpriteBatchQueryKey( const U32 key ) { mSpriteBatchQueryKey = key; }
     inline U32  getSpriteBatchQueryKey( void ) const { return mSpriteBatchQueryKey; }
 
+    inline void setBatchCached( const bool batchCached ) { mBatchCached = batchCached; }
+    inline bool getBatchCached( void ) const { return mBatchCached; }
+
     virtual void copyTo( SpriteBatchItem* pSpriteBatchItem ) const;
 
     inline const Vector2* getRenderOOBB( void ) const { return mRenderOOBB; }
@@ -305,6 +310,8 @@ protected:
     void updateLocalTransform( void );
     void updateWorldTransform( const U32 batchTransformId );
 
+    virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
+
     void onTamlCustomWrite( TamlCustomNode* pParentNode );
     void onTamlCustomRead( const TamlCustomNode* pSpriteNode );
 };
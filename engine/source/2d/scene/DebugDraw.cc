@@ -23,11 +23,104 @@
 #include "graphics/dgl.h"
 #include "2d/scene/DebugDraw.h"
 
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
 //-----------------------------------------------------------------------------
 
+DebugDraw::DebugDraw() :
+    mCullMask( Scene::SCENE_DEBUG_CONTROLLERS | Scene::SCENE_DEBUG_JOINTS | Scene::SCENE_DEBUG_COLLISION_SHAPES ),
+    mPointCount( 0 )
+{
+    // Reset the cull area.
+    mCullAABB.lowerBound.Set( -b2_maxFloat, -b2_maxFloat );
+    mCullAABB.upperBound.Set( b2_maxFloat, b2_maxFloat );
+}
+
+//-----------------------------------------------------------------------------
+
+DebugDraw::~DebugDraw()
+{
+    // Delete the point batches.
+    for( Vector<PointBatch*>::iterator pointItr = mPointBatches.begin(); pointItr != mPointBatches.end(); ++pointItr )
+    {
+        delete (*pointItr);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void DebugDraw::flush( void )
+{
+    // Finish if nothing has been submitted.
+    if ( mTriangleVertices.size() == 0 && mLineVertices.size() == 0 && mPointCount == 0 )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(DebugDraw_Flush);
+
+    glDisable( GL_TEXTURE_2D );
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glEnableClientState( GL_COLOR_ARRAY );
+
+    // Draw the (translucent) triangles.
+    if ( mTriangleVertices.size() > 0 )
+    {
+        glEnable( GL_BLEND );
+        glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+        glVertexPointer( 2, GL_FLOAT, sizeof(Vector2), mTriangleVertices.address() );
+        glColorPointer( 4, GL_FLOAT, sizeof(ColorF), mTriangleColors.address() );
+        glDrawArrays( GL_TRIANGLES, 0, mTriangleVertices.size() );
+        glDisable( GL_BLEND );
+
+        mTriangleVertices.clear();
+        mTriangleColors.clear();
+    }
+
+    // Draw the lines.
+    if ( mLineVertices.size() > 0 )
+    {
+        glVertexPointer( 2, GL_FLOAT, sizeof(Vector2), mLineVertices.address() );
+        glColorPointer( 4, GL_FLOAT, sizeof(ColorF), mLineColors.address() );
+        glDrawArrays( GL_LINES, 0, mLineVertices.size() );
+
+        mLineVertices.clear();
+        mLineColors.clear();
+    }
+
+    // Draw the points.
+    for( Vector<PointBatch*>::iterator pointItr = mPointBatches.begin(); pointItr != mPointBatches.end(); ++pointItr )
+    {
+        PointBatch* pPointBatch = *pointItr;
+
+        // Skip if no points of this size were submitted.
+        if ( pPointBatch->mVertices.size() == 0 )
+            continue;
+
+        glPointSize( pPointBatch->mSize );
+        glVertexPointer( 2, GL_FLOAT, sizeof(Vector2), pPointBatch->mVertices.address() );
+        glColorPointer( 4, GL_FLOAT, sizeof(ColorF), pPointBatch->mColors.address() );
+        glDrawArrays( GL_POINTS, 0, pPointBatch->mVertices.size() );
+
+        pPointBatch->mVertices.clear();
+        pPointBatch->mColors.clear();
+    }
+    mPointCount = 0;
+    glPointSize( 1.0f );
+
+    glDisableClientState( GL_VERTEX_ARRAY );
+    glDisableClientState( GL_COLOR_ARRAY );
+
+    // Restore color.
+    glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
+}
+
+//-----------------------------------------------------------------------------
+
 void DebugDraw::DrawAABB( const b2AABB& aabb, const ColorF& color )
 {
     // Debug Profiling.
@@ -71,9 +164,32 @@ void DebugDraw::DrawCollisionShapes( const b2Transform& xf, b2Body* pBody )
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawCollisionShapes);
 
+    // Fetch whether collision shapes are culled.
+    const bool cullShapes = (mCullMask & Scene::SCENE_DEBUG_COLLISION_SHAPES) != 0;
+
     // Iterate fixtures.
     for ( b2Fixture* pFixture = pBody->GetFixtureList(); pFixture; pFixture = pFixture->GetNext() )
     {
+        // Are we culling collision shapes?
+        if ( cullShapes )
+        {
+            // Yes, so calculate the fixture AABB.
+            const b2Shape* pShape = pFixture->GetShape();
+            const int32 childCount = pShape->GetChildCount();
+            b2AABB fixtureAABB;
+            pShape->ComputeAABB( &fixtureAABB, xf, 0 );
+            for ( int32 childIndex = 1; childIndex < childCount; ++childIndex )
+            {
+                b2AABB childAABB;
+                pShape->ComputeAABB( &childAABB, xf, childIndex );
+                fixtureAABB.Combine( childAABB );
+            }
+
+            // Skip if the fixture is not in view.
+            if ( !b2TestOverlap( fixtureAABB, mCullAABB ) )
+                continue;
+        }
+
         // Inactive fixture.
         if ( pBody->IsActive() == false )
         {
@@ -216,6 +332,29 @@ void DebugDraw::DrawJoints( b2World* pWorld )
         b2Vec2 p1 = pJoint->GetAnchorA();
         b2Vec2 p2 = pJoint->GetAnchorB();
 
+        // Are we culling joints?
+        if ( mCullMask & Scene::SCENE_DEBUG_JOINTS )
+        {
+            // Yes, so calculate the joint AABB.
+            b2AABB jointAABB;
+            jointAABB.lowerBound = b2Min( b2Min( x1, x2 ), b2Min( p1, p2 ) );
+            jointAABB.upperBound = b2Max( b2Max( x1, x2 ), b2Max( p1, p2 ) );
+
+            // Include the ground anchors for pulley joints.
+            if ( pJoint->GetType() == e_pulleyJoint )
+            {
+                b2PulleyJoint* pPulley = (b2PulleyJoint*)pJoint;
+                const b2Vec2 s1 = pPulley->GetGroundAnchorA();
+                const b2Vec2 s2 = pPulley->GetGroundAnchorB();
+                jointAABB.lowerBound = b2Min( jointAABB.lowerBound, b2Min( s1, s2 ) );
+                jointAABB.upperBound = b2Max( jointAABB.upperBound, b2Max( s1, s2 ) );
+            }
+
+            // Skip if the joint is not in view.
+            if ( !b2TestOverlap( jointAABB, mCullAABB ) )
+                continue;
+        }
+
         ColorF color( 0.5f, 0.8f, 0.8f );
 
         switch ( pJoint->GetType() )
@@ -264,13 +403,12 @@ void DebugDraw::DrawPolygon( const b2Vec2* vertices, int32 vertexCount, const Co
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawPolygon);
 
-    glColor3f(color.red, color.green, color.blue);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < vertexCount; ++i)
+    const ColorF lineColor( color.red, color.green, color.blue, 1.0f );
+
+    for (int32 i = 0, j = vertexCount - 1; i < vertexCount; j = i++)
     {
-        glVertex2f(vertices[i].x, vertices[i].y);
+        submitLine( vertices[j], vertices[i], lineColor );
     }
-    glEnd();
 }
 
 //-----------------------------------------------------------------------------
@@ -280,24 +418,14 @@ void DebugDraw::DrawSolidPolygon( const b2Vec2* vertices, int32 vertexCount, con
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawSolidPolygon);
 
-    glEnable(GL_BLEND);
-    glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glColor4f(0.5f * color.red, 0.5f * color.green, 0.5f * color.blue, 0.15f);
-    glBegin(GL_TRIANGLE_FAN);
-    for (int32 i = 0; i < vertexCount; ++i)
-    {
-        glVertex2f(vertices[i].x, vertices[i].y);
-    }
-    glEnd();
-    glDisable(GL_BLEND);
+    const ColorF fillColor( 0.5f * color.red, 0.5f * color.green, 0.5f * color.blue, 0.15f );
 
-    glColor4f(color.red, color.green, color.blue, 1.0f);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < vertexCount; ++i)
+    for (int32 i = 2; i < vertexCount; ++i)
     {
-        glVertex2f(vertices[i].x, vertices[i].y);
+        submitTriangle( vertices[0], vertices[i - 1], vertices[i], fillColor );
     }
-    glEnd();
+
+    DrawPolygon( vertices, vertexCount, color );
 }
 
 //-----------------------------------------------------------------------------
@@ -307,18 +435,18 @@ void DebugDraw::DrawCircle( const b2Vec2& center, float32 radius, const ColorF&
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawCircle);
 
-    const float32 k_segments = 16.0f;
+    const int32 k_segments = 16;
     const float32 k_increment = 2.0f * b2_pi / k_segments;
-    float32 theta = 0.0f;
-    glColor3f(color.red, color.green, color.blue);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < k_segments; ++i)
+    const ColorF lineColor( color.red, color.green, color.blue, 1.0f );
+
+    b2Vec2 v1 = center + b2Vec2(radius, 0.0f);
+    for (int32 i = 1; i <= k_segments; ++i)
     {
-        b2Vec2 v = center + radius * b2Vec2(cosf(theta), sinf(theta));
-        glVertex2f(v.x, v.y);
-        theta += k_increment;
+        const float32 theta = i == k_segments ? 0.0f : i * k_increment;
+        const b2Vec2 v2 = center + radius * b2Vec2(cosf(theta), sinf(theta));
+        submitLine( v1, v2, lineColor );
+        v1 = v2;
     }
-    glEnd();
 }
     
 //-----------------------------------------------------------------------------
@@ -328,81 +456,66 @@ void DebugDraw::DrawSolidCircle( const b2Vec2& center, float32 radius, const b2V
     // Debug Profiling.
     PROFILE_SCOPE(DebugDraw_DrawSolidCircle);
 
-    const float32 k_segments = 12.0f;
+    const int32 k_segments = 12;
     const float32 k_increment = 2.0f * b2_pi / k_segments;
-    float32 theta = 0.0f;
-    glEnable(GL_BLEND);
-    glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-    glColor4f(0.5f * color.red, 0.5f * color.green, 0.5f * color.blue, 0.15f);
-    glBegin(GL_TRIANGLE_FAN);
-    for (int32 i = 0; i < k_segments; ++i)
-    {
-        b2Vec2 v = center + radius * b2Vec2(cosf(theta), sinf(theta));
-        glVertex2f(v.x, v.y);
-        theta += k_increment;
-    }
-    glEnd();
-    glDisable(GL_BLEND);
+    const ColorF fillColor( 0.5f * color.red, 0.5f * color.green, 0.5f * color.blue, 0.15f );
+    const ColorF lineColor( color.red, color.green, color.blue, 1.0f );
 
-    theta = 0.0f;
-    glColor4f(color.red, color.green, color.blue, 1.0f);
-    glBegin(GL_LINE_LOOP);
-    for (int32 i = 0; i < k_segments; ++i)
+    b2Vec2 v1 = center + b2Vec2(radius, 0.0f);
+    for (int32 i = 1; i <= k_segments; ++i)
     {
-        b2Vec2 v = center + radius * b2Vec2(cosf(theta), sinf(theta));
-        glVertex2f(v.x, v.y);
-        theta += k_increment;
+        const float32 theta = i == k_segments ? 0.0f : i * k_increment;
+        const b2Vec2 v2 = center + radius * b2Vec2(cosf(theta), sinf(theta));
+        submitTriangle( center, v1, v2, fillColor );
+        submitLine( v1, v2, lineColor );
+        v1 = v2;
     }
-    glEnd();
 
-    b2Vec2 p = center + radius * axis;
-    glBegin(GL_LINES);
-    glVertex2f(center.x, center.y);
-    glVertex2f(p.x, p.y);
-    glEnd();
+    submitLine( center, center + radius * axis, lineColor );
 }
     
 //-----------------------------------------------------------------------------
 
 void DebugDraw::DrawSegment( const b2Vec2& p1, const b2Vec2& p2, const ColorF& color )
 {
-    glColor3f(color.red, color.green, color.blue);
-    glBegin(GL_LINES);
-    glVertex2f(p1.x, p1.y);
-    glVertex2f(p2.x, p2.y);
-    glEnd();
+    submitLine( p1, p2, ColorF( color.red, color.green, color.blue, 1.0f ) );
 }
 
 //-----------------------------------------------------------------------------
 
 void DebugDraw::DrawTransform( const b2Transform& xf )
 {
-    b2Vec2 p1 = xf.p, p2;
+    const b2Vec2 p1 = xf.p;
     const float32 k_axisScale = 0.4f;
-    glBegin(GL_LINES);
-    
-    glColor3f(1.0f, 0.0f, 0.0f);
-    glVertex2f(p1.x, p1.y);
-    p2 = p1 + k_axisScale * xf.q.GetXAxis();
-    glVertex2f(p2.x, p2.y);
 
-    glColor3f(0.0f, 1.0f, 0.0f);
-    glVertex2f(p1.x, p1.y);
-    p2 = p1 + k_axisScale * xf.q.GetYAxis();
-    glVertex2f(p2.x, p2.y);
-
-    glEnd();
+    submitLine( p1, p1 + k_axisScale * xf.q.GetXAxis(), ColorF( 1.0f, 0.0f, 0.0f ) );
+    submitLine( p1, p1 + k_axisScale * xf.q.GetYAxis(), ColorF( 0.0f, 1.0f, 0.0f ) );
 }
 
 //-----------------------------------------------------------------------------
 
 void DebugDraw::DrawPoint( const b2Vec2& p, float32 size, const ColorF& color )
 {
-    glPointSize(size);
-    glBegin(GL_POINTS);
-    glColor3f(color.red, color.green, color.blue);
-    glVertex2f(p.x, p.y);
-    glEnd();
-    glPointSize(1.0f);
-}
+    // Find the point batch for this size.
+    PointBatch* pPointBatch = NULL;
+    for( Vector<PointBatch*>::iterator pointItr = mPointBatches.begin(); pointItr != mPointBatches.end(); ++pointItr )
+    {
+        if ( mIsEqual( (*pointItr)->mSize, size ) )
+        {
+            pPointBatch = *pointItr;
+            break;
+        }
+    }
 
+    // Create a point batch if one was not found.
+    if ( pPointBatch == NULL )
+    {
+        pPointBatch = new PointBatch();
+        pPointBatch->mSize = size;
+        mPointBatches.push_back( pPointBatch );
+    }
+
+    pPointBatch->mVertices.push_back( p );
+    pPointBatch->mColors.push_back( ColorF( color.red, color.green, color.blue, 1.0f ) );
+    mPointCount++;
+}
@@ -35,13 +35,32 @@
 #include "graphics/color.h"
 #endif
 
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class DebugDraw
 {
 public:
-    DebugDraw() {}
-    virtual ~DebugDraw() {}
+    DebugDraw();
+    virtual ~DebugDraw();
+
+    /// Culling.
+    inline void setCullArea( const b2AABB& cullAABB )           { mCullAABB = cullAABB; }
+    inline const b2AABB& getCullArea( void ) const              { return mCullAABB; }
+    inline void setCullOn( const U32 cullMask )                 { mCullMask |= cullMask; }
+    inline void setCullOff( const U32 cullMask )                { mCullMask &= ~cullMask; }
+    inline U32 getCullMask( void ) const                        { return mCullMask; }
+    inline bool getCulled( const U32 category, const b2AABB& aabb ) const { return (mCullMask & category) != 0 && !b2TestOverlap( aabb, mCullAABB ); }
+
+    /// Render any batched primitives.
+    void flush( void );
 
     void DrawAABB( const b2AABB& aabb, const ColorF& color );
     void DrawOOBB( const b2Vec2* pOOBB, const ColorF& color );
@@ -59,6 +78,42 @@ public:
     void DrawSegment( const b2Vec2& p1, const b2Vec2& p2, const ColorF& color);
     void DrawTransform(const b2Transform& xf);
     void DrawPoint(const b2Vec2& p, float32 size, const ColorF& color);
+
+private:
+    struct PointBatch
+    {
+        F32             mSize;
+        Vector<Vector2> mVertices;
+        Vector<ColorF>  mColors;
+    };
+
+    inline void submitLine( const b2Vec2& p1, const b2Vec2& p2, const ColorF& color )
+    {
+        mLineVertices.push_back( p1 );
+        mLineVertices.push_back( p2 );
+        mLineColors.push_back( color );
+        mLineColors.push_back( color );
+    }
+
+    inline void submitTriangle( const b2Vec2& p1, const b2Vec2& p2, const b2Vec2& p3, const ColorF& color )
+    {
+        mTriangleVertices.push_back( p1 );
+        mTriangleVertices.push_back( p2 );
+        mTriangleVertices.push_back( p3 );
+        mTriangleColors.push_back( color );
+        mTriangleColors.push_back( color );
+        mTriangleColors.push_back( color );
+    }
+
+    b2AABB              mCullAABB;
+    U32                 mCullMask;
+
+    Vector<Vector2>     mLineVertices;
+    Vector<ColorF>      mLineColors;
+    Vector<Vector2>     mTriangleVertices;
+    Vector<ColorF>      mTriangleColors;
+    Vector<PointBatch*> mPointBatches;
+    U32                 mPointCount;
 };
 
 #endif // _DEBUG_DRAW_H_
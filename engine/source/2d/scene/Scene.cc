@@ -56,12 +56,19 @@
 #include "2d/core/particleSystem.h"
 #endif
 
+#ifndef _CONSOLE_CALLBACK_H_
+#include "console/consoleCallback.h"
+#endif
+
 // Script bindings.
 #include "Scene_ScriptBinding.h"
 
 // Debug Profiling.
 #include "debug/profiler.h"
 
+// Memory tracking.
+#include "memory/memoryTracker.h"
+
 //------------------------------------------------------------------------------
 
 SimObjectPtr<Scene> Scene::LoadingScene = NULL;
@@ -74,6 +81,14 @@ static ContactFilter mContactFilter;
 static U32 sSceneCount = 0;
 static U32 sSceneMasterIndex = 0;
 
+// Script callbacks.
+static ConsoleCallback sOnSceneUpdateCallback( "onSceneUpdate" );
+static ConsoleCallback sOnSceneRenderCallback( "onSceneRender" );
+static ConsoleCallback sOnSceneCollisionCallback( "onSceneCollision" );
+static ConsoleCallback sOnSceneEndCollisionCallback( "onSceneEndCollision" );
+static ConsoleCallback sOnCollisionCallback( "onCollision" );
+static ConsoleCallback sOnEndCollisionCallback( "onEndCollision" );
+
 // Joint custom node names.
 static StringTableEntry jointCustomNodeName               = StringTable->insert( "Joints" );
 static StringTableEntry jointCollideConnectedName         = StringTable->insert( "CollideConnected" );
@@ -536,11 +551,10 @@ void Scene::dispatchBeginContactCallbacks( void )
         }
 
         // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneCollision" ) ) != NULL )
+        if ( sOnSceneCollisionCallback.isMethod( this ) )
         {
             // Yes, so perform script callback on the Scene.
-            Con::executef( this, 4, "onSceneCollision",
+            sOnSceneCollisionCallback.execute( this,
                 sceneObjectABuffer,
                 sceneObjectBBuffer,
                 miscInfoBuffer );
@@ -557,10 +571,10 @@ void Scene::dispatchBeginContactCallbacks( void )
                 (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
         {
             // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onCollision") )            
+            if ( sOnCollisionCallback.isMethod( pSceneObjectA ) )
             {
                 // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onCollision",
+                sOnCollisionCallback.execute( pSceneObjectA,
                     sceneObjectBBuffer,
                     miscInfoBuffer );
             }
@@ -577,10 +591,10 @@ void Scene::dispatchBeginContactCallbacks( void )
                 (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
         {
             // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onCollision") )            
+            if ( sOnCollisionCallback.isMethod( pSceneObjectB ) )
             {
                 // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onCollision",
+                sOnCollisionCallback.execute( pSceneObjectB,
                     sceneObjectABuffer,
                     miscInfoBuffer );
             }
@@ -648,11 +662,10 @@ void Scene::dispatchEndContactCallbacks( void )
         dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer), "%d %d", shapeIndexA, shapeIndexB );
 
         // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneEndCollision" ) ) != NULL )
+        if ( sOnSceneEndCollisionCallback.isMethod( this ) )
         {
             // Yes, so does the scene handle the collision callback?
-            Con::executef( this, 4, "onSceneEndCollision",
+            sOnSceneEndCollisionCallback.execute( this,
                 sceneObjectABuffer,
                 sceneObjectBBuffer,
                 miscInfoBuffer );
@@ -669,10 +682,10 @@ void Scene::dispatchEndContactCallbacks( void )
                 (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
         {
             // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onEndCollision") )            
+            if ( sOnEndCollisionCallback.isMethod( pSceneObjectA ) )
             {
                 // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onEndCollision",
+                sOnEndCollisionCallback.execute( pSceneObjectA,
                     sceneObjectBBuffer,
                     miscInfoBuffer );
             }
@@ -689,10 +702,10 @@ void Scene::dispatchEndContactCallbacks( void )
                 (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
         {
             // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onEndCollision") )            
+            if ( sOnEndCollisionCallback.isMethod( pSceneObjectB ) )
             {
                 // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onEndCollision",
+                sOnEndCollisionCallback.execute( pSceneObjectB,
                     sceneObjectABuffer,
                     miscInfoBuffer );
             }
@@ -712,6 +725,7 @@ void Scene::processTick( void )
 {
     // Debug Profiling.
     PROFILE_SCOPE(Scene_ProcessTick);
+    MEMORY_TAG_SCOPE(TagScene);
 
     // Finish if the Scene is not added to the simulation.
     if ( !isProperlyAdded() )
@@ -820,6 +834,9 @@ void Scene::processTick( void )
             // Yes, so fetch scene controller count.
             const S32 sceneControllerCount = (S32)pControllerSet->size();
 
+            // Begin gathering controlled bodies.
+            mControllerBuffer.beginTick();
+
             // Iterate scene controllers.
             for( S32 i = 0; i < sceneControllerCount; i++ )
             {
@@ -833,6 +850,9 @@ void Scene::processTick( void )
                 // Integrate.
                 pController->integrate( this, mSceneTime, Tickable::smTickSec, pDebugStats );
             }
+
+            // Write the controller results back to the bodies.
+            mControllerBuffer.endTick();
         }
 
         // Debug Profiling.
@@ -889,7 +909,7 @@ void Scene::processTick( void )
             // Debug Profiling.
             PROFILE_SCOPE(Scene_OnSceneUpdatetCallback);
 
-            Con::executef( this, 1, "onSceneUpdate" );
+            sOnSceneUpdateCallback.execute( this );
         }
 
         // Only dispatch contacts if a "normal" scene.
@@ -978,6 +998,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     b2AABB cameraAABB;
     CoreMath::mRotateAABB( pSceneRenderState->mRenderAABB, pSceneRenderState->mRenderAngle, cameraAABB );
 
+    // Set the debug draw cull area.
+    mDebugDraw.setCullArea( cameraAABB );
+
     // Rotate the world matrix by the camera angle.
     const Vector2& cameraPosition = pSceneRenderState->mRenderPosition;
     glTranslatef( cameraPosition.x, cameraPosition.y, 0.0f );
@@ -1205,6 +1228,10 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
                     // Render object overlay.
                     pSceneObject->sceneRenderOverlay( pSceneRenderState );
                 }
+
+                // Flush debug draw.
+                // NOTE:    We flush per layer so that overlays adhere to the strict layer render order.
+                mDebugDraw.flush();
             }
 
             // Reset render queue.
@@ -1246,6 +1273,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
 
             // Flush isolated batch.
             mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
+
+            // Flush debug draw.
+            mDebugDraw.flush();
         }
     }
 
@@ -1256,6 +1286,9 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
         PROFILE_SCOPE(Scene_RenderSceneJointOverlays);
 
         mDebugDraw.DrawJoints( mpWorld );
+
+        // Flush debug draw.
+        mDebugDraw.flush();
     }
 
     // Update debug stat ranges.
@@ -1268,7 +1301,7 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
         PROFILE_SCOPE(Scene_OnSceneRendertCallback);
 
         // Yes, so perform callback.
-        Con::executef( this, 1, "onSceneRender" );
+        sOnSceneRenderCallback.execute( this );
     }
 }
 
@@ -51,10 +51,18 @@
 #include "2d/scene/DebugDraw.h"
 #endif
 
+#ifndef _SCENE_CONTROLLER_BUFFER_H_
+#include "2d/controllers/core/SceneControllerBuffer.h"
+#endif
+
 #ifndef _HASHTABLE_H
 #include "collection/hashTable.h"
 #endif
 
+#ifndef _FLATHASHMAP_H_
+#include "collection/flatHashMap.h"
+#endif
+
 #ifndef _BATCH_RENDER_H_
 #include "2d/core/BatchRender.h"
 #endif
@@ -170,7 +178,7 @@ public:
     typedef HashMap<U32, S32>                   typeReverseJointHash;
     typedef Vector<tDeleteRequest>              typeDeleteVector;
     typedef Vector<TickContact>                 typeContactVector;
-    typedef HashMap<b2Contact*, TickContact>    typeContactHash;
+    typedef FlatHashMap<b2Contact*, TickContact> typeContactHash;
     typedef Vector<AssetPtr<AssetBase>*>        typeAssetPtrVector;
 
     /// Scene Debug Options.
@@ -213,6 +221,7 @@ private:
     /// World.
     b2World*                    mpWorld;
     WorldQuery*                 mpWorldQuery;
+    SceneControllerBuffer       mControllerBuffer;
     b2Vec2                      mWorldGravity;
     S32                         mVelocityIterations;
     S32                         mPositionIterations;
@@ -330,6 +339,7 @@ public:
     /// World.
     inline b2World*         getWorld( void ) const                      { return mpWorld; }
     inline WorldQuery*      getWorldQuery( const bool clearQuery = false ) { if ( clearQuery ) mpWorldQuery->clearQuery(); return mpWorldQuery; }
+    inline SceneControllerBuffer* getControllerBuffer( void )           { return &mControllerBuffer; }
     b2BlockAllocator*       getBlockAllocator( void )                   { return &mBlockAllocator; }
     inline b2Body*          getGroundBody( void ) const                 { return mpGroundBody; }
     virtual ePhysicsProxyType getPhysicsProxyType( void ) const         { return PhysicsProxy::PHYSIC_PROXY_GROUNDBODY; }
@@ -627,6 +637,9 @@ public:
     inline void             setDebugOn( const U32 debugMask )           { mDebugMask |= debugMask; }
     inline void             setDebugOff( const U32 debugMask )          { mDebugMask &= ~debugMask; }
     inline U32              getDebugMask( void ) const                  { return mDebugMask; }
+    inline void             setDebugCullOn( const U32 debugMask )       { mDebugDraw.setCullOn( debugMask ); }
+    inline void             setDebugCullOff( const U32 debugMask )      { mDebugDraw.setCullOff( debugMask ); }
+    inline U32              getDebugCullMask( void ) const              { return mDebugDraw.getCullMask(); }
     DebugStats&             getDebugStats( void )                       { return mDebugStats; }
     inline void             resetDebugStats( void )                     { mDebugStats.reset(); }
     void                    setDebugSceneObject( SceneObject* pSceneObject );
@@ -3234,6 +3234,88 @@ ConsoleMethod(Scene, getDebugOn, const char*, 2, 2, "() Gets the state of the de
 
 //-----------------------------------------------------------------------------
 
+static U32 getDebugCullMaskFromString( const char* pMethodName, const char* pDebugOptions )
+{
+    // Reset the mask.
+    U32 mask = 0;
+
+    // Grab the element count.
+    const U32 elementCount = Utility::mGetStringElementCount( pDebugOptions );
+
+    // Convert the string to a mask.
+    for (U32 i = 0; i < elementCount; i++)
+    {
+        // Fetch the debug option.
+        const char* pDebugOption = Utility::mGetStringElement( pDebugOptions, i );
+        Scene::DebugOption debugOption = Scene::getDebugOptionEnum( pDebugOption );
+    
+        // Is the option valid?
+        if ( debugOption == Scene::SCENE_DEBUG_INVALID )
+        {
+            // No, so warn.
+            Con::warnf( "Scene::%s() - Invalid debug option '%s' specified.", pMethodName, pDebugOption );
+            continue;
+        }
+     
+        // Merge into mask.
+        mask |= debugOption;
+    }
+
+    return mask;
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, setDebugCullOn, void, 3, 3,    "(debugOptions) Sets the debug option(s) whose rendering is culled to the camera view.\n"
+                                                    "Only the 'controllers', 'joints' and 'collision' options are culled as other options only render for visible objects.\n"
+                                                    "@param debugOptions A string with the debug modes (space-separated).\n"
+                                                    "@return No return value.")
+{
+    object->setDebugCullOn( getDebugCullMaskFromString( "setDebugCullOn", argv[2] ) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, setDebugCullOff, void, 3, 3,   "(debugOptions) Sets the debug option(s) whose rendering is not culled to the camera view.\n"
+                                                    "@param debugOptions A string with the debug modes (space-separated).\n"
+                                                    "@return No return value.")
+{
+    object->setDebugCullOff( getDebugCullMaskFromString( "setDebugCullOff", argv[2] ) );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(Scene, getDebugCullOn, const char*, 2, 2, "() Gets the debug options whose rendering is culled to the camera view.\n"
+                                                        "@return Returns a space separated list of debug modes that are culled.")
+{
+    // Fetch debug cull mask.
+    const U32 debugCullMask = object->getDebugCullMask();
+
+    // Fetch a return buffer.
+    S32 bufferSize = 1024;
+    char* pReturnBuffer = Con::getReturnBuffer(bufferSize);
+    *pReturnBuffer = 0;
+    char* pWriteCursor = pReturnBuffer;
+
+    // Iterate debug cull mask.
+    for( U32 bit = 0; bit < 32; ++bit )
+    {
+        // Calculate debug mask bit.
+        const S32 debugBit = 1 << bit;
+        if ( (debugCullMask & debugBit) == 0 )
+            continue;
+
+        // Format option.
+        const S32 size = dSprintf( pWriteCursor, bufferSize, "%s ", object->getDebugOptionDescription( (Scene::DebugOption)debugBit ) );
+        bufferSize -= size;
+        pWriteCursor += size;
+    }
+
+    return pReturnBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(Scene, setDebugSceneObject, void, 3, 3,   "(sceneObject) Sets the scene object to monitor in the debug metrics.\n"
                                                                 "@param SceneObject The scene object to monitor in the debug metrics.\n"
                                                                 "@return No return value.\n")
@@ -104,6 +104,10 @@ protected:
     static bool         writeBatchLayout( void* obj, StringTableEntry pFieldName )          { return static_cast<CompositeSprite*>(obj)->getBatchLayout() != CompositeSprite::NO_LAYOUT; }
     static bool         setBatchCulling(void* obj, const char* data)                        { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchCulling(dAtob(data)); return false; }
     static bool         writeBatchCulling( void* obj, StringTableEntry pFieldName )         { return !static_cast<CompositeSprite*>(obj)->getBatchCulling(); }
+    static bool         setBatchCache(void* obj, const char* data)                          { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchCache(dAtob(data)); return false; }
+    static bool         writeBatchCache( void* obj, StringTableEntry pFieldName )           { return static_cast<CompositeSprite*>(obj)->getBatchCache(); }
+    static bool         setBatchCacheRegionSize(void* obj, const char* data)                { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchCacheRegionSize(dAtof(data)); return false; }
+    static bool         writeBatchCacheRegionSize( void* obj, StringTableEntry pFieldName ) { return mNotEqual( static_cast<CompositeSprite*>(obj)->getBatchCacheRegionSize(), 16.0f ); }
 };
 
 #endif // _COMPOSITE_SPRITE_H_
@@ -129,6 +129,47 @@ ConsoleMethod(CompositeSprite, getBatchCulling, bool, 2, 2,    "() - Gets whethe
 
 //-----------------------------------------------------------------------------
 
+ConsoleMethod(CompositeSprite, setBatchCache, void, 3, 3,       "(bool batchCache) - Sets whether static sprites are cached as pre-built vertex arrays.\n"
+                                                                "Sprites that are not animated are grouped by region, texture and render state and rendered with a single draw each.\n"
+                                                                "The cache is rebuilt when a sprite is added, removed or its appearance changes so it suits sprites that rarely change such as tile layers.\n"
+                                                                "@return No return value." )
+{
+    // Fetch batch cache.
+    const bool batchCache = dAtob(argv[2]);
+
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchCache( batchCache );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(CompositeSprite, getBatchCache, bool, 2, 2,       "() - Gets whether static sprites are cached as pre-built vertex arrays or not.\n"
+                                                                "@return Whether static sprites are cached as pre-built vertex arrays or not." )
+{
+    return object->getBatchCache();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(CompositeSprite, setBatchCacheRegionSize, void, 3, 3,   "(float regionSize) - Sets the size of the local regions that static sprites are grouped into when cached.\n"
+                                                                      "Smaller regions cull more precisely but produce more draw calls.\n"
+                                                                      "@return No return value." )
+{
+    // Fetch region size.
+    const F32 regionSize = dAtof(argv[2]);
+
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchCacheRegionSize( regionSize );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(CompositeSprite, getBatchCacheRegionSize, F32, 2, 2,    "() - Gets the size of the local regions that static sprites are grouped into when cached.\n"
+                                                                      "@return The size of the local regions that static sprites are grouped into when cached." )
+{
+    return object->getBatchCacheRegionSize();
+}
+
+//-----------------------------------------------------------------------------
+
 ConsoleMethod(CompositeSprite, setBatchSortMode, void, 3, 3,    "(renderSortMode) - Sets the batch render sort mode.\n"
                                                                 "The render sort mode is used when isolated batch mode is on.\n"
                                                                 "@return No return value." )
@@ -68,6 +68,10 @@
 #include "string/stringUnit.h"
 #endif
 
+#ifndef _CONSOLE_CALLBACK_H_
+#include "console/consoleCallback.h"
+#endif
+
 // Script bindings.
 #include "SceneObject_ScriptBinding.h"
 
@@ -80,6 +84,11 @@
 static U32 sGlobalSceneObjectCount = 0;
 static U32 sSceneObjectMasterSerialId = 0;
 
+// Script callbacks.
+static ConsoleCallback sOnUpdateCallback( "onUpdate" );
+static ConsoleCallback sOnWakeCallback( "onWake" );
+static ConsoleCallback sOnSleepCallback( "onSleep" );
+
 // Collision shapes custom node names.
 static StringTableEntry shapeCustomNodeName     = StringTable->insert( "CollisionShapes" );
 
@@ -132,6 +141,8 @@ SceneObject::SceneObject() :
     /// Body.
     mpBody(NULL),
     mWorldQueryKey(0),
+    mControllerBufferKey(0),
+    mControllerBufferIndex(0),
 
     /// Collision control.
     mCollisionLayerMask(MASK_ALL),
@@ -630,7 +641,7 @@ void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, Debu
     if ( mUpdateCallback )
     {
         PROFILE_SCOPE(SceneObject_onUpdateCallback);
-        Con::executef(this, 1, "onUpdate");
+        sOnUpdateCallback.execute( this );
     }
 
     // Are we using the sleeping callback?
@@ -649,9 +660,9 @@ void SceneObject::postIntegrate(const F32 totalTime, const F32 elapsedTime, Debu
 
             // Perform the appropriate callback.
             if ( currentAwakeState )
-                Con::executef(this, 1, "onWake");
+                sOnWakeCallback.execute( this );
             else
-                Con::executef(this, 1, "onSleep");
+                sOnSleepCallback.execute( this );
         }
     }
 }
@@ -4470,3 +4481,4 @@ static void WriteCustomTamlSchema( const AbstractClassRep* pClassRep, TiXmlEleme
 //-----------------------------------------------------------------------------
 
 IMPLEMENT_CONOBJECT_SCHEMA(SceneObject, WriteCustomTamlSchema);
+IMPLEMENT_CLASS_POOL(SceneObject);
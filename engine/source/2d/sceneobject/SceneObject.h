@@ -67,6 +67,10 @@
 #include "component/behaviors/behaviorInstance.h"
 #endif
 
+#ifndef _CLASS_POOL_H_
+#include "memory/classPool.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 struct tDestroyNotification
@@ -156,6 +160,8 @@ protected:
     b2Body*                 mpBody;
     b2BodyDef               mBodyDefinition;
     U32                     mWorldQueryKey;
+    U32                     mControllerBufferKey;
+    U32                     mControllerBufferIndex;
 
     /// Collision control.
     U32                     mCollisionLayerMask;
@@ -558,6 +564,9 @@ public:
     inline bool             getIsAlwaysInScope(void) const              { return mAlwaysInScope; }
     inline void             setWorldQueryKey( const U32 key )           { mWorldQueryKey = key; }
     inline U32              getWorldQueryKey( void ) const              { return mWorldQueryKey; }
+    inline void             setControllerBufferKey( const U32 key, const U32 index ) { mControllerBufferKey = key; mControllerBufferIndex = index; }
+    inline U32              getControllerBufferKey( void ) const        { return mControllerBufferKey; }
+    inline U32              getControllerBufferIndex( void ) const      { return mControllerBufferIndex; }
     static U32              getGlobalSceneObjectCount( void );
     inline U32              getSerialId( void ) const                   { return mSerialId; }
 
@@ -576,6 +585,9 @@ public:
     /// Declare Console Object.
     DECLARE_CONOBJECT( SceneObject );
 
+    /// Pool the instances.
+    DECLARE_CLASS_POOL( SceneObject );
+
 protected:
     S32                     copyCircleCollisionShapeTo( SceneObject* pSceneObject, const b2FixtureDef& fixtureDef ) const;
     S32                     copyPolygonCollisionShapeTo( SceneObject* pSceneObject, const b2FixtureDef& fixtureDef ) const;
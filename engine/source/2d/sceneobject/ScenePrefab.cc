@@ -0,0 +1,161 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_PREFAB_H_
+#include "ScenePrefab.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+// Script bindings.
+#include "ScenePrefab_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT(ScenePrefab);
+
+//-----------------------------------------------------------------------------
+
+ScenePrefab::ScenePrefab()
+{
+}
+
+//-----------------------------------------------------------------------------
+
+ScenePrefab::~ScenePrefab()
+{
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePrefab::onRemove()
+{
+    // Clear the template.
+    clearTemplate();
+
+    // Call parent.
+    Parent::onRemove();
+}
+
+//-----------------------------------------------------------------------------
+
+bool ScenePrefab::setTemplate( SceneObject* pSceneObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePrefab_SetTemplate);
+
+    // Clear any existing template.
+    clearTemplate();
+
+    // Finish if no template.
+    if ( pSceneObject == NULL )
+        return true;
+
+    // Snapshot the object so later changes to it do not affect the prefab.
+    SceneObject* pTemplate = dynamic_cast<SceneObject*>( pSceneObject->clone( true ) );
+    if ( pTemplate == NULL )
+    {
+        // Warn.
+        Con::warnf( "ScenePrefab::setTemplate() - Could not snapshot the template object '%s'.", pSceneObject->getIdString() );
+        return false;
+    }
+
+    mTemplate = pTemplate;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+SceneObject* ScenePrefab::spawn( Scene* pScene, const Vector2* pPosition )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePrefab_Spawn);
+
+    // Finish if no template.
+    if ( mTemplate.isNull() )
+    {
+        // Warn.
+        Con::warnf( "ScenePrefab::spawn() - Cannot spawn an instance as no template is set." );
+        return NULL;
+    }
+
+    // Clone the template.
+    SceneObject* pInstance = dynamic_cast<SceneObject*>( mTemplate->clone( true ) );
+    if ( pInstance == NULL )
+    {
+        // Warn.
+        Con::warnf( "ScenePrefab::spawn() - Unable to clone the template." );
+        return NULL;
+    }
+
+    // Set the position if specified.
+    if ( pPosition != NULL )
+        pInstance->setPosition( *pPosition );
+
+    // Add to the scene if specified.
+    if ( pScene != NULL )
+        pScene->addToScene( pInstance );
+
+    return pInstance;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ScenePrefab::spawn( Scene* pScene, const U32 count, const Vector2* pPositions, SimSet* pInstanceSet )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ScenePrefab_SpawnCount);
+
+    U32 spawnCount = 0;
+
+    // Spawn the instances.
+    for ( U32 index = 0; index < count; ++index )
+    {
+        SceneObject* pInstance = spawn( pScene, pPositions != NULL ? pPositions + index : NULL );
+
+        // Stop if the instance could not be spawned.
+        if ( pInstance == NULL )
+            break;
+
+        // Add to the instance set if specified.
+        if ( pInstanceSet != NULL )
+            pInstanceSet->addObject( pInstance );
+
+        spawnCount++;
+    }
+
+    return spawnCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void ScenePrefab::clearTemplate( void )
+{
+    // Delete the template.
+    if ( mTemplate.notNull() )
+        mTemplate->deleteObject();
+
+    mTemplate = NULL;
+}
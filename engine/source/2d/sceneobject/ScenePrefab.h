@@ -0,0 +1,71 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_PREFAB_H_
+#define _SCENE_PREFAB_H_
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class Scene;
+
+//-----------------------------------------------------------------------------
+
+/// A prefab stamps out instances of a template scene object.
+///
+/// The template is snapshotted once when it is set so later changes to the source object do not
+/// affect the instances.  Each instance is a clone of the snapshot (see SimObject::clone()) so its
+/// fields are copied natively rather than parsed from strings as script construction or Taml
+/// reads would.
+class ScenePrefab : public SimObject
+{
+    typedef SimObject Parent;
+
+private:
+    SimObjectPtr<SceneObject>   mTemplate;
+
+public:
+    ScenePrefab();
+    virtual ~ScenePrefab();
+
+    /// SimObject overrides.
+    virtual void onRemove();
+
+    /// Template.
+    bool setTemplate( SceneObject* pSceneObject );
+    inline SceneObject* getTemplate( void ) const { return mTemplate; }
+
+    /// Spawning.
+    SceneObject* spawn( Scene* pScene, const Vector2* pPosition = NULL );
+    U32 spawn( Scene* pScene, const U32 count, const Vector2* pPositions = NULL, SimSet* pInstanceSet = NULL );
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( ScenePrefab );
+
+private:
+    void clearTemplate( void );
+};
+
+#endif // _SCENE_PREFAB_H_
@@ -0,0 +1,134 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePrefab, setTemplate, bool, 3, 3,  "(sceneObject) Sets the template the prefab spawns instances of.\n"
+                                                    "The object is snapshotted so later changes to it do not affect the prefab.\n"
+                                                    "@param sceneObject The SceneObject to use as the template.\n"
+                                                    "@return Whether the template was set or not.")
+{
+    // Find the specified object.
+    SceneObject* pSceneObject = dynamic_cast<SceneObject*>(Sim::findObject(argv[2]));
+
+    // Did we find the object?
+    if ( !pSceneObject )
+    {
+        // No, so warn.
+        Con::warnf("ScenePrefab::setTemplate() - Could not find the specified object '%s'.", argv[2]);
+        return false;
+    }
+
+    return object->setTemplate( pSceneObject );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePrefab, getTemplate, S32, 2, 2,   "() Gets the template the prefab spawns instances of.\n"
+                                                    "@return The template SceneObject or 0 if no template is set.")
+{
+    // Fetch template.
+    SceneObject* pTemplate = object->getTemplate();
+
+    return pTemplate == NULL ? 0 : pTemplate->getId();
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePrefab, spawn, S32, 4, 5, "(scene, count, [instanceSet]) Spawns instances of the template.\n"
+                                            "@param scene The Scene to add the instances to.\n"
+                                            "@param count The number of instances to spawn.\n"
+                                            "@param instanceSet An optional SimSet to add the instances to.\n"
+                                            "@return The number of instances spawned.")
+{
+    // Find the scene.
+    Scene* pScene = dynamic_cast<Scene*>(Sim::findObject(argv[2]));
+
+    // Did we find the scene?
+    if ( !pScene )
+    {
+        // No, so warn.
+        Con::warnf("ScenePrefab::spawn() - Could not find the specified scene '%s'.", argv[2]);
+        return 0;
+    }
+
+    // Find any instance set.
+    SimSet* pInstanceSet = NULL;
+    if ( argc > 4 )
+    {
+        pInstanceSet = dynamic_cast<SimSet*>(Sim::findObject(argv[4]));
+
+        // Did we find the instance set?
+        if ( !pInstanceSet )
+        {
+            // No, so warn.
+            Con::warnf("ScenePrefab::spawn() - Could not find the specified instance set '%s'.", argv[4]);
+            return 0;
+        }
+    }
+
+    return (S32)object->spawn( pScene, (U32)getMax( 0, dAtoi(argv[3]) ), NULL, pInstanceSet );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleMethod(ScenePrefab, spawnAt, S32, 4, 5,   "(scene, float x, float y) Spawns an instance of the template at the specified position.\n"
+                                                "@param scene The Scene to add the instance to.\n"
+                                                "@param x The position of the instance along the horizontal axis.\n"
+                                                "@param y The position of the instance along the vertical axis.\n"
+                                                "@return The instance SceneObject or 0 if it could not be spawned.")
+{
+    // Find the scene.
+    Scene* pScene = dynamic_cast<Scene*>(Sim::findObject(argv[2]));
+
+    // Did we find the scene?
+    if ( !pScene )
+    {
+        // No, so warn.
+        Con::warnf("ScenePrefab::spawnAt() - Could not find the specified scene '%s'.", argv[2]);
+        return 0;
+    }
+
+    // The position.
+    Vector2 position;
+
+    // Elements in the first argument.
+    const U32 elementCount = Utility::mGetStringElementCount(argv[3]);
+
+    // ("x y")
+    if ((elementCount == 2) && (argc == 4))
+        position = Utility::mGetStringElementVector(argv[3]);
+
+    // (x, y)
+    else if ((elementCount == 1) && (argc == 5))
+        position.Set(dAtof(argv[3]), dAtof(argv[4]));
+
+    // Invalid
+    else
+    {
+        Con::warnf("ScenePrefab::spawnAt() - Invalid number of parameters!");
+        return 0;
+    }
+
+    // Spawn the instance.
+    SceneObject* pInstance = object->spawn( pScene, &position );
+
+    return pInstance == NULL ? 0 : pInstance->getId();
+}
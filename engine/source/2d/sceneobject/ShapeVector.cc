@@ -160,147 +160,67 @@ void ShapeVector::sceneRender( const SceneRenderState* pSceneRenderState, const
 
 void ShapeVector::renderCircleShape(Vector2 position, F32 radius)
 {
-    if (mFillMode)
+    // Fetch the segment count.
+    const U32 k_segments = mFillMode ? 32 : 36;
+    const float32 k_increment = 2.0f * b2_pi / k_segments;
+
+    // Calculate the circle vertices.
+    Vector2 vertices[36];
+    for (U32 i = 0; i < k_segments; ++i)
     {
-        const float32 k_segments = 32.0f;
-        const float32 k_increment = 2.0f * b2_pi / k_segments;
-        float32 theta = 0.0f;
+        const float32 theta = i * k_increment;
+        vertices[i] = position + radius * Vector2(cosf(theta), sinf(theta));
+    }
 
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glVertexPointer( 2, GL_FLOAT, sizeof(Vector2), vertices );
+
+    if (mFillMode)
+    {
         glEnable(GL_BLEND);
         glBlendFunc (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
         glColor4f(mFillColor.red, mFillColor.green, mFillColor.blue, mFillColor.alpha);
-
-        glBegin(GL_TRIANGLE_FAN);
-        for (int32 i = 0; i < k_segments; ++i)
-        {
-            Vector2 v = position + radius * Vector2(cosf(theta), sinf(theta));
-            glVertex2f(v.x, v.y);
-            theta += k_increment;
-        }
-        glEnd();
-
+        glDrawArrays( GL_TRIANGLE_FAN, 0, k_segments );
         glDisable(GL_BLEND);
 
-        theta = 0.0f;
         glColor4f(mLineColor.red, mLineColor.green, mLineColor.blue, 1.0f);
-        glBegin(GL_LINE_LOOP);
-        for (int32 i = 0; i < k_segments; ++i)
-        {
-            Vector2 v = position + radius * Vector2(cosf(theta), sinf(theta));
-            glVertex2f(v.x, v.y);
-            theta += k_increment;
-        }
-        glEnd();
     }
     else
     {
-        const float32 k_segments = 36.0f;
-        const float32 k_increment = 2.0f * b2_pi / k_segments;
-        float32 theta = 0.0f;
-
         glColor4f(mLineColor.red, mLineColor.green, mLineColor.blue, mLineColor.alpha);
-        
-        glBegin(GL_LINE_LOOP);
-        for (int32 i = 0; i < k_segments; ++i)
-        {
-            Vector2 v = position + radius * Vector2(cosf(theta), sinf(theta));
-            glVertex2f(v.x, v.y);
-            theta += k_increment;
-        }
-        glEnd();
     }
+
+    glDrawArrays( GL_LINE_LOOP, 0, k_segments );
+    glDisableClientState( GL_VERTEX_ARRAY );
 }
 
 void ShapeVector::renderPolygonShape(U32 vertexCount)
 {
-#ifdef TORQUE_OS_IOS
-    // Fill Mode?
-    if ( mFillMode )
-    {
-        // Yes, so set polygon mode to FILL.
-        //glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
-
-        // Set Fill color.
-        glColor4f( (GLfloat)mFillColor.red, (GLfloat)mFillColor.green, (GLfloat)mFillColor.blue, (GLfloat)mFillColor.alpha );
-
-        GLfloat vert1[] = {//get first vert and make triangles based off of this one
-            (GLfloat)(mPolygonLocalList[0].x),
-            (GLfloat)(mPolygonLocalList[0].y),
-        };
-        GLfloat prevVert[] = {
-            (GLfloat)(mPolygonLocalList[1].x),
-            (GLfloat)(mPolygonLocalList[1].y),
-        };
-        
-        
-        // Draw Object.
-            for ( U32 n = 2; n < vertexCount; n++ )
-            {
-                //glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n]) );
-                GLfloat vertex[] = {
-                                    vert1[0], vert1[1],
-                                    (GLfloat)(mPolygonLocalList[n].x), (GLfloat)(mPolygonLocalList[n].y),
-                                    prevVert[0], prevVert[1],
-                };
-                
-                glVertexPointer(2, GL_FLOAT, 0, vertex );
-                glDrawArrays(GL_TRIANGLES, 0, 3 );
-                prevVert[0] = (GLfloat)(mPolygonLocalList[n].x);//save the current one's for nxt time
-                prevVert[1] = (GLfloat)(mPolygonLocalList[n].y);
-            }
-        //glDrawArrays(GL_TRIANGLES, 0, vertexCount);
-        //glEnd();
- 
-    }
-
-    // Set Line color.
-    glColor4f(mLineColor.red, mLineColor.green, mLineColor.blue, mLineColor.alpha );
-    
-        for ( U32 n = 1; n <= vertexCount; n++ )
-        {
-            GLfloat verts[] = {
-                (GLfloat)(mPolygonLocalList[n - 1].x),
-                (GLfloat)(mPolygonLocalList[n - 1].y),
-                (GLfloat)(mPolygonLocalList[n == vertexCount ? 0 : n].x),
-                (GLfloat)(mPolygonLocalList[n == vertexCount ? 0 : n].y),
-            };
-
-            glVertexPointer(2, GL_FLOAT, 0, verts );			
-            glDrawArrays(GL_LINE_LOOP, 0, 2);//draw last two
-        }
+    glEnableClientState( GL_VERTEX_ARRAY );
+    glVertexPointer( 2, GL_FLOAT, sizeof(Vector2), mPolygonLocalList.address() );
 
-#else
     // Fill Mode?
     if ( mFillMode )
     {
+#ifndef TORQUE_OS_IOS
         // Yes, so set polygon mode to FILL.
         glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+#endif
 
         // Set Fill color.
-        glColor4fv( (GLfloat*)&mFillColor );
+        glColor4f( mFillColor.red, mFillColor.green, mFillColor.blue, mFillColor.alpha );
 
         // Draw Object.
-        glBegin( GL_POLYGON );
-            for ( U32 n = 0; n < vertexCount; n++ )
-            {
-                glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n]) );
-            }
-        glEnd();
+        glDrawArrays( GL_TRIANGLE_FAN, 0, vertexCount );
     }
 
     // Set Line color.
-    glColor4fv( (GLfloat*)&mLineColor );
+    glColor4f( mLineColor.red, mLineColor.green, mLineColor.blue, mLineColor.alpha );
 
     // Draw Object.
-    glBegin(GL_LINES);
-        for ( U32 n = 1; n <= vertexCount; n++ )
-        {
-            glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n - 1]) );
-            glVertex2fv ( (GLfloat*)&(mPolygonLocalList[n == vertexCount ? 0 : n]) );
-        }
-    glEnd();
+    glDrawArrays( GL_LINE_LOOP, 0, vertexCount );
 
-#endif
+    glDisableClientState( GL_VERTEX_ARRAY );
 }
 
 //----------------------------------------------------------------------------
@@ -38,6 +38,7 @@
 //------------------------------------------------------------------------------
 
 IMPLEMENT_CONOBJECT(Sprite);
+IMPLEMENT_CLASS_POOL(Sprite);
 
 //------------------------------------------------------------------------------
 
@@ -27,6 +27,10 @@
 #include "2d/core/SpriteBase.h"
 #endif
 
+#ifndef _CLASS_POOL_H_
+#include "memory/classPool.h"
+#endif
+
 //------------------------------------------------------------------------------
 
 class Sprite : public SpriteBase
@@ -57,6 +61,9 @@ public:
     /// Declare Console Object.
     DECLARE_CONOBJECT( Sprite );
 
+    /// Pool the instances.
+    DECLARE_CLASS_POOL( Sprite );
+
 protected:
     static bool writeFlipX( void* obj, StringTableEntry pFieldName )        { return static_cast<Sprite*>(obj)->getFlipX() == true; }
     static bool writeFlipY( void* obj, StringTableEntry pFieldName )        { return static_cast<Sprite*>(obj)->getFlipY() == true; }
@@ -95,6 +95,9 @@ bool AssetManager::onAdd()
 
 void AssetManager::onRemove()
 {
+    // Stop scanning declared assets.
+    mDeclaredAssetsPrefetch.clear();
+
     // Do we have an asset tags manifest?
     if ( !mAssetTagsManifest.isNull() )
     {
@@ -2319,12 +2322,16 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
     char pathBuffer[1024];
     Con::expandPath( pathBuffer, sizeof(pathBuffer), pPath );
 
+    // Fetch any location scanned ahead of the module loading.
+    DeclaredAssetsPrefetch::Location* pPrefetched = mDeclaredAssetsPrefetch.acquire( pathBuffer, pExtension, recurse );
+
     // Find files.
     Vector<Platform::FileInfo> files;
-    if ( !Platform::dumpPath( pathBuffer, files, recurse ? -1 : 0 ) )
+    if ( pPrefetched != NULL ? !pPrefetched->mPathScanned : !Platform::dumpPath( pathBuffer, files, recurse ? -1 : 0 ) )
     {
         // Failed so warn.
         Con::warnf( "Asset Manager: Failed to scan declared assets in directory '%s'.", pathBuffer );
+        delete pPrefetched;
         return false;
     }
 
@@ -2335,6 +2342,7 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         Con::warnf( "Asset Manager: Could not add declared asset file '%s' as file does not exist with module path '%s'",
             pathBuffer,
             pModuleDefinition->getModulePath() );
+        delete pPrefetched;
         return false;
     }
 
@@ -2345,43 +2353,68 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         Con::printf( "Asset Manager: Scanning for declared assets in path '%s' for files with extension '%s'...", pathBuffer, pExtension );
     }
 
-    // Fetch extension length.
-    const U32 extensionLength = dStrlen( pExtension );
+    // Fetch the asset files.
+    Vector<StringTableEntry> assetFiles;
+    if ( pPrefetched != NULL )
+    {
+        // Use the prefetched asset files.
+        assetFiles = pPrefetched->mAssetFiles;
+    }
+    else
+    {
+        // Fetch extension length.
+        const U32 extensionLength = dStrlen( pExtension );
 
-    // Fetch module assets.
-    ModuleDefinition::typeModuleAssetsVector& moduleAssets = pModuleDefinition->getModuleAssets();
+        // Iterate files.
+        for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
+        {
+            // Fetch file info.
+            Platform::FileInfo& fileInfo = *fileItr;
 
-    TamlAssetDeclaredVisitor assetDeclaredVisitor;
+            // Fetch filename.
+            const char* pFilename = fileInfo.pFileName;
 
-    // Iterate files.
-    for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
-    {
-        // Fetch file info.
-        Platform::FileInfo& fileInfo = *fileItr;
+            // Find filename length.
+            const U32 filenameLength = dStrlen( pFilename );
 
-        // Fetch filename.
-        const char* pFilename = fileInfo.pFileName;
+            // Skip if extension is longer than filename.
+            if ( extensionLength > filenameLength )
+                continue;
 
-        // Find filename length.
-        const U32 filenameLength = dStrlen( pFilename );
+            // Skip if extension not found.
+            if ( dStricmp( pFilename + filenameLength - extensionLength, pExtension ) != 0 )
+                continue;
 
-        // Skip if extension is longer than filename.
-        if ( extensionLength > filenameLength )
-            continue;
+            // Format full file-path.
+            char assetFileBuffer[1024];
+            dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName );
 
-        // Skip if extension not found.
-        if ( dStricmp( pFilename + filenameLength - extensionLength, pExtension ) != 0 )
-            continue;
+            // Store asset file.
+            assetFiles.push_back( StringTable->insert( assetFileBuffer ) );
+        }
+    }
+
+    // Fetch module assets.
+    ModuleDefinition::typeModuleAssetsVector& moduleAssets = pModuleDefinition->getModuleAssets();
+
+    TamlAssetDeclaredVisitor assetDeclaredVisitor;
+
+    // Iterate asset files.
+    for ( U32 assetFileIndex = 0; assetFileIndex < (U32)assetFiles.size(); ++assetFileIndex )
+    {
+        // Fetch asset file.
+        const char* assetFileBuffer = assetFiles[assetFileIndex];
 
         // Clear declared assets.
         assetDeclaredVisitor.clear();
 
-        // Format full file-path.
-        char assetFileBuffer[1024];
-        dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName );
+        // Parse the prefetched document or else the filename.
+        const bool parsed = pPrefetched != NULL ?
+            pPrefetched->mDocuments[assetFileIndex] != NULL && assetDeclaredVisitor.parse( assetFileBuffer, *pPrefetched->mDocuments[assetFileIndex] ) :
+            assetDeclaredVisitor.parse( assetFileBuffer );
 
-        // Parse the filename.
-        if ( !assetDeclaredVisitor.parse( assetFileBuffer ) )
+        // Did we parse the file?
+        if ( !parsed )
         {
             // Warn.
             Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFileBuffer );
@@ -2505,6 +2538,9 @@ bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension
         Con::printBlankLine();
     }
 
+    // Release any prefetched location.
+    delete pPrefetched;
+
     return true;
 }
 
@@ -2962,6 +2998,47 @@ void AssetManager::unloadAsset( AssetDefinition* pAssetDefinition )
 
 //-----------------------------------------------------------------------------
 
+void AssetManager::onModulePrefetch( ModuleDefinition* pModuleDefinition )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_OnModulePrefetch);
+
+    // Iterate the module definition children.
+    for( SimSet::iterator itr = pModuleDefinition->begin(); itr != pModuleDefinition->end(); ++itr )
+    {
+        // Fetch the declared assets.
+        DeclaredAssets* pDeclaredAssets = dynamic_cast<DeclaredAssets*>( *itr );
+
+        // Skip if it's not a declared assets location.
+        if ( pDeclaredAssets == NULL )
+            continue;
+
+        // Format asset manifest location.
+        char filePathBuffer[1024];
+        dSprintf( filePathBuffer, sizeof(filePathBuffer), "%s/%s", pModuleDefinition->getModulePath(), pDeclaredAssets->getPath() );
+
+        // Expand the location here as path expandos are not available to the workers.
+        char pathBuffer[1024];
+        Con::expandPath( pathBuffer, sizeof(pathBuffer), filePathBuffer );
+
+        // Queue the location.
+        mDeclaredAssetsPrefetch.queue( pModuleDefinition->getModuleId(), pathBuffer, pDeclaredAssets->getExtension(), pDeclaredAssets->getRecurse() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::onModulePrefetchCancel( ModuleDefinition* pModuleDefinition )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_OnModulePrefetchCancel);
+
+    // Discard the prefetched locations.
+    mDeclaredAssetsPrefetch.discard( pModuleDefinition->getModuleId() );
+}
+
+//-----------------------------------------------------------------------------
+
 void AssetManager::onModulePreLoad( ModuleDefinition* pModuleDefinition )
 {
     // Debug Profiling.
@@ -2970,6 +3047,9 @@ void AssetManager::onModulePreLoad( ModuleDefinition* pModuleDefinition )
     // Add module declared assets.
     addModuleDeclaredAssets( pModuleDefinition );
 
+    // Discard any prefetched locations the module did not scan.
+    mDeclaredAssetsPrefetch.discard( pModuleDefinition->getModuleId() );
+
     // Is an asset tags manifest specified?
     if ( pModuleDefinition->getAssetTagsManifest() != StringTable->EmptyString )
     {
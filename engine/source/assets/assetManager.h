@@ -59,6 +59,10 @@
 #include "assets/assetFieldTypes.h"
 #endif
 
+#ifndef _DECLARED_ASSETS_PREFETCH_H_
+#include "assets/declaredAssetsPrefetch.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -99,6 +103,9 @@ private:
     /// Asset pointer refresh notifications.
     typeAssetPtrRefreshHash             mAssetPtrRefreshNotifications;
 
+    /// Declared assets being scanned ahead of their module loading.
+    DeclaredAssetsPrefetch              mDeclaredAssetsPrefetch;
+
     /// Miscellaneous.
     bool                                mEchoInfo;
     bool                                mIgnoreAutoUnload;
@@ -383,6 +390,8 @@ private:
     void unloadAsset( AssetDefinition* pAssetDefinition );
 
     /// Module callbacks.
+    virtual void onModulePrefetch( ModuleDefinition* pModuleDefinition );
+    virtual void onModulePrefetchCancel( ModuleDefinition* pModuleDefinition );
     virtual void onModulePreLoad( ModuleDefinition* pModuleDefinition );
     virtual void onModulePreUnload( ModuleDefinition* pModuleDefinition );
     virtual void onModulePostUnload( ModuleDefinition* pModuleDefinition );
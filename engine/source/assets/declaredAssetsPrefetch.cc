@@ -0,0 +1,333 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _DECLARED_ASSETS_PREFETCH_H_
+#include "assets/declaredAssetsPrefetch.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef TINYXML_INCLUDED
+#include "persistence/tinyXML/tinyxml.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Maximum number of worker threads scanning locations concurrently.
+static const U32 gMaxPrefetchWorkers = 4;
+
+//-----------------------------------------------------------------------------
+
+DeclaredAssetsPrefetch::Location::~Location()
+{
+    // Delete the documents.
+    for ( Vector<TiXmlDocument*>::iterator documentItr = mDocuments.begin(); documentItr != mDocuments.end(); ++documentItr )
+    {
+        delete *documentItr;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+DeclaredAssetsPrefetch::DeclaredAssetsPrefetch() :
+    mActiveWorkers( 0 )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+DeclaredAssetsPrefetch::~DeclaredAssetsPrefetch()
+{
+    clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void DeclaredAssetsPrefetch::queue( const char* pOwner, const char* pPath, const char* pExtension, const bool recurse )
+{
+    // Sanity!
+    AssertFatal( pOwner != NULL, "Cannot queue declared assets with NULL owner." );
+    AssertFatal( pPath != NULL, "Cannot queue declared assets with NULL path." );
+    AssertFatal( pExtension != NULL, "Cannot queue declared assets with NULL extension." );
+
+    // Create location.
+    Location* pLocation = new Location();
+    pLocation->mOwner = StringTable->insert( pOwner );
+    pLocation->mPath = StringTable->insert( pPath );
+    pLocation->mExtension = StringTable->insert( pExtension );
+    pLocation->mRecurse = recurse;
+
+    MutexHandle mutex;
+    mutex.lock( &mMutex, true );
+
+    // Queue location.
+    mLocations.push_back( pLocation );
+    mPending.push_back( pLocation );
+
+    // Finish if there are enough workers for the pending locations.
+    if ( mActiveWorkers >= gMaxPrefetchWorkers || mActiveWorkers >= (U32)mPending.size() )
+        return;
+
+    // Reap any finished workers.
+    reapWorkers();
+
+    // Start a worker.
+    mActiveWorkers++;
+    mWorkers.push_back( new Thread( processWorker, this, true, false ) );
+}
+
+//-----------------------------------------------------------------------------
+
+DeclaredAssetsPrefetch::Location* DeclaredAssetsPrefetch::acquire( const char* pPath, const char* pExtension, const bool recurse )
+{
+    // Fetch location key.
+    StringTableEntry path = StringTable->insert( pPath );
+    StringTableEntry extension = StringTable->insert( pExtension );
+
+    Location* pLocation = NULL;
+    bool pending = false;
+
+    {
+        MutexHandle mutex;
+        mutex.lock( &mMutex, true );
+
+        // Find the location.
+        for ( Vector<Location*>::iterator locationItr = mLocations.begin(); locationItr != mLocations.end(); ++locationItr )
+        {
+            if ( (*locationItr)->mPath != path || (*locationItr)->mExtension != extension || (*locationItr)->mRecurse != recurse )
+                continue;
+
+            pLocation = *locationItr;
+            mLocations.erase( locationItr );
+            break;
+        }
+
+        // Finish if the location was not queued.
+        if ( pLocation == NULL )
+            return NULL;
+
+        // Remove the location if no worker has started it yet.
+        for ( Vector<Location*>::iterator pendingItr = mPending.begin(); pendingItr != mPending.end(); ++pendingItr )
+        {
+            if ( *pendingItr != pLocation )
+                continue;
+
+            mPending.erase( pendingItr );
+            pending = true;
+            break;
+        }
+    }
+
+    // Process the location here if no worker has started it otherwise wait for the worker.
+    if ( pending )
+        processLocation( pLocation );
+    else
+        pLocation->mComplete.acquire();
+
+    return pLocation;
+}
+
+//-----------------------------------------------------------------------------
+
+void DeclaredAssetsPrefetch::discard( const char* pOwner )
+{
+    // Fetch owner.
+    StringTableEntry owner = StringTable->insert( pOwner );
+
+    Vector<Location*> started;
+
+    {
+        MutexHandle mutex;
+        mutex.lock( &mMutex, true );
+
+        for ( S32 index = 0; index < mLocations.size(); )
+        {
+            // Skip locations queued by other owners.
+            Location* pLocation = mLocations[index];
+            if ( pLocation->mOwner != owner )
+            {
+                index++;
+                continue;
+            }
+
+            // Remove the location keeping the queue order.
+            mLocations.erase( index );
+
+            // Delete the location if no worker has started it yet.
+            bool pending = false;
+            for ( Vector<Location*>::iterator pendingItr = mPending.begin(); pendingItr != mPending.end(); ++pendingItr )
+            {
+                if ( *pendingItr != pLocation )
+                    continue;
+
+                mPending.erase( pendingItr );
+                pending = true;
+                break;
+            }
+
+            if ( pending )
+                delete pLocation;
+            else
+                started.push_back( pLocation );
+        }
+    }
+
+    // Wait for the workers processing the remaining locations before deleting them.
+    for ( Vector<Location*>::iterator locationItr = started.begin(); locationItr != started.end(); ++locationItr )
+    {
+        (*locationItr)->mComplete.acquire();
+        delete *locationItr;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void DeclaredAssetsPrefetch::clear( void )
+{
+    // Discard pending locations so the workers finish.
+    mMutex.lock();
+    mPending.clear();
+    mMutex.unlock();
+
+    // Wait for the workers.
+    for ( Vector<Thread*>::iterator workerItr = mWorkers.begin(); workerItr != mWorkers.end(); ++workerItr )
+    {
+        (*workerItr)->join();
+        delete *workerItr;
+    }
+    mWorkers.clear();
+
+    // Delete the locations.
+    for ( Vector<Location*>::iterator locationItr = mLocations.begin(); locationItr != mLocations.end(); ++locationItr )
+    {
+        delete *locationItr;
+    }
+    mLocations.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void DeclaredAssetsPrefetch::reapWorkers( void )
+{
+    for ( S32 index = 0; index < mWorkers.size(); )
+    {
+        // Skip running workers.
+        if ( mWorkers[index]->isAlive() )
+        {
+            index++;
+            continue;
+        }
+
+        // Delete the finished worker.
+        mWorkers[index]->join();
+        delete mWorkers[index];
+        mWorkers.erase_fast( index );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void DeclaredAssetsPrefetch::processWorker( void* pData )
+{
+    DeclaredAssetsPrefetch* pPrefetch = static_cast<DeclaredAssetsPrefetch*>( pData );
+
+    while( true )
+    {
+        Location* pLocation;
+
+        {
+            MutexHandle mutex;
+            mutex.lock( &pPrefetch->mMutex, true );
+
+            // Finish if there are no pending locations.
+            if ( pPrefetch->mPending.size() == 0 )
+            {
+                pPrefetch->mActiveWorkers--;
+                return;
+            }
+
+            // Take the next location in queue order.
+            pLocation = pPrefetch->mPending.front();
+            pPrefetch->mPending.pop_front();
+        }
+
+        // Process the location.
+        processLocation( pLocation );
+
+        // Signal the location is complete.
+        pLocation->mComplete.release();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void DeclaredAssetsPrefetch::processLocation( Location* pLocation )
+{
+    // Find files.
+    Vector<Platform::FileInfo> files;
+    pLocation->mPathScanned = Platform::dumpPath( pLocation->mPath, files, pLocation->mRecurse ? -1 : 0 );
+
+    // Finish if the path could not be scanned.
+    if ( !pLocation->mPathScanned )
+        return;
+
+    // Fetch extension length.
+    const U32 extensionLength = dStrlen( pLocation->mExtension );
+
+    // Iterate files.
+    for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
+    {
+        // Fetch filename.
+        const char* pFilename = fileItr->pFileName;
+
+        // Find filename length.
+        const U32 filenameLength = dStrlen( pFilename );
+
+        // Skip if extension is longer than filename or the extension is not found.
+        if ( extensionLength > filenameLength || dStricmp( pFilename + filenameLength - extensionLength, pLocation->mExtension ) != 0 )
+            continue;
+
+        // Format full file-path.
+        char assetFileBuffer[1024];
+        dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileItr->pFullPath, pFilename );
+
+        // Load the document, leaving no document if it fails to load.
+        TiXmlDocument* pDocument = NULL;
+        FileStream stream;
+        if ( stream.open( assetFileBuffer, FileStream::Read ) )
+        {
+            pDocument = new TiXmlDocument();
+            if ( !pDocument->LoadFile( stream ) )
+            {
+                delete pDocument;
+                pDocument = NULL;
+            }
+            stream.close();
+        }
+
+        // Store the asset file.
+        pLocation->mAssetFiles.push_back( StringTable->insert( assetFileBuffer ) );
+        pLocation->mDocuments.push_back( pDocument );
+    }
+}
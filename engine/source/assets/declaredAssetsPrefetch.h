@@ -0,0 +1,106 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _DECLARED_ASSETS_PREFETCH_H_
+#define _DECLARED_ASSETS_PREFETCH_H_
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class TiXmlDocument;
+
+//-----------------------------------------------------------------------------
+
+/// Scans declared-asset locations and loads their asset documents on worker threads.
+///
+/// Locations are queued on the main thread (with their paths already expanded) in the
+/// order they will be needed and are processed in that order.  Only the file-system scan
+/// and the document load happen on the workers; visiting the documents and registering
+/// the assets remain on the main thread when the location is acquired.
+class DeclaredAssetsPrefetch
+{
+public:
+    struct Location
+    {
+        Location() : mRecurse( false ), mPathScanned( false ), mComplete( 0 ) {}
+        ~Location();
+
+        StringTableEntry            mOwner;
+        StringTableEntry            mPath;
+        StringTableEntry            mExtension;
+        bool                        mRecurse;
+
+        /// Results.
+        bool                        mPathScanned;
+        Vector<StringTableEntry>    mAssetFiles;
+        Vector<TiXmlDocument*>      mDocuments;
+
+        /// Released once the results are available.
+        Semaphore                   mComplete;
+    };
+
+public:
+    DeclaredAssetsPrefetch();
+    virtual ~DeclaredAssetsPrefetch();
+
+    /// Queue an (expanded) location on behalf of an owner.
+    void queue( const char* pOwner, const char* pPath, const char* pExtension, const bool recurse );
+
+    /// Acquire a queued location, waiting for it if required.  The caller owns the returned location.
+    /// Returns NULL if the location was not queued.
+    Location* acquire( const char* pPath, const char* pExtension, const bool recurse );
+
+    /// Discard any locations queued by the owner that have not been acquired.
+    void discard( const char* pOwner );
+
+    /// Stop all workers and discard any locations not acquired.
+    void clear( void );
+
+private:
+    static void processWorker( void* pData );
+    static void processLocation( Location* pLocation );
+    void reapWorkers( void );
+
+private:
+    Mutex               mMutex;
+    Vector<Location*>   mLocations;
+    Vector<Location*>   mPending;
+    Vector<Thread*>     mWorkers;
+    U32                 mActiveWorkers;
+};
+
+#endif // _DECLARED_ASSETS_PREFETCH_H_
@@ -222,6 +222,12 @@ public:
         return parser.parse( pFilename, *this, false );
     }
 
+    bool parse( const char* pFilename, TiXmlDocument& xmlDocument )
+    {
+        TamlXmlParser parser;
+        return parser.parse( pFilename, xmlDocument, *this );
+    }
+
     typedef StringTableEntry typeAssetId;
     typedef Vector<typeAssetId> typeAssetIdVector;
     typedef Vector<StringTableEntry> typeLooseFileVector;
@@ -86,6 +86,7 @@ AudioAsset::AudioAsset()
    mAudioFile                        = StringTable->EmptyString;
    mDescription.mVolume              = 1.0f;
    mDescription.mVolumeChannel       = 0;
+   mDescription.mPriority            = 1.0f;
    mDescription.mIsLooping           = false;
    mDescription.mIsStreaming		 = false;
 
@@ -109,6 +110,7 @@ void AudioAsset::initPersistFields()
    addProtectedField("AudioFile", TypeAssetLooseFilePath, Offset(mAudioFile, AudioAsset), &setAudioFile, &getAudioFile, &defaultProtectedWriteFn, "" );
    addProtectedField("Volume", TypeF32, Offset(mDescription.mVolume, AudioAsset), &setVolume, &defaultProtectedGetFn, &writeVolume, "");
    addProtectedField("VolumeChannel", TypeS32, Offset(mDescription.mVolumeChannel, AudioAsset), &setVolumeChannel, &defaultProtectedGetFn, &writeVolumeChannel, "");
+   addProtectedField("Priority", TypeF32, Offset(mDescription.mPriority, AudioAsset), &setPriority, &defaultProtectedGetFn, &writePriority, "Scales the audibility of the sound when competing for sources.");
    addProtectedField("Looping", TypeBool, Offset(mDescription.mIsLooping, AudioAsset), &setLooping, &defaultProtectedGetFn, &writeLooping, "");
    addProtectedField("Streaming", TypeBool, Offset(mDescription.mIsStreaming, AudioAsset), &setStreaming, &defaultProtectedGetFn, &writeStreaming, "");
 
@@ -139,6 +141,7 @@ void AudioAsset::copyTo(SimObject* object)
     pAsset->setAudioFile( getAudioFile() );
     pAsset->setVolume( getVolume() );
     pAsset->setVolumeChannel( getVolumeChannel() );
+    pAsset->setPriority( getPriority() );
     pAsset->setLooping( getLooping() );
     pAsset->setStreaming( getStreaming() );
 }
@@ -222,6 +225,21 @@ void AudioAsset::setVolumeChannel( const S32 volumeChannel )
 
 //--------------------------------------------------------------------------
 
+void AudioAsset::setPriority( const F32 priority )
+{
+    // Ignore no change.
+    if ( mIsEqual( priority, mDescription.mPriority ) )
+        return;
+
+    // Update.
+    mDescription.mPriority = getMax( priority, 0.0f );
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//--------------------------------------------------------------------------
+
 void AudioAsset::setLooping( const bool looping )
 {
     // Ignore no change.
@@ -74,6 +74,9 @@ public:
    void setVolumeChannel( const S32 volumeChannel );
    inline S32 getVolumeChannel( void ) const { return mDescription.mVolumeChannel; }
 
+   void setPriority( const F32 priority );
+   inline F32 getPriority( void ) const { return mDescription.mPriority; }
+
    void setLooping( const bool looping );
    inline bool getLooping( void ) const { return mDescription.mIsLooping; }
 
@@ -102,6 +105,9 @@ protected:
     static bool setVolumeChannel( void* obj, const char* data )                 { static_cast<AudioAsset*>(obj)->setVolumeChannel(dAtoi(data)); return false; }
     static bool writeVolumeChannel( void* obj, StringTableEntry pFieldName )    { return static_cast<AudioAsset*>(obj)->getVolumeChannel() != 0; }
 
+    static bool setPriority( void* obj, const char* data )                      { static_cast<AudioAsset*>(obj)->setPriority(dAtof(data)); return false; }
+    static bool writePriority( void* obj, StringTableEntry pFieldName )         { return mNotEqual(static_cast<AudioAsset*>(obj)->getPriority(), 1.0f); }
+
     static bool setLooping( void* obj, const char* data )                       { static_cast<AudioAsset*>(obj)->setLooping(dAtob(data)); return false; }
     static bool writeLooping( void* obj, StringTableEntry pFieldName )          { return static_cast<AudioAsset*>(obj)->getLooping() == true; }
 
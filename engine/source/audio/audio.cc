@@ -28,6 +28,8 @@
 #include "game/gameConnection.h"
 #include "io/fileStream.h"
 #include "audio/audioStreamSourceFactory.h"
+#include "audio/audioVirtualVoice.h"
+#include "audio/audioThread.h"
 
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/SoundEngine.h"
@@ -49,6 +51,8 @@ extern ALvoid  alcMacOSXMixerOutputRateProc(const ALdouble value);
 #define MIN_GAIN              0.05f             // anything with lower gain will not be started
 #define MIN_UNCULL_PERIOD     500               // time before buffer is checked to be unculled
 #define MIN_UNCULL_GAIN       0.1f              // min gain of source to be unculled
+#define MAX_VIRTUAL_VOICES    4096              // maximum number of sounds tracked without a source
+#define AUDIO_THREAD_PERIOD   10                // time between stream refills on the audio thread
 
 #define ALX_DEF_SAMPLE_RATE      44100          // default values for mixer
 #define ALX_DEF_SAMPLE_BITS      16
@@ -56,6 +60,10 @@ extern ALvoid  alcMacOSXMixerOutputRateProc(const ALdouble value);
 
 #define FORCED_OUTER_FALLOFF  10000.f           // forced falloff distance
 
+#ifndef AL_SEC_OFFSET
+#define AL_SEC_OFFSET         0x1024            // OpenAL 1.1 playback position
+#endif
+
 #ifdef TORQUE_OS_OSX
 static ALCdevice *mDevice   = NULL;             // active OpenAL device
 static ALCcontext *mContext = NULL;             // active OpenAL context
@@ -81,6 +89,7 @@ struct LoopingImage
    F32                     mPitch;
    F32                     mScore;
    U32                     mCullTime;
+   U32                     mStartTime;
 
    LoopingImage()  { clear(); }
 
@@ -95,6 +104,7 @@ struct LoopingImage
       mPitch = 1.f;
       mScore = 0.f;
       mCullTime = 0;
+      mStartTime = 0;
    }
 };
 
@@ -107,6 +117,8 @@ static Resource<AudioBuffer>  mBuffer[MAX_AUDIOSOURCES];                   // ea
 static F32                    mScore[MAX_AUDIOSOURCES];                    // for figuring out which sources to cull/uncull
 static F32                    mSourceVolume[MAX_AUDIOSOURCES];             // the samples current un-attenuated gain (not scaled by master/channel gains)
 static U32                    mType[MAX_AUDIOSOURCES];                     // the channel which this source belongs
+static Audio::Description     mSourceDescription[MAX_AUDIOSOURCES];        // the description the source was created with
+static U32                    mStartTime[MAX_AUDIOSOURCES];                // real time the source was at the start of its buffer
 
 static AudioSampleEnvironment*        mSampleEnvironment[MAX_AUDIOSOURCES];           // currently playing sample environments
 static bool                           mEnvironmentEnabled = false;                    // environment enabled?
@@ -140,6 +152,9 @@ static StreamingList mStreamingList;                 // all the streaming source
 static StreamingList mStreamingInactiveList;         // sources which have not been played yet
 static StreamingList mStreamingCulledList;           // sources which have been culled (alxPlay called)
 
+// sounds without a source which keep their playback position until they can be promoted
+static AudioVirtualVoiceList mVirtualVoices;
+
 #define AUDIOHANDLE_LOOPING_BIT  (0x80000000)
 #define AUDIOHANDLE_STREAMING_BIT  (0x40000000)
 #define AUDIOHANDLE_INACTIVE_BIT (0x20000000)
@@ -262,7 +277,66 @@ static AUDIOHANDLE getNewHandle()
 // function declarations
 void alxLoopingUpdate();
 void alxStreamingUpdate();
+void alxVirtualVoiceUpdate();
 void alxUpdateScores(bool);
+ALuint alxGetWaveLen(ALuint buffer);
+
+// set the playback position; ignored by implementations without AL_SEC_OFFSET
+static void alxSourceOffset(ALuint source, F32 offset)
+{
+   if(offset <= 0.f)
+      return;
+
+   alSourcef(source, AL_SEC_OFFSET, offset);
+   alGetError();
+}
+
+//--------------------------------------------------------------------------
+// create a voice that has no source yet
+static AudioVirtualVoice * alxCreateVirtualVoice(AUDIOHANDLE handle, Resource<AudioBuffer> buffer, const Audio::Description& desc, AudioSampleEnvironment *sampleEnvironment)
+{
+   if(mVirtualVoices.size() >= MAX_VIRTUAL_VOICES)
+      return(NULL);
+
+   AudioVirtualVoice * voice = mVirtualVoices.create(handle);
+   voice->mBuffer = buffer;
+   voice->mDescription = desc;
+   voice->mEnvironment = sampleEnvironment;
+   voice->mVolume = desc.mVolume;
+
+   // the length is known once the buffer has loaded
+   voice->mLoading = buffer->isLoading();
+   if(!voice->mLoading)
+      voice->mDuration = alxGetWaveLen(buffer->getALBuffer());
+   return(voice);
+}
+
+//--------------------------------------------------------------------------
+// keep a one-shot that is losing its source going as a virtual voice
+static void alxVirtualizeSource(U32 index)
+{
+   if(!bool(mBuffer[index]))
+      return;
+
+   const U32 time = Platform::getRealMilliseconds();
+   const bool playing = !(mHandle[index] & AUDIOHANDLE_INACTIVE_BIT);
+
+   AudioVirtualVoice * voice = alxCreateVirtualVoice(mHandle[index] & RETURN_MASK, mBuffer[index], mSourceDescription[index], mSampleEnvironment[index]);
+   if(!voice)
+      return;
+
+   voice->mVolume = mSourceVolume[index];
+   voice->mPlaying = playing;
+   voice->mStartTime = mStartTime[index];
+   voice->mCullTime = time;
+
+   if(voice->mDescription.mIs3D)
+      alGetSourcefv(mSource[index], AL_POSITION, (ALfloat*)&voice->mPosition);
+
+   // nothing left to play?
+   if(voice->isFinished(time))
+      mVirtualVoices.destroy(voice);
+}
 
 static bool findFreeSource(U32 *index)
 {
@@ -340,6 +414,10 @@ static bool cullSource(U32 *index, F32 volume)
       }
    }
 
+   // one-shots become virtual voices
+   if(!itr && !itr2)
+      alxVirtualizeSource(best);
+
    alSourceStop(mSource[best]);
    mHandle[best] = NULL_AUDIOHANDLE;
    mBuffer[best] = 0;
@@ -394,6 +472,9 @@ ALuint alxFindSource(AUDIOHANDLE handle)
 */
 bool alxIsValidHandle(AUDIOHANDLE handle)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    if(handle == NULL_AUDIOHANDLE)
       return(false);
 
@@ -416,6 +497,10 @@ bool alxIsValidHandle(AUDIOHANDLE handle)
    if(mStreamingList.findImage(handle))
       return(true);
 
+   AudioVirtualVoice * voice = mVirtualVoices.find(handle & RETURN_MASK);
+   if(voice && !voice->isFinished(Platform::getRealMilliseconds()))
+      return(true);
+
    return(false);
 }
 
@@ -424,12 +509,19 @@ bool alxIsValidHandle(AUDIOHANDLE handle)
 */
 bool alxIsPlaying(AUDIOHANDLE handle)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    if(handle == NULL_AUDIOHANDLE)
       return(false);
 
    U32 idx = alxFindIndex(handle);
    if(idx == MAX_AUDIOSOURCES)
-      return(false);
+   {
+      // virtual voices are playing, just not audible
+      AudioVirtualVoice * voice = mVirtualVoices.find(handle & RETURN_MASK);
+      return(voice && voice->mPlaying && !voice->isFinished(Platform::getRealMilliseconds()));
+   }
 
    ALint state = 0;
    alGetSourcei(mSource[idx], AL_SOURCE_STATE, &state);
@@ -642,6 +734,9 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
    if( filename == NULL || filename == StringTable->EmptyString )
       return NULL_AUDIOHANDLE;
 
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    F32 volume = desc.mVolume;
 
    // calculate an approximate attenuation for 3d sounds
@@ -664,21 +759,42 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
    // scale volume by channel attenuation
    volume *= mAudioChannelVolumes[desc.mVolumeChannel];
 
-   // non-loopers don't add if < minvolume
+   // non-loopers don't add if < minvolume, unless they are only quiet because of their
+   // distance in which case they are tracked as virtual voices (below)
    if(!desc.mIsLooping && !desc.mIsStreaming && (volume <= MIN_GAIN))
-      return(NULL_AUDIOHANDLE);
+   {
+      if(!desc.mIs3D || !transform || (desc.mVolume * mAudioChannelVolumes[desc.mVolumeChannel] <= MIN_GAIN))
+         return(NULL_AUDIOHANDLE);
+   }
+
+   // sources compete by audibility scaled by priority
+   const F32 score = volume * desc.mPriority;
+
+   // grab the buffer, loading it on the audio thread if need be
+   Resource<AudioBuffer> buffer;
+   if(!desc.mIsStreaming)
+   {
+      buffer = AudioBuffer::find(filename);
+      if(!(bool)buffer)
+         return(NULL_AUDIOHANDLE);
+
+      buffer->loadAsync();
+   }
+
+   const bool loading = !desc.mIsStreaming && buffer->isLoading();
 
    U32 index = MAX_AUDIOSOURCES;
 
-   // try and find an available source: 0 volume loopers get added to inactive list
-   if(volume > MIN_GAIN)
+   // try and find an available source: 0 volume loopers get added to inactive list as do
+   // sounds that are still loading
+   if(volume > MIN_GAIN && !loading)
    {
       if(!findFreeSource(&index))
       {
          alxUpdateScores(true);
 
          // scores do not include master volume
-         if(!cullSource(&index, volume))
+         if(!cullSource(&index, score))
             index = MAX_AUDIOSOURCES;
       }
    }
@@ -688,17 +804,13 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
    {
       if(desc.mIsLooping && !(desc.mIsStreaming))
       {
-         Resource<AudioBuffer> buffer = AudioBuffer::find(filename);
-         if(!(bool)buffer)
-            return(NULL_AUDIOHANDLE);
-
          // create the inactive looping image
          LoopingImage * image = createLoopingImage();
 
          image->mHandle = getNewHandle() | AUDIOHANDLE_LOOPING_BIT | AUDIOHANDLE_INACTIVE_BIT;
          image->mBuffer = buffer;
          image->mDescription = desc;
-         image->mScore = volume;
+         image->mScore = score;
          image->mEnvironment = sampleEnvironment;
 
          // grab position/direction if 3d source
@@ -716,6 +828,22 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
          mLoopingInactiveList.push_back(image);
          return(image->mHandle & RETURN_MASK);
       }
+      else if(!desc.mIsStreaming)
+      {
+         // track the one-shot as a virtual voice until it has loaded and a source is available
+         AudioVirtualVoice * voice = alxCreateVirtualVoice(getNewHandle(), buffer, desc, sampleEnvironment);
+         if(!voice)
+            return(NULL_AUDIOHANDLE);
+
+         if(transform)
+         {
+            transform->getColumn(3, &voice->mPosition);
+            transform->getColumn(1, &voice->mDirection);
+         }
+
+         voice->mScore = score;
+         return(voice->mHandle);
+      }
       else
          return(NULL_AUDIOHANDLE);
    }
@@ -732,7 +860,7 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
             streamSource->mHandle = getNewHandle() | AUDIOHANDLE_STREAMING_BIT | AUDIOHANDLE_INACTIVE_BIT;
             streamSource->mSource = NULL;
             streamSource->mDescription = desc;
-            streamSource->mScore = volume;
+            streamSource->mScore = score;
             streamSource->mEnvironment = sampleEnvironment;
 
             // grab position/direction if 3d source
@@ -760,22 +888,16 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
    // clear the error state
    alGetError();
 
-   // grab the buffer
-   Resource<AudioBuffer> buffer;
-   if(!(desc.mIsStreaming)) {
-        buffer = AudioBuffer::find(filename);
-        if((bool)buffer == false)
-            return NULL_AUDIOHANDLE;
-    }
-
    // init the source (created inactive) and store needed values
    mHandle[index] = getNewHandle() | AUDIOHANDLE_INACTIVE_BIT;
    mType[index] = desc.mVolumeChannel;
    if(!(desc.mIsStreaming)) {
     mBuffer[index] = buffer;
    }
-   mScore[index] = volume;
+   mScore[index] = score;
    mSourceVolume[index] = desc.mVolume;
+   mSourceDescription[index] = desc;
+   mStartTime[index] = 0;
    mSampleEnvironment[index] = sampleEnvironment;
 
    ALuint source = mSource[index];
@@ -796,7 +918,7 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
       image->mHandle = mHandle[index];
       image->mBuffer = buffer;
       image->mDescription = desc;
-      image->mScore = volume;
+      image->mScore = score;
       image->mEnvironment = sampleEnvironment;
 
       // grab position/direction
@@ -827,7 +949,7 @@ AUDIOHANDLE alxCreateSource(const Audio::Description& desc,
          streamSource->mHandle = mHandle[index];
          streamSource->mSource = mSource[index];
          streamSource->mDescription = desc;
-         streamSource->mScore = volume;
+         streamSource->mScore = score;
          streamSource->mEnvironment = sampleEnvironment;
 
          // grab position/direction
@@ -874,6 +996,9 @@ extern void threadPlay(AudioBuffer * buffer, AUDIOHANDLE handle);
 
 AUDIOHANDLE alxPlay(AUDIOHANDLE handle)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    U32 index = alxFindIndex(handle);
 
    if(index != MAX_AUDIOSOURCES)
@@ -882,12 +1007,21 @@ AUDIOHANDLE alxPlay(AUDIOHANDLE handle)
       if(mHandle[index] & AUDIOHANDLE_INACTIVE_BIT)
       {
          mHandle[index] &= ~(AUDIOHANDLE_INACTIVE_BIT | AUDIOHANDLE_LOADING_BIT);
+         mStartTime[index] = Platform::getRealMilliseconds();
 
          // make sure the looping image also clears it's inactive bit
          LoopingList::iterator itr = mLoopingList.findImage(handle);
          if(itr)
+         {
             (*itr)->mHandle &= ~(AUDIOHANDLE_INACTIVE_BIT | AUDIOHANDLE_LOADING_BIT);
 
+            // loopers keep the time they were first played so they resume in step
+            if((*itr)->mStartTime)
+               mStartTime[index] = (*itr)->mStartTime;
+            else
+               (*itr)->mStartTime = mStartTime[index];
+         }
+
          // make sure the streaming image also clears it's inactive bit
          StreamingList::iterator itr2 = mStreamingList.findImage(handle);
          if(itr2)
@@ -900,11 +1034,26 @@ AUDIOHANDLE alxPlay(AUDIOHANDLE handle)
    }
    else
    {
+      // start virtual voices, they get a source right away if they can win one
+      AudioVirtualVoice * voice = mVirtualVoices.find(handle & RETURN_MASK);
+      if(voice)
+      {
+         if(!voice->mPlaying)
+         {
+            voice->mPlaying = true;
+            voice->mStartTime = Platform::getRealMilliseconds();
+            alxVirtualVoiceUpdate();
+         }
+         return(handle);
+      }
+
       // move inactive loopers to the culled list, try to start the sound
       LoopingList::iterator itr = mLoopingInactiveList.findImage(handle);
       if(itr)
       {
          AssertFatal(!mLoopingCulledList.findImage(handle), "alxPlay: image already in culled list");
+         if(!(*itr)->mStartTime)
+            (*itr)->mStartTime = Platform::getRealMilliseconds();
          mLoopingCulledList.push_back(*itr);
          mLoopingInactiveList.erase_fast(itr);
          alxLoopingUpdate();
@@ -959,10 +1108,17 @@ AUDIOHANDLE alxPlay(const AudioAsset *profile, const MatrixF *transform, const P
 
 bool alxPause( AUDIOHANDLE handle )
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
     if(handle == NULL_AUDIOHANDLE)
         return false;
     U32 index = alxFindIndex( handle );
 
+    // only sounds with a source can be paused
+    if ( index == MAX_AUDIOSOURCES )
+        return false;
+
     alSourcePause( mSource[index] );
 
     ALenum error = 0;
@@ -1001,6 +1157,9 @@ void alxUnPause( AUDIOHANDLE handle )
 //--------------------------------------------------------------------------
 void alxStop(AUDIOHANDLE handle)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    U32 index = alxFindIndex(handle);
 
    // stop it
@@ -1017,6 +1176,11 @@ void alxStop(AUDIOHANDLE handle)
       mBuffer[index] = 0;
    }
 
+   // remove the virtual voice
+   AudioVirtualVoice * voice = mVirtualVoices.find(handle & RETURN_MASK);
+   if(voice)
+      mVirtualVoices.destroy(voice);
+
    // remove loopingImage and add it to the free list
    LoopingList::iterator itr = mLoopingList.findImage(handle);
    if(itr)
@@ -1093,6 +1257,9 @@ void alxStopAll()
 // stop all streaming sources
    while(mStreamingList.size())
       alxStop(mStreamingList.last()->mHandle);
+
+   // stop all virtual voices
+   mVirtualVoices.clear();
 }
 
 void alxLoopSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat value)
@@ -1238,6 +1405,9 @@ void alxLoopGetSourcei(AUDIOHANDLE handle, ALenum pname, ALint *value)
 
 void alxStreamSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    StreamingList::iterator itr = mStreamingList.findImage(handle);
    if(itr)
    {
@@ -1264,6 +1434,9 @@ void alxStreamSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat value)
 
 void alxStreamSource3f(AUDIOHANDLE handle, ALenum pname, ALfloat value1, ALfloat value2, ALfloat value3)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    StreamingList::iterator itr = mStreamingList.findImage(handle);
    if(itr)
    {
@@ -1286,6 +1459,9 @@ void alxStreamSource3f(AUDIOHANDLE handle, ALenum pname, ALfloat value1, ALfloat
 
 void alxStreamSourcei(AUDIOHANDLE handle, ALenum pname, ALint value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    StreamingList::iterator itr = mStreamingList.findImage(handle);
    if(itr)
    {
@@ -1306,6 +1482,9 @@ void alxStreamSourcei(AUDIOHANDLE handle, ALenum pname, ALint value)
 
 void alxStreamGetSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat *value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    StreamingList::iterator itr = mStreamingList.findImage(handle);
    if(itr)
    {
@@ -1332,6 +1511,9 @@ void alxStreamGetSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat *value)
 
 void alxStreamGetSource3f(AUDIOHANDLE handle, ALenum pname, ALfloat *value1, ALfloat *value2, ALfloat *value3)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    StreamingList::iterator itr = mStreamingList.findImage(handle);
    if(itr)
    {
@@ -1354,6 +1536,9 @@ void alxStreamGetSource3f(AUDIOHANDLE handle, ALenum pname, ALfloat *value1, ALf
 
 void alxStreamGetSourcei(AUDIOHANDLE handle, ALenum pname, ALint *value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    StreamingList::iterator itr = mStreamingList.findImage(handle);
    if(itr)
    {
@@ -1383,6 +1568,9 @@ void alxStreamGetSourcei(AUDIOHANDLE handle, ALenum pname, ALint *value)
 //   a createSource and playSource call...)
 void alxUpdateTypeGain(U32 type)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    for(U32 i = 0; i < mNumSources; i++)
    {
       if(mHandle[i] == NULL_AUDIOHANDLE)
@@ -1403,8 +1591,38 @@ void alxUpdateTypeGain(U32 type)
    }
 }
 
+// keep the state of virtual voices up to date so they start correctly when promoted
+static void alxVirtualVoiceSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat value)
+{
+   AudioVirtualVoice * voice = mVirtualVoices.find(handle & RETURN_MASK);
+   if(!voice)
+      return;
+
+   if(pname == AL_GAIN)
+      voice->mVolume = Audio::DBToLinear(value);
+   else if(pname == AL_GAIN_LINEAR)
+      voice->mVolume = value;
+}
+
+static void alxVirtualVoiceSource3f(AUDIOHANDLE handle, ALenum pname, ALfloat value1, ALfloat value2, ALfloat value3)
+{
+   AudioVirtualVoice * voice = mVirtualVoices.find(handle & RETURN_MASK);
+   if(!voice)
+      return;
+
+   if(pname == AL_POSITION)
+      voice->mPosition.set(value1, value2, value3);
+   else if(pname == AL_DIRECTION)
+      voice->mDirection.set(value1, value2, value3);
+}
+
 void alxSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
+   alxVirtualVoiceSourcef(handle, pname, value);
+
    ALuint source = alxFindSource(handle);
 
    if(source != INVALID_SOURCE)
@@ -1452,6 +1670,9 @@ void alxSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat value)
 
 void alxSourcefv(AUDIOHANDLE handle, ALenum pname, ALfloat *values)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    ALuint source = alxFindSource(handle);
    if(source != INVALID_SOURCE)
       alSourcefv(source, pname, values);
@@ -1459,11 +1680,15 @@ void alxSourcefv(AUDIOHANDLE handle, ALenum pname, ALfloat *values)
    if((pname == AL_POSITION) || (pname == AL_DIRECTION) || (pname == AL_VELOCITY)) {
       alxLoopSource3f(handle, pname, values[0], values[1], values[2]);
       alxStreamSource3f(handle, pname, values[0], values[1], values[2]);
+      alxVirtualVoiceSource3f(handle, pname, values[0], values[1], values[2]);
     }
 }
 
 void alxSource3f(AUDIOHANDLE handle, ALenum pname, ALfloat value1, ALfloat value2, ALfloat value3)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    ALuint source = alxFindSource(handle);
    if(source != INVALID_SOURCE)
    {
@@ -1475,10 +1700,14 @@ void alxSource3f(AUDIOHANDLE handle, ALenum pname, ALfloat value1, ALfloat value
    }
    alxLoopSource3f(handle, pname, value1, value2, value3);
    alxStreamSource3f(handle, pname, value1, value2, value3);
+   alxVirtualVoiceSource3f(handle, pname, value1, value2, value3);
 }
 
 void alxSourcei(AUDIOHANDLE handle, ALenum pname, ALint value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    ALuint source = alxFindSource(handle);
    if(source != INVALID_SOURCE)
       alSourcei(source, pname, value);
@@ -1489,6 +1718,9 @@ void alxSourcei(AUDIOHANDLE handle, ALenum pname, ALint value)
 // sets the position and direction of the source
 void alxSourceMatrixF(AUDIOHANDLE handle, const MatrixF *transform)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    ALuint source = alxFindSource(handle);
 
    Point3F pos;
@@ -1508,11 +1740,16 @@ void alxSourceMatrixF(AUDIOHANDLE handle, const MatrixF *transform)
    alxLoopSource3f(handle, AL_DIRECTION, dir.x, dir.y, dir.z);
    alxStreamSource3f(handle, AL_POSITION, pos.x, pos.y, pos.z);
    alxStreamSource3f(handle, AL_DIRECTION, dir.x, dir.y, dir.z);
+   alxVirtualVoiceSource3f(handle, AL_POSITION, pos.x, pos.y, pos.z);
+   alxVirtualVoiceSource3f(handle, AL_DIRECTION, dir.x, dir.y, dir.z);
 }
 
 //--------------------------------------------------------------------------
 void alxGetSourcef(AUDIOHANDLE handle, ALenum pname, ALfloat *value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    ALuint source = alxFindSource(handle);
    if(source != INVALID_SOURCE)
    {
@@ -1549,6 +1786,9 @@ void alxGetSourcefv(AUDIOHANDLE handle, ALenum pname, ALfloat *values)
 
 void alxGetSource3f(AUDIOHANDLE handle, ALenum pname, ALfloat *value1, ALfloat *value2, ALfloat *value3)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    ALuint source = alxFindSource(handle);
    if(source != INVALID_SOURCE)
    {
@@ -1566,6 +1806,9 @@ void alxGetSource3f(AUDIOHANDLE handle, ALenum pname, ALfloat *value1, ALfloat *
 
 void alxGetSourcei(AUDIOHANDLE handle, ALenum pname, ALint *value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    ALuint source = alxFindSource(handle);
    if(source != INVALID_SOURCE)
       alGetSourcei(source, pname, value);
@@ -1582,6 +1825,9 @@ void alxGetSourcei(AUDIOHANDLE handle, ALenum pname, ALint *value)
 */
 void alxListenerMatrixF(const MatrixF *transform)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    Point3F p1, p2;
    transform->getColumn(3, &p1);
    alListener3f(AL_POSITION, p1.x, p1.y, p1.z);
@@ -1605,6 +1851,9 @@ void alxListenerMatrixF(const MatrixF *transform)
 */
 void alxListenerf(ALenum param, ALfloat value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    if (param == AL_GAIN_LINEAR)
    {
       value = Audio::linearToDB(value);
@@ -1618,6 +1867,9 @@ void alxListenerf(ALenum param, ALfloat value)
 */
 void alxGetListenerf(ALenum param, ALfloat *value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    if (param == AL_GAIN_LINEAR)
    {
       alGetListenerf(AL_GAIN, value);
@@ -1708,6 +1960,8 @@ static void alxGatherMetrics()
    Con::setIntVariable("Audio::numStreamingStreams",          mNumStreamingStreams);
    Con::setIntVariable("Audio::numInactiveStreamingStreams",  mNumInactiveStreamingStreams);
    Con::setIntVariable("Audio::numCulledStreamingStreams",    mNumCulledStreamingStreams);
+
+   Con::setIntVariable("Audio::numVirtualVoices",             mVirtualVoices.size());
 }
 #endif
 
@@ -1716,6 +1970,9 @@ static void alxGatherMetrics()
 //--------------------------------------------------------------------------
 void alxLoopingUpdate()
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    static LoopingList culledList;
 
    U32 updateTime = Platform::getRealMilliseconds();
@@ -1736,6 +1993,10 @@ void alxLoopingUpdate()
          if((*itr)->mScore <= MIN_UNCULL_GAIN)
             continue;
 
+         // still loading on the audio thread
+         if((*itr)->mBuffer->isLoading())
+            continue;
+
          if((updateTime - (*itr)->mCullTime) < MIN_UNCULL_PERIOD)
             continue;
 
@@ -1791,6 +2052,7 @@ void alxLoopingUpdate()
          mScore[index] = (*itr)->mScore;
          mSourceVolume[index] = (*itr)->mDescription.mVolume;
          mType[index] = (*itr)->mDescription.mVolumeChannel;
+         mSourceDescription[index] = (*itr)->mDescription;
          mSampleEnvironment[index] = (*itr)->mEnvironment;
 
          ALuint source = mSource[index];
@@ -1802,15 +2064,26 @@ void alxLoopingUpdate()
          if(mEnvironmentEnabled)
             alxSourceEnvironment(source, *itr);
 
+         // resume where the looper would have been had it kept playing
+         if((*itr)->mStartTime)
+         {
+            const U32 duration = alxGetWaveLen((*itr)->mBuffer->getALBuffer());
+            if(duration)
+               alxSourceOffset(source, ((updateTime - (*itr)->mStartTime) % duration) / 1000.f);
+         }
+
          alxPlay(mHandle[index]);
       }
    }
 }
 
-void alxStreamingUpdate()
+//--------------------------------------------------------------------------
+// refill the buffer queues on active streamers
+static void alxStreamingRefill()
 {
-   // update buffer queues on active streamers
-   // update the loopers
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    for(StreamingList::iterator itr = mStreamingList.begin(); itr != mStreamingList.end(); itr++)
    {
       if((*itr)->mHandle & AUDIOHANDLE_INACTIVE_BIT)
@@ -1818,6 +2091,16 @@ void alxStreamingUpdate()
 
       (*itr)->updateBuffers();
    }
+}
+
+void alxStreamingUpdate()
+{
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
+   // the audio thread keeps the streams full when it is running
+   if(!AudioThread::get())
+      alxStreamingRefill();
 
    static StreamingList culledList;
 
@@ -1891,6 +2174,8 @@ void alxStreamingUpdate()
          mScore[index] = (*itr)->mScore;
          mSourceVolume[index] = (*itr)->mDescription.mVolume;
          mType[index] = (*itr)->mDescription.mVolumeChannel;
+         mSourceDescription[index] = (*itr)->mDescription;
+         mStartTime[index] = 0;
          mSampleEnvironment[index] = (*itr)->mEnvironment;
 
          ALuint source = mSource[index];
@@ -1907,9 +2192,103 @@ void alxStreamingUpdate()
    }
 }
 
+//--------------------------------------------------------------------------
+// retire finished virtual voices and promote the most audible onto sources,
+// culling less important sources (which become virtual voices in turn)
+void alxVirtualVoiceUpdate()
+{
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
+   static Vector<AudioVirtualVoice*> candidates;
+
+   U32 updateTime = Platform::getRealMilliseconds();
+
+   // voices which were waiting for their buffers start from the beginning once loaded
+   for(S32 i = mVirtualVoices.size() - 1; i >= 0; i--)
+   {
+      AudioVirtualVoice * voice = mVirtualVoices[i];
+      if(!voice->mLoading || voice->mBuffer->isLoading())
+         continue;
+
+      if(!voice->mBuffer->isLoaded())
+      {
+         mVirtualVoices.destroy(voice);
+         continue;
+      }
+
+      voice->mLoading = false;
+      voice->mDuration = alxGetWaveLen(voice->mBuffer->getALBuffer());
+      if(voice->mPlaying)
+         voice->mStartTime = updateTime;
+   }
+
+   mVirtualVoices.retireFinished(updateTime);
+   if(!mVirtualVoices.size())
+      return;
+
+   Point3F listener;
+   alxGetListenerPoint3F(AL_POSITION, &listener);
+
+   mVirtualVoices.getPromotionCandidates(updateTime, listener, mAudioChannelVolumes, MIN_UNCULL_GAIN, MIN_UNCULL_PERIOD, candidates);
+   if(!candidates.size())
+      return;
+
+   alxUpdateScores(true);
+
+   for(Vector<AudioVirtualVoice*>::iterator itr = candidates.begin(); itr != candidates.end(); itr++)
+   {
+      AudioVirtualVoice * voice = *itr;
+
+      U32 index = MAX_AUDIOSOURCES;
+      if(!findFreeSource(&index))
+      {
+         // score does not include master volume
+         if(!cullSource(&index, voice->mScore))
+            break;
+      }
+
+      // restore all state data
+      mHandle[index] = voice->mHandle;
+      mBuffer[index] = voice->mBuffer;
+      mScore[index] = voice->mScore;
+      mSourceVolume[index] = voice->mVolume;
+      mType[index] = voice->mDescription.mVolumeChannel;
+      mSourceDescription[index] = voice->mDescription;
+      mStartTime[index] = voice->mStartTime;
+      mSampleEnvironment[index] = voice->mEnvironment;
+
+      ALuint source = mSource[index];
+
+      // setup play info
+      alGetError();
+
+      MatrixF transform(true);
+      transform.setColumn(3, voice->mPosition);
+      transform.setRow(1, voice->mDirection);
+      alxSourcePlay(source, voice->mBuffer, voice->mDescription, voice->mDescription.mIs3D ? &transform : 0);
+
+      // the gain may have changed since the voice was created
+      F32 vol = mClampF(voice->mVolume * mAudioChannelVolumes[mType[index]] * mMasterVolume, 0.f, 1.f);
+      alSourcef(source, AL_GAIN, Audio::linearToDB(vol));
+
+      if(mEnvironmentEnabled)
+         alxSourceEnvironment(source, voice->mDescription.mEnvironmentLevel, voice->mEnvironment);
+
+      // pick up where the voice would have been had it been audible
+      alxSourceOffset(source, voice->getOffset(updateTime));
+      alSourcePlay(source);
+
+      mVirtualVoices.destroy(voice);
+   }
+}
+
 //--------------------------------------------------------------------------
 void alxCloseHandles()
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    for(U32 i = 0; i < mNumSources; i++)
    {
       if(mHandle[i] & AUDIOHANDLE_LOADING_BIT)
@@ -1967,6 +2346,9 @@ void alxCloseHandles()
 // - does not scale by attenuated volumes
 void alxUpdateScores(bool sourcesOnly)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    Point3F listener;
    alGetListener3f(AL_POSITION, &listener.x, &listener.y, &listener.z);
 
@@ -2010,6 +2392,9 @@ void alxUpdateScores(bool sourcesOnly)
          else if(dist > min)
             mScore[i] *= (max-dist) / (max-min);
       }
+
+      // scale by priority
+      mScore[i] *= mSourceDescription[i].mPriority;
    }
 
    if(sourcesOnly)
@@ -2041,8 +2426,8 @@ void alxUpdateScores(bool sourcesOnly)
             (*itr)->mScore *= (max-dist) / (max-min);
       }
 
-      // attenuate by the channel gain
-      (*itr)->mScore *= mAudioChannelVolumes[(*itr)->mDescription.mVolumeChannel];
+      // attenuate by the channel gain and scale by priority
+      (*itr)->mScore *= mAudioChannelVolumes[(*itr)->mDescription.mVolumeChannel] * (*itr)->mDescription.mPriority;
    }
 
    // update the streamers
@@ -2069,8 +2454,8 @@ void alxUpdateScores(bool sourcesOnly)
             (*itr)->mScore *= (max-dist) / (max-min);
       }
 
-      // attenuate by the channel gain
-      (*itr)->mScore *= mAudioChannelVolumes[(*itr)->mDescription.mVolumeChannel];
+      // attenuate by the channel gain and scale by priority
+      (*itr)->mScore *= mAudioChannelVolumes[(*itr)->mDescription.mVolumeChannel] * (*itr)->mDescription.mPriority;
    }
 }
 
@@ -2078,6 +2463,9 @@ void alxUpdateScores(bool sourcesOnly)
 // ignore this flag... that is why this is here
 void alxUpdateMaxDistance()
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    Point3F listener;
    alGetListener3f(AL_POSITION, &listener.x, &listener.y, &listener.z);
 
@@ -2117,6 +2505,13 @@ void alxUpdateMaxDistance()
 //--------------------------------------------------------------------------
 void alxUpdate()
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
+   // hand the buffers loaded on the audio thread to OpenAL
+   if(AudioThread::get())
+      AudioThread::get()->processLoads();
+
    //if(mForceMaxDistanceUpdate)
       alxUpdateMaxDistance();
 
@@ -2124,6 +2519,7 @@ void alxUpdate()
    alxUpdateScores(false);
    alxLoopingUpdate();
    alxStreamingUpdate();
+   alxVirtualVoiceUpdate();
 
 #ifdef TORQUE_GATHER_METRICS
    alxGatherMetrics();
@@ -2136,6 +2532,9 @@ void alxUpdate()
 // client-side function only
 ALuint alxGetWaveLen(ALuint buffer)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    if(buffer == AL_INVALID)
       return(0);
 
@@ -2165,6 +2564,9 @@ ALuint alxGetWaveLen(ALuint buffer)
 //--------------------------------------------------------------------------
 void alxEnvironmenti(ALenum pname, ALint value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
 /* todo
    alEnvironmentiIASIG(mEnvironment, pname, value);
 */
@@ -2172,6 +2574,9 @@ void alxEnvironmenti(ALenum pname, ALint value)
 
 void alxEnvironmentf(ALenum pname, ALfloat value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
 /* todo
    alEnvironmentfIASIG(mEnvironment, pname, value);
 */
@@ -2179,6 +2584,9 @@ void alxEnvironmentf(ALenum pname, ALfloat value)
 
 void alxGetEnvironmenti(ALenum pname, ALint * value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
 /* todo
    alGetEnvironmentiIASIG_EXT(mEnvironment, pname, value);
 */
@@ -2186,6 +2594,9 @@ void alxGetEnvironmenti(ALenum pname, ALint * value)
 
 void alxGetEnvironmentf(ALenum pname, ALfloat * value)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
 /* todo
    alGetEnvironmentfIASIG_EXT(mEnvironment, pname, value);
 */
@@ -2193,6 +2604,9 @@ void alxGetEnvironmentf(ALenum pname, ALfloat * value)
 
 void alxEnableEnvironmental(bool enable)
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    if(mEnvironmentEnabled == enable)
       return;
 
@@ -2290,6 +2704,9 @@ const AudioEnvironment * alxGetEnvironment()
 
 F32 alxGetStreamPosition( AUDIOHANDLE handle )
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    StreamingList::iterator itr = mStreamingList.findImage(handle);
    if( !itr )
       return -1.f;
@@ -2299,6 +2716,9 @@ F32 alxGetStreamPosition( AUDIOHANDLE handle )
 
 F32 alxGetStreamDuration( AUDIOHANDLE handle )
 {
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    StreamingList::iterator itr = mStreamingList.findImage(handle);
    if( !itr )
       return -1.f;
@@ -2505,12 +2925,17 @@ bool OpenALInit()
    alDistanceModel(AL_INVERSE_DISTANCE);
    alListenerf(AL_GAIN_LINEAR, 1.f);
 
+   // refill streams and load buffers in the background
+   AudioThread::create(alxStreamingRefill, AUDIO_THREAD_PERIOD);
+
    return true;
 }
 
 //--------------------------------------------------------------------------
 void OpenALShutdown()
 {
+   AudioThread::destroy();
+
    alxStopAll();
 
    //if(mInitialized)
@@ -2532,6 +2957,8 @@ void OpenALShutdown()
       mLoopingFreeList.pop_back();
    }
 
+   mVirtualVoices.clear();
+
    for(U32 i = 0; i < MAX_AUDIOSOURCES; i++)
       mBuffer[i] = 0;
 
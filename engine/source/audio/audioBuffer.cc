@@ -22,9 +22,11 @@
 
 #include "platform/platformAL.h"
 #include "audio/audioBuffer.h"
+#include "audio/audioThread.h"
 #include "io/stream.h"
 #include "console/console.h"
 #include "memory/frameAllocator.h"
+#include "memory/memoryTracker.h"
 
 #ifndef _MMATH_H_
 #include "math/mMath.h"
@@ -106,12 +108,26 @@ AudioBuffer::AudioBuffer(StringTableEntry filename)
    mFilename = filename;
    mLoading = false;
    malBuffer = 0;
+
+   mData = NULL;
+   mDataSize = 0;
+   mDataFormat = AL_FORMAT_MONO16;
+   mDataFreq = 22050;
 }
 
 AudioBuffer::~AudioBuffer()
 {
+   // the audio thread must let go of the buffer first
+   if(mLoading && AudioThread::get())
+      AudioThread::get()->cancelLoad(this);
+
+   delete [] mData;
+
    if( malBuffer != 0 ) 
    {
+     MutexHandle alLock;
+     alLock.lock(AudioThread::getALLock(), true);
+
      alGetError();
      alDeleteBuffers( 1, &malBuffer );
      ALenum error;
@@ -175,6 +191,13 @@ ALuint AudioBuffer::getALBuffer()
    if (!alcGetCurrentContext())
       return 0;
 
+   // finish a background load now rather than load the file again
+   if (mLoading && AudioThread::get())
+      AudioThread::get()->finishLoad(this);
+
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    // clear the error state
    alGetError();
 
@@ -218,14 +241,103 @@ ALuint AudioBuffer::getALBuffer()
    }
 
    alDeleteBuffers(1, &malBuffer);
+   malBuffer = 0;
    return 0;
 }
 
+//-----------------------------------------------------------------
+void AudioBuffer::loadAsync()
+{
+   if(mLoading || isLoaded())
+      return;
+
+   // only wav files are decoded in the background
+   AudioThread * thread = AudioThread::get();
+   S32 len = dStrlen(mFilename);
+   if(!thread || len < 4 || dStricmp(mFilename + len - 4, ".wav"))
+   {
+      getALBuffer();
+      return;
+   }
+
+   // the stream is opened here as the resource manager is not thread-safe
+   ResourceObject * obj = ResourceManager->find(mFilename);
+   Stream * stream = obj ? ResourceManager->openStream(obj) : NULL;
+   if(!stream)
+      return;
+
+#ifdef LOG_SOUND_LOADS
+   Con::printf("Queueing WAV: %s\n", mFilename);
+#endif
+
+   mLoading = true;
+   thread->queueLoad(this, stream);
+}
+
+//-----------------------------------------------------------------
+bool AudioBuffer::uploadDecoded(bool success)
+{
+   mLoading = false;
+
+   if(success && alcGetCurrentContext())
+   {
+      MutexHandle alLock;
+      alLock.lock(AudioThread::getALLock(), true);
+
+      alGetError();
+      alGenBuffers(1, &malBuffer);
+      success = (alGetError() == AL_NO_ERROR);
+
+      if(success)
+      {
+         alBufferData(malBuffer, mDataFormat, mData, mDataSize, mDataFreq);
+         success = (alGetError() == AL_NO_ERROR);
+         if(!success)
+            alDeleteBuffers(1, &malBuffer);
+      }
+
+      if(!success)
+         malBuffer = 0;
+   }
+   else
+      success = false;
+
+   delete [] mData;
+   mData = NULL;
+   return success;
+}
+
 /*!   The Read a WAV file from the given ResourceObject and initialize
       an alBuffer with it.
 */
 bool AudioBuffer::readWAV(ResourceObject *obj)
 {
+   Stream *stream = ResourceManager->openStream(obj);
+   if (!stream)
+      return false;
+
+   bool success = decodeWAV(stream);
+   ResourceManager->closeStream(stream);
+
+   if (success)
+   {
+      alBufferData(malBuffer, mDataFormat, mData, mDataSize, mDataFreq);
+      success = (alGetError() == AL_NO_ERROR);
+   }
+
+   delete [] mData;
+   mData = NULL;
+   return success;
+}
+
+/*!   Decode the samples of a WAV file from the stream, leaving them to be
+      handed to OpenAL.  Touches no OpenAL or resource manager state so
+      may be called on the audio thread.
+*/
+bool AudioBuffer::decodeWAV(Stream *stream)
+{
+   MEMORY_TAG_SCOPE(TagAudio);
+
    WAVChunkHdr chunkHdr;
    WAVFmtExHdr fmtExHdr;
    WAVFileHdr  fileHdr;
@@ -238,10 +350,6 @@ bool AudioBuffer::readWAV(ResourceObject *obj)
    ALsizei freq   = 22050;
    ALboolean loop = AL_FALSE;
 
-   Stream *stream = ResourceManager->openStream(obj);
-   if (!stream)
-      return false;
-
    stream->read(4, &fileHdr.id[0]);
    stream->read(&fileHdr.size);
    stream->read(4, &fileHdr.type[0]);
@@ -351,13 +459,13 @@ bool AudioBuffer::readWAV(ResourceObject *obj)
       chunkRemaining = chunkHdr.size + (chunkHdr.size&1);
    }
 
-   ResourceManager->closeStream(stream);
-   if (data)
-   {
-      alBufferData(malBuffer, format, data, size, freq);
-      delete [] data;
-      return (alGetError() == AL_NO_ERROR);
-   }
+   if (!data)
+      return false;
 
-   return false;
+   delete [] mData;
+   mData = data;
+   mDataSize = size;
+   mDataFormat = format;
+   mDataFreq = freq;
+   return true;
 }
\ No newline at end of file
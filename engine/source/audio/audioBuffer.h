@@ -44,14 +44,26 @@ private:
    bool              mLoading;
    ALuint            malBuffer;
 
+   // decoded samples waiting to be handed to OpenAL
+   char             *mData;
+   ALsizei           mDataSize;
+   ALenum            mDataFormat;
+   ALsizei           mDataFreq;
+
    bool readRIFFchunk(Stream &s, const char *seekLabel, U32 *size);
    bool readWAV(ResourceObject *obj);
+   bool decodeWAV(Stream *stream);
+   bool uploadDecoded(bool success);
 
 public:
    AudioBuffer(StringTableEntry filename);
    ~AudioBuffer();
    ALuint getALBuffer();
    bool isLoading() {return(mLoading);}
+   bool isLoaded() {return(!mLoading && malBuffer != 0);}
+
+   /// Start loading the buffer on the audio thread, or load it now if there isn't one.
+   void loadAsync();
 
    static Resource<AudioBuffer> find(const char *filename);
    static ResourceInstance* construct(Stream& stream);
@@ -42,6 +42,10 @@
 #include "audio/audioAsset.h"
 #endif
 
+#ifndef _AUDIO_THREAD_H_
+#include "audio/audioThread.h"
+#endif
+
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/iOSStreamSource.h"
 #endif
@@ -202,6 +206,9 @@ ConsoleFunction(alGetString, const char *, 2, 2, "( ALEnum ) Use the alGetString
       return "";
    }
 
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    return (const char*)alGetString(e);
 }
 
@@ -606,6 +613,9 @@ ConsoleFunction(alGetListeneri, S32, 2, 2, "( ALEnum ) Use the al*GetListener* f
       return(0);
    }
 
+   MutexHandle alLock;
+   alLock.lock(AudioThread::getALLock(), true);
+
    S32 value;
    alGetListeneri(e, &value);
    return(value);
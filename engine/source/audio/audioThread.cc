@@ -0,0 +1,241 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/audioThread.h"
+
+#ifndef _AUDIOBUFFER_H_
+#include "audio/audioBuffer.h"
+#endif
+
+#ifndef _RESMANAGER_H_
+#include "io/resource/resourceManager.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+AudioThread* AudioThread::smAudioThread = NULL;
+Mutex AudioThread::smALLock;
+
+//-----------------------------------------------------------------------------
+
+AudioThread::AudioThread( StreamUpdateFunction streamUpdate, const U32 period ) :
+    Thread( 0, NULL, false ),
+    mStreamUpdate( streamUpdate ),
+    mPeriod( period )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+AudioThread::~AudioThread()
+{
+    // Abandon any outstanding loads.
+    for ( U32 index = 0; index < (U32)mLoadQueue.size(); ++index )
+    {
+        LoadRequest* pRequest = mLoadQueue[index];
+        ResourceManager->closeStream( pRequest->mStream );
+        pRequest->mBuffer->uploadDecoded( false );
+        delete pRequest;
+    }
+
+    mLoadQueue.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioThread::create( StreamUpdateFunction streamUpdate, const U32 period )
+{
+    AssertFatal( smAudioThread == NULL, "AudioThread::create() - The audio thread is already running." );
+
+    smAudioThread = new AudioThread( streamUpdate, period );
+    smAudioThread->start();
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioThread::destroy( void )
+{
+    if ( smAudioThread == NULL )
+        return;
+
+    smAudioThread->stop();
+    smAudioThread->join();
+
+    delete smAudioThread;
+    smAudioThread = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioThread::run( void* arg )
+{
+    while( !checkForStop() )
+    {
+        if ( mStreamUpdate != NULL )
+            mStreamUpdate();
+
+        // Decode a buffer between stream updates and only sleep when idle.
+        if ( !decodeNext() )
+            Platform::sleep( mPeriod );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioThread::queueLoad( AudioBuffer* pBuffer, Stream* pStream )
+{
+    LoadRequest* pRequest = new LoadRequest;
+    pRequest->mBuffer = pBuffer;
+    pRequest->mStream = pStream;
+    pRequest->mState = LoadQueued;
+    pRequest->mSuccess = false;
+
+    mLoadLock.lock();
+    mLoadQueue.push_back( pRequest );
+    mLoadLock.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+bool AudioThread::decodeNext( void )
+{
+    LoadRequest* pRequest = NULL;
+
+    mLoadLock.lock();
+    for ( U32 index = 0; index < (U32)mLoadQueue.size(); ++index )
+    {
+        if ( mLoadQueue[index]->mState == LoadQueued )
+        {
+            pRequest = mLoadQueue[index];
+            pRequest->mState = LoadDecoding;
+            break;
+        }
+    }
+    mLoadLock.unlock();
+
+    if ( pRequest == NULL )
+        return false;
+
+    // The request is ours until it is marked as done.
+    const bool success = pRequest->mBuffer->decodeWAV( pRequest->mStream );
+
+    mLoadLock.lock();
+    pRequest->mSuccess = success;
+    pRequest->mState = LoadDone;
+    mLoadLock.unlock();
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioThread::processLoads( void )
+{
+    static Vector<LoadRequest*> completed;
+
+    completed.clear();
+
+    mLoadLock.lock();
+    for ( S32 index = mLoadQueue.size() - 1; index >= 0; --index )
+    {
+        if ( mLoadQueue[index]->mState == LoadDone )
+        {
+            completed.push_back( mLoadQueue[index] );
+            mLoadQueue.erase( index );
+        }
+    }
+    mLoadLock.unlock();
+
+    for ( U32 index = 0; index < (U32)completed.size(); ++index )
+        completeLoad( completed[index] );
+}
+
+//-----------------------------------------------------------------------------
+
+AudioThread::LoadRequest* AudioThread::claimLoad( AudioBuffer* pBuffer )
+{
+    while( true )
+    {
+        bool decoding = false;
+
+        mLoadLock.lock();
+        for ( U32 index = 0; index < (U32)mLoadQueue.size(); ++index )
+        {
+            LoadRequest* pRequest = mLoadQueue[index];
+            if ( pRequest->mBuffer != pBuffer )
+                continue;
+
+            // Wait for the thread to finish with it.
+            if ( pRequest->mState == LoadDecoding )
+            {
+                decoding = true;
+                break;
+            }
+
+            mLoadQueue.erase( index );
+            mLoadLock.unlock();
+            return pRequest;
+        }
+        mLoadLock.unlock();
+
+        if ( !decoding )
+            return NULL;
+
+        Platform::sleep( 1 );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioThread::completeLoad( LoadRequest* pRequest )
+{
+    ResourceManager->closeStream( pRequest->mStream );
+    pRequest->mBuffer->uploadDecoded( pRequest->mSuccess );
+    delete pRequest;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioThread::finishLoad( AudioBuffer* pBuffer )
+{
+    LoadRequest* pRequest = claimLoad( pBuffer );
+    if ( pRequest == NULL )
+        return;
+
+    // Decode it here rather than wait for the thread to get to it.
+    if ( pRequest->mState == LoadQueued )
+        pRequest->mSuccess = pBuffer->decodeWAV( pRequest->mStream );
+
+    completeLoad( pRequest );
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioThread::cancelLoad( AudioBuffer* pBuffer )
+{
+    LoadRequest* pRequest = claimLoad( pBuffer );
+    if ( pRequest == NULL )
+        return;
+
+    ResourceManager->closeStream( pRequest->mStream );
+    delete pRequest;
+}
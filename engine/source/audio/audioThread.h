@@ -0,0 +1,115 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIO_THREAD_H_
+#define _AUDIO_THREAD_H_
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class AudioBuffer;
+class Stream;
+
+//-----------------------------------------------------------------------------
+
+/// The audio worker thread.
+///
+/// The thread refills the streaming sources on its own schedule, so a slow frame
+/// cannot starve a stream, and decodes sample buffers in the background so loading a
+/// sound does not stall the main thread.
+///
+/// Streams are serviced through a callback supplied by the audio system, which must
+/// hold the OpenAL lock while it refills them.  OpenAL error state is per context,
+/// so every OpenAL call on the main thread must hold the lock too.  Decoded buffers
+/// are handed to OpenAL on the main thread by processLoads().
+class AudioThread : public Thread
+{
+public:
+    typedef void (*StreamUpdateFunction)( void );
+
+private:
+    enum LoadState
+    {
+        LoadQueued,
+        LoadDecoding,
+        LoadDone
+    };
+
+    struct LoadRequest
+    {
+        AudioBuffer*    mBuffer;
+        Stream*         mStream;
+        LoadState       mState;
+        bool            mSuccess;
+    };
+
+    Mutex                   mLoadLock;
+    Vector<LoadRequest*>    mLoadQueue;
+    StreamUpdateFunction    mStreamUpdate;
+    U32                     mPeriod;
+
+    static AudioThread*     smAudioThread;
+    static Mutex            smALLock;
+
+    AudioThread( StreamUpdateFunction streamUpdate, const U32 period );
+    virtual ~AudioThread();
+
+    bool decodeNext( void );
+    LoadRequest* claimLoad( AudioBuffer* pBuffer );
+    void completeLoad( LoadRequest* pRequest );
+
+public:
+    virtual void run( void* arg = 0 );
+
+    /// Start the audio thread, servicing streams every period milliseconds.
+    static void create( StreamUpdateFunction streamUpdate, const U32 period );
+
+    /// Stop the audio thread, abandoning any outstanding loads.
+    static void destroy( void );
+
+    /// Get the audio thread or NULL if it isn't running.
+    static inline AudioThread* get( void )        { return smAudioThread; }
+
+    /// Get the lock held around OpenAL calls and changes to the streams.
+    static inline Mutex* getALLock( void )        { return &smALLock; }
+
+    /// Queue a buffer to be decoded from the stream.  The stream is closed once the load completes.
+    void queueLoad( AudioBuffer* pBuffer, Stream* pStream );
+
+    /// Hand the buffers that have finished decoding to OpenAL.  Main thread only, holding the OpenAL lock.
+    void processLoads( void );
+
+    /// Block until the buffer has loaded.  Main thread only.
+    void finishLoad( AudioBuffer* pBuffer );
+
+    /// Abandon the load of a buffer that is being destroyed.  Main thread only.
+    void cancelLoad( AudioBuffer* pBuffer );
+};
+
+#endif // _AUDIO_THREAD_H_
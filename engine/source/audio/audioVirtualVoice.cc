@@ -0,0 +1,207 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "audio/audioVirtualVoice.h"
+
+//-----------------------------------------------------------------------------
+
+void AudioVirtualVoice::clear( void )
+{
+    mHandle = NULL_AUDIOHANDLE;
+    mBuffer = NULL;
+    dMemset( &mDescription, 0, sizeof(Audio::Description) );
+    mEnvironment = NULL;
+    mPosition.set( 0.0f, 0.0f, 0.0f );
+    mDirection.set( 0.0f, 1.0f, 0.0f );
+    mVolume = 0.0f;
+    mDuration = 0;
+    mStartTime = 0;
+    mCullTime = 0;
+    mScore = 0.0f;
+    mPlaying = false;
+    mLoading = false;
+    mListIndex = -1;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AudioVirtualVoice::getOffset( const U32 time ) const
+{
+    U32 elapsed = getElapsed( time );
+
+    if ( mDuration != 0 )
+        elapsed = mDescription.mIsLooping ? elapsed % mDuration : getMin( elapsed, mDuration );
+
+    return elapsed / 1000.0f;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AudioVirtualVoice::updateScore( const Point3F& listener, const F32* pChannelVolumes )
+{
+    mScore = mVolume;
+
+    // Approximate the distance attenuation.
+    if ( mDescription.mIs3D )
+    {
+        const F32 distance = (mPosition - listener).magnitudeSafe();
+        const F32 minDistance = mDescription.mReferenceDistance;
+        const F32 maxDistance = mDescription.mMaxDistance;
+
+        if ( distance >= maxDistance )
+            mScore = 0.0f;
+        else if ( distance > minDistance )
+            mScore *= (maxDistance - distance) / (maxDistance - minDistance);
+    }
+
+    mScore *= pChannelVolumes[mDescription.mVolumeChannel] * mDescription.mPriority;
+
+    return mScore;
+}
+
+//-----------------------------------------------------------------------------
+
+AudioVirtualVoiceList::~AudioVirtualVoiceList()
+{
+    clear();
+
+    for ( U32 index = 0; index < (U32)mFreeVoices.size(); ++index )
+        delete mFreeVoices[index];
+}
+
+//-----------------------------------------------------------------------------
+
+AudioVirtualVoice* AudioVirtualVoiceList::create( const AUDIOHANDLE handle )
+{
+    AssertFatal( find( handle ) == NULL, "AudioVirtualVoiceList::create() - Handle already has a voice." );
+
+    AudioVirtualVoice* pVoice;
+    if ( mFreeVoices.size() > 0 )
+    {
+        pVoice = mFreeVoices.last();
+        mFreeVoices.pop_back();
+    }
+    else
+    {
+        pVoice = new AudioVirtualVoice();
+    }
+
+    pVoice->mHandle = handle;
+    pVoice->mListIndex = mVoices.size();
+    mVoices.push_back( pVoice );
+    mHandleIndex.insert( handle, pVoice );
+
+    return pVoice;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioVirtualVoiceList::destroy( AudioVirtualVoice* pVoice )
+{
+    AssertFatal( pVoice->mListIndex >= 0 && mVoices[pVoice->mListIndex] == pVoice, "AudioVirtualVoiceList::destroy() - Voice is not in the list." );
+
+    // Move the last voice into the slot.
+    const S32 index = pVoice->mListIndex;
+    mVoices.erase_fast( index );
+    if ( index < mVoices.size() )
+        mVoices[index]->mListIndex = index;
+
+    mHandleIndex.erase( pVoice->mHandle );
+
+    pVoice->clear();
+    mFreeVoices.push_back( pVoice );
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioVirtualVoiceList::clear( void )
+{
+    while( mVoices.size() > 0 )
+        destroy( mVoices.last() );
+}
+
+//-----------------------------------------------------------------------------
+
+AudioVirtualVoice* AudioVirtualVoiceList::find( const AUDIOHANDLE handle ) const
+{
+    typeHandleHash::const_iterator itr = mHandleIndex.find( handle );
+    return itr == mHandleIndex.end() ? NULL : itr->value;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AudioVirtualVoiceList::retireFinished( const U32 time )
+{
+    U32 retired = 0;
+
+    // Walk backwards as destroying moves the last voice into the slot.
+    for ( S32 index = mVoices.size() - 1; index >= 0; --index )
+    {
+        AudioVirtualVoice* pVoice = mVoices[index];
+        if ( pVoice->isFinished( time ) )
+        {
+            destroy( pVoice );
+            retired++;
+        }
+    }
+
+    return retired;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareVoiceScore( const void* a, const void* b )
+{
+    const F32 scoreA = (*(const AudioVirtualVoice* const*)a)->mScore;
+    const F32 scoreB = (*(const AudioVirtualVoice* const*)b)->mScore;
+
+    // Highest score first.
+    return scoreA < scoreB ? 1 : scoreA > scoreB ? -1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void AudioVirtualVoiceList::getPromotionCandidates( const U32 time, const Point3F& listener, const F32* pChannelVolumes, const F32 minScore, const U32 minCullPeriod, Vector<AudioVirtualVoice*>& candidates )
+{
+    candidates.clear();
+
+    for ( U32 index = 0; index < (U32)mVoices.size(); ++index )
+    {
+        AudioVirtualVoice* pVoice = mVoices[index];
+
+        // Voices that haven't been played or loaded yet stay virtual.
+        if ( !pVoice->mPlaying || pVoice->mLoading )
+            continue;
+
+        // Don't thrash voices that have only just lost their source.
+        if ( pVoice->mCullTime != 0 && (time - pVoice->mCullTime) < minCullPeriod )
+            continue;
+
+        if ( pVoice->updateScore( listener, pChannelVolumes ) <= minScore )
+            continue;
+
+        candidates.push_back( pVoice );
+    }
+
+    if ( candidates.size() > 1 )
+        dQsort( candidates.address(), candidates.size(), sizeof(AudioVirtualVoice*), compareVoiceScore );
+}
@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _AUDIO_VIRTUAL_VOICE_H_
+#define _AUDIO_VIRTUAL_VOICE_H_
+
+#ifndef _PLATFORMAUDIO_H_
+#include "platform/platformAudio.h"
+#endif
+
+#ifndef _AUDIOBUFFER_H_
+#include "audio/audioBuffer.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A sound that is logically playing but has no OpenAL source.
+///
+/// The voice keeps everything needed to start it on a source later and tracks its
+/// playback position against the real time so that, when promoted, it resumes where
+/// it would have been had it been audible all along.
+struct AudioVirtualVoice
+{
+    AUDIOHANDLE             mHandle;
+    Resource<AudioBuffer>   mBuffer;
+    Audio::Description      mDescription;
+    AudioSampleEnvironment* mEnvironment;
+    Point3F                 mPosition;
+    Point3F                 mDirection;
+    F32                     mVolume;            ///< Un-attenuated gain.
+    U32                     mDuration;          ///< Length of the buffer in milliseconds.
+    U32                     mStartTime;         ///< Real time at which the voice was at the start of the buffer.
+    U32                     mCullTime;          ///< Real time at which the voice lost its source.
+    F32                     mScore;             ///< Audibility scaled by priority.
+    bool                    mPlaying;           ///< False until the voice has been played.
+    bool                    mLoading;           ///< True while the buffer is loading on the audio thread.
+    S32                     mListIndex;         ///< Slot in the owning list.
+
+    AudioVirtualVoice() { clear(); }
+
+    void clear( void );
+
+    inline U32 getElapsed( const U32 time ) const       { return mPlaying ? time - mStartTime : 0; }
+    inline bool isFinished( const U32 time ) const      { return mPlaying && !mDescription.mIsLooping && mDuration != 0 && getElapsed( time ) >= mDuration; }
+
+    /// Get the playback position in seconds, wrapping for looping voices.
+    F32 getOffset( const U32 time ) const;
+
+    /// Update the score from the listener position and the channel volumes.
+    F32 updateScore( const Point3F& listener, const F32* pChannelVolumes );
+};
+
+//-----------------------------------------------------------------------------
+
+/// The virtual voices indexed by their handles.
+///
+/// Voices are pooled so thousands can be created and retired without touching the heap.
+class AudioVirtualVoiceList
+{
+private:
+    typedef HashMap<AUDIOHANDLE, AudioVirtualVoice*> typeHandleHash;
+
+    Vector<AudioVirtualVoice*>  mVoices;
+    Vector<AudioVirtualVoice*>  mFreeVoices;
+    typeHandleHash              mHandleIndex;
+
+public:
+    AudioVirtualVoiceList() {}
+    ~AudioVirtualVoiceList();
+
+    AudioVirtualVoice* create( const AUDIOHANDLE handle );
+    void destroy( AudioVirtualVoice* pVoice );
+    void clear( void );
+
+    AudioVirtualVoice* find( const AUDIOHANDLE handle ) const;
+
+    inline U32 size( void ) const                               { return mVoices.size(); }
+    inline AudioVirtualVoice* operator[]( const U32 index ) const { return mVoices[index]; }
+
+    /// Destroy the voices that have played to the end.
+    U32 retireFinished( const U32 time );
+
+    /// Score the playing voices and collect those that may take a source, highest score first.
+    void getPromotionCandidates( const U32 time, const Point3F& listener, const F32* pChannelVolumes, const F32 minScore, const U32 minCullPeriod, Vector<AudioVirtualVoice*>& candidates );
+};
+
+#endif // _AUDIO_VIRTUAL_VOICE_H_
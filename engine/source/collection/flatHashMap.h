@@ -0,0 +1,554 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _FLATHASHMAP_H_
+#define _FLATHASHMAP_H_
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+/// A flat HashMap template class.
+///
+/// The map class maps between a key and an associated value and has the same
+/// interface as HashMap.  Entries are stored in a single power-of-two sized table
+/// and collisions are resolved with Robin Hood linear probing, so there is no
+/// allocation per entry and a lookup walks contiguous memory rather than a chain.
+/// Erasing shifts the following entries back so no tombstones are left behind.
+///
+/// Unlike HashMap, entries move when the table grows or an entry is erased so
+/// insert() and erase() invalidate iterators and references to values.  Clearing
+/// the map keeps the table so maps that are refilled every tick don't reallocate.
+/// @ingroup UtilContainers
+template<typename Key, typename Value>
+class FlatHashMap
+{
+public:
+   struct Pair {
+      Key  key;
+      Value value;
+      Pair() {}
+      Pair(Key k,Value v): key(k), value(v) {}
+   };
+
+private:
+   enum
+   {
+      MinCapacity = 8,                 ///< Smallest table allocated
+      MaxLoadPercent = 60,             ///< Load at which the table grows
+      NoSlot = 0xFFFFFFFF              ///< Slot of end(), independent of the table size
+   };
+
+   struct Slot {
+      U32 mHash;                       ///< Hash of the entry, zero if the slot is empty
+      Pair mPair;                      ///< Entry, only constructed if the slot is used
+   };
+
+   Slot* mSlots;                       ///< Hash table
+   U32 mCapacity;                      ///< Number of slots, a power of two
+   U32 mShift;                         ///< Shift from a hash to its ideal slot
+   U32 mSize;                          ///< Number of keys in the table
+
+   static U32 _hash(const Key& key);
+   U32 _slot(U32 hash) const;
+   U32 _distance(U32 hash, U32 slot) const;
+   U32 _find(const Key& key) const;
+   U32 _insert(U32 hash, const Pair& pair);
+   U32 _next(U32 slot) const;
+   void _reserve(U32 size);
+   void _rehash(U32 capacity);
+   void _erase(U32 slot);
+   void _destroy();
+
+public:
+   // iterator support
+   template<typename U, typename M>
+   class _Iterator {
+      friend class FlatHashMap;
+      M* mMap;
+      U32 mSlot;
+   public:
+      typedef U  ValueType;
+      typedef U* Pointer;
+      typedef U& Reference;
+
+      _Iterator()
+      {
+         mMap = 0;
+         mSlot = 0;
+      }
+
+      _Iterator(M* map,U32 slot)
+      {
+         mMap = map;
+         mSlot = slot;
+      }
+
+      _Iterator& operator++()
+      {
+         mSlot = mMap->_next(mSlot + 1);
+         return *this;
+      }
+
+      _Iterator operator++(int)
+      {
+         _Iterator itr(*this);
+         ++(*this);
+         return itr;
+      }
+
+      Value getValue() {
+         if( mMap && mSlot != NoSlot ) {
+            return mMap->mSlots[mSlot].mPair.value;
+         }
+         return (Value)(0);
+      }
+
+      bool operator==(const _Iterator& b) const
+      {
+         return mMap == b.mMap && mSlot == b.mSlot;
+      }
+
+      bool operator!=(const _Iterator& b) const
+      {
+         return !(*this == b);
+      }
+
+      U* operator->() const
+      {
+         return &mMap->mSlots[mSlot].mPair;
+      }
+
+      U& operator*() const
+      {
+         return mMap->mSlots[mSlot].mPair;
+      }
+   };
+
+   // Types
+   typedef Pair        ValueType;
+   typedef Pair&       Reference;
+   typedef const Pair& ConstReference;
+   typedef S32         DifferenceType;
+   typedef U32         SizeType;
+
+   typedef _Iterator<Pair,FlatHashMap>  iterator;
+   typedef _Iterator<const Pair,const FlatHashMap>  const_iterator;
+
+   // Initialization
+   FlatHashMap();
+   ~FlatHashMap();
+   FlatHashMap(const FlatHashMap& p);
+
+   // Management
+   U32  size() const;                  ///< Return the number of elements
+   U32  tableSize() const;             ///< Return the number of slots in the table
+   void clear();                       ///< Empty the map, keeping the table
+   void resize(U32 size);              ///< Size the table to hold the given number of elements
+   bool isEmpty() const;               ///< Returns true if the map is empty
+
+   // Insert & erase elements
+   iterator insert(const Key& key, const Value&); // Documented below...
+   void erase(iterator);               ///< Erase the given entry
+   void erase(const Key& key);         ///< Erase the key from the map
+
+   // Lookup
+   iterator find(const Key&);          ///< Find entry for the given key
+   const_iterator find(const Key&) const;    ///< Find entry for the given key
+   bool contains(const Key&) const;    ///< Returns true if the key is in the map
+
+   // Forward iterator access
+   iterator       begin();             ///< iterator to first element
+   const_iterator begin() const;       ///< iterator to first element
+   iterator       end();               ///< iterator to last element + 1
+   const_iterator end() const;         ///< iterator to last element + 1
+
+   // Operators
+   Value& operator[](const Key&);      ///< Index using the given key. If the key is not currently in the map it is added.
+   void operator=(const FlatHashMap& p);
+};
+
+
+template<typename Key, typename Value> FlatHashMap<Key,Value>::FlatHashMap()
+{
+   mSlots = 0;
+   mCapacity = 0;
+   mShift = 32;
+   mSize = 0;
+}
+
+template<typename Key, typename Value> FlatHashMap<Key,Value>::FlatHashMap(const FlatHashMap& p)
+{
+   mSlots = 0;
+   mCapacity = 0;
+   mShift = 32;
+   mSize = 0;
+   *this = p;
+}
+
+template<typename Key, typename Value> FlatHashMap<Key,Value>::~FlatHashMap()
+{
+   _destroy();
+}
+
+
+//-----------------------------------------------------------------------------
+
+/// Hash the key.
+/// The key hash is scrambled with a Fibonacci multiply and the table is indexed by
+/// the top bits of the result, so sequential ids and aligned pointers, whose low
+/// bits are alike, spread evenly across a power-of-two table.  Zero marks an empty
+/// slot so is never returned.
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::_hash(const Key& key)
+{
+   const U32 hash = Hash::hash(key) * 0x9E3779B9;
+   return hash ? hash : 1;
+}
+
+/// The ideal slot for the hash.
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::_slot(U32 hash) const
+{
+   return hash >> mShift;
+}
+
+/// Distance of the slot from the ideal slot for the hash.
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::_distance(U32 hash, U32 slot) const
+{
+   return (slot - _slot(hash)) & (mCapacity - 1);
+}
+
+/// Find the slot holding the key, or NoSlot if it isn't in the map.
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::_find(const Key& key) const
+{
+   if (!mSize)
+      return NoSlot;
+
+   const U32 hash = _hash(key);
+   const U32 mask = mCapacity - 1;
+   for (U32 slot = _slot(hash), distance = 0;; slot = (slot + 1) & mask, distance++)
+   {
+      const U32 slotHash = mSlots[slot].mHash;
+      if (slotHash == hash && tKeyCompare::equals<Key>( mSlots[slot].mPair.key, key ))
+         return slot;
+
+      // The key would have displaced any entry closer to its ideal slot.
+      if (!slotHash || _distance(slotHash, slot) < distance)
+         return NoSlot;
+   }
+}
+
+/// Insert a pair whose key isn't in the map, returning the slot it ends up in.
+/// Entries further from their ideal slot take the place of those closer to
+/// theirs, which keeps probe lengths short and even.
+template<typename Key, typename Value>
+U32 FlatHashMap<Key,Value>::_insert(U32 hash, const Pair& pair)
+{
+   const U32 mask = mCapacity - 1;
+   U32 result = NoSlot;
+   Pair carry(pair);
+
+   for (U32 slot = _slot(hash), distance = 0;; slot = (slot + 1) & mask, distance++)
+   {
+      const U32 slotHash = mSlots[slot].mHash;
+      if (!slotHash)
+      {
+         constructInPlace(&mSlots[slot].mPair, &carry);
+         mSlots[slot].mHash = hash;
+         mSize++;
+         return result == NoSlot ? slot : result;
+      }
+
+      const U32 slotDistance = _distance(slotHash, slot);
+      if (slotDistance < distance)
+      {
+         // Take the slot and carry on inserting the entry we displaced.
+         Pair displaced(mSlots[slot].mPair);
+         mSlots[slot].mPair = carry;
+         carry = displaced;
+         mSlots[slot].mHash = hash;
+         hash = slotHash;
+         distance = slotDistance;
+
+         if (result == NoSlot)
+            result = slot;
+      }
+   }
+}
+
+template<typename Key, typename Value>
+U32 FlatHashMap<Key,Value>::_next(U32 slot) const
+{
+   for (; slot < mCapacity; slot++)
+      if (mSlots[slot].mHash)
+         return slot;
+   return NoSlot;
+}
+
+/// Grow the table so it can hold the given number of elements.
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::_reserve(U32 size)
+{
+   if (size * 100 <= mCapacity * MaxLoadPercent)
+      return;
+
+   U32 capacity = mCapacity ? mCapacity : MinCapacity;
+   while (size * 100 > capacity * MaxLoadPercent)
+      capacity <<= 1;
+
+   _rehash(capacity);
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::_rehash(U32 capacity)
+{
+   AssertFatal((capacity & (capacity - 1)) == 0, "FlatHashMap::_rehash() - Capacity must be a power of two.");
+
+   Slot* slots = mSlots;
+   const U32 currentCapacity = mCapacity;
+
+   mSlots = (Slot*)dMalloc(capacity * sizeof(Slot));
+   for (U32 i = 0; i < capacity; i++)
+      mSlots[i].mHash = 0;
+   mCapacity = capacity;
+   mShift = 32;
+   for (U32 i = capacity; i > 1; i >>= 1)
+      mShift--;
+   mSize = 0;
+
+   for (U32 i = 0; i < currentCapacity; i++)
+      if (slots[i].mHash)
+      {
+         _insert(slots[i].mHash, slots[i].mPair);
+         destructInPlace(&slots[i].mPair);
+      }
+
+   dFree(slots);
+}
+
+/// Erase the entry in the slot, shifting back the entries that follow it
+/// until one is found in its ideal slot.
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::_erase(U32 slot)
+{
+   const U32 mask = mCapacity - 1;
+
+   destructInPlace(&mSlots[slot].mPair);
+   mSlots[slot].mHash = 0;
+   mSize--;
+
+   for (U32 next = (slot + 1) & mask; mSlots[next].mHash && _distance(mSlots[next].mHash, next); next = (next + 1) & mask)
+   {
+      constructInPlace(&mSlots[slot].mPair, &mSlots[next].mPair);
+      mSlots[slot].mHash = mSlots[next].mHash;
+      destructInPlace(&mSlots[next].mPair);
+      mSlots[next].mHash = 0;
+      slot = next;
+   }
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::_destroy()
+{
+   for (U32 i = 0; i < mCapacity; i++)
+      if (mSlots[i].mHash)
+         destructInPlace(&mSlots[i].mPair);
+
+   dFree(mSlots);
+   mSlots = 0;
+   mCapacity = 0;
+   mShift = 32;
+   mSize = 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// management
+
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::size() const
+{
+   return mSize;
+}
+
+template<typename Key, typename Value>
+inline U32 FlatHashMap<Key,Value>::tableSize() const
+{
+   return mCapacity;
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::clear()
+{
+   if (!mSize)
+      return;
+
+   for (U32 i = 0; i < mCapacity; i++)
+      if (mSlots[i].mHash)
+      {
+         destructInPlace(&mSlots[i].mPair);
+         mSlots[i].mHash = 0;
+      }
+   mSize = 0;
+}
+
+/// Size the table for an estimated number of elements.
+/// Normally this function is used to avoid growing the table repeatedly when the
+/// number of elements that will be inserted is known in advance.  The table is
+/// never shrunk.
+template<typename Key, typename Value>
+inline void FlatHashMap<Key,Value>::resize(U32 size)
+{
+   _reserve(size);
+}
+
+template<typename Key, typename Value>
+inline bool FlatHashMap<Key,Value>::isEmpty() const
+{
+   return mSize == 0;
+}
+
+
+//-----------------------------------------------------------------------------
+// add & remove elements
+
+/// Insert the key value pair but don't allow duplicates.
+/// The map class does not allow duplicates keys. If the key already exists in
+/// the map the function will fail and return end().
+template<typename Key, typename Value>
+typename FlatHashMap<Key,Value>::iterator FlatHashMap<Key,Value>::insert(const Key& key, const Value& x)
+{
+   if (_find(key) != NoSlot)
+      return end();
+
+   _reserve(mSize + 1);
+   return iterator(this,_insert(_hash(key),Pair(key,x)));
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::erase(const Key& key)
+{
+   const U32 slot = _find(key);
+   if (slot != NoSlot)
+      _erase(slot);
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::erase(iterator node)
+{
+   AssertFatal(node.mMap == this && node.mSlot < mCapacity && mSlots[node.mSlot].mHash, "FlatHashMap::erase() - Invalid iterator.");
+   _erase(node.mSlot);
+}
+
+
+//-----------------------------------------------------------------------------
+// Searching
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::iterator FlatHashMap<Key,Value>::find(const Key& key)
+{
+   return iterator(this,_find(key));
+}
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::const_iterator FlatHashMap<Key,Value>::find(const Key& key) const
+{
+   return const_iterator(this,_find(key));
+}
+
+template<typename Key, typename Value>
+inline bool FlatHashMap<Key,Value>::contains(const Key& key) const
+{
+   return _find(key) != NoSlot;
+}
+
+
+//-----------------------------------------------------------------------------
+// iterator access
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::iterator FlatHashMap<Key,Value>::begin()
+{
+   return iterator(this,_next(0));
+}
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::const_iterator FlatHashMap<Key,Value>::begin() const
+{
+   return const_iterator(this,_next(0));
+}
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::iterator FlatHashMap<Key,Value>::end()
+{
+   return iterator(this,NoSlot);
+}
+
+template<typename Key, typename Value>
+inline typename FlatHashMap<Key,Value>::const_iterator FlatHashMap<Key,Value>::end() const
+{
+   return const_iterator(this,NoSlot);
+}
+
+
+//-----------------------------------------------------------------------------
+// operators
+
+template<typename Key, typename Value>
+Value& FlatHashMap<Key,Value>::operator[](const Key& key)
+{
+   U32 slot = _find(key);
+   if (slot == NoSlot)
+   {
+      _reserve(mSize + 1);
+      slot = _insert(_hash(key),Pair(key,Value()));
+   }
+   return mSlots[slot].mPair.value;
+}
+
+template<typename Key, typename Value>
+void FlatHashMap<Key,Value>::operator=(const FlatHashMap& p)
+{
+   if (&p == this)
+      return;
+
+   _destroy();
+   if (!p.mCapacity)
+      return;
+
+   mSlots = (Slot*)dMalloc(p.mCapacity * sizeof(Slot));
+   mCapacity = p.mCapacity;
+   mShift = p.mShift;
+   mSize = p.mSize;
+
+   for (U32 i = 0; i < mCapacity; i++)
+   {
+      mSlots[i].mHash = p.mSlots[i].mHash;
+      if (mSlots[i].mHash)
+         constructInPlace(&mSlots[i].mPair, &p.mSlots[i].mPair);
+   }
+}
+
+#endif // _FLATHASHMAP_H_
@@ -454,6 +454,16 @@ typename HashTable<Key,Value>::iterator HashTable<Key,Value>::find(const Key& ke
    return iterator(this,0);
 }
 
+template<typename Key, typename Value>
+typename HashTable<Key,Value>::const_iterator HashTable<Key,Value>::find(const Key& key) const
+{
+   if (mTableSize)
+      for (Node* itr = mTable[_index(key)]; itr; itr = itr->mNext)
+         if ( tKeyCompare::equals<Key>( itr->mPair.key, key ) )
+            return const_iterator(this,itr);
+   return const_iterator(this,0);
+}
+
 template<typename Key, typename Value>
 S32 HashTable<Key,Value>::count(const Key& key)
 {
@@ -649,6 +659,12 @@ typename HashMap<Key,Value,Sequence>::iterator HashMap<Key,Value,Sequence>::find
    return mHashMap.find(key);
 }
 
+template<typename Key, typename Value, class Sequence>
+typename HashMap<Key,Value,Sequence>::const_iterator HashMap<Key,Value,Sequence>::find(const Key& key) const
+{
+   return mHashMap.find(key);
+}
+
 //-----------------------------------------------------------------------------
 // iterator access
 
@@ -52,7 +52,9 @@
 
 BehaviorComponent::BehaviorComponent() :
     mMasterBehaviorId( 1 ),
-    mpBehaviorFieldNames( NULL )
+    mpBehaviorFieldNames( NULL ),
+    mMethodRouteSequence( Namespace::mCacheSequence ),
+    mMethodRouteGeneration( 0 )
 {
     SIMSET_SET_ASSOCIATION( mBehaviors );
 }
@@ -191,6 +193,7 @@ bool BehaviorComponent::addBehavior( BehaviorInstance* bi )
 
     // Store behavior.
     mBehaviors.pushObject( bi );
+    invalidateMethodRoutes();
 
     // Notify if the behavior instance is destroyed.
     deleteNotify( bi );
@@ -216,6 +219,7 @@ bool BehaviorComponent::removeBehavior( BehaviorInstance *bi, bool deleteBehavio
         if( *itr == bi )
         {
             mBehaviors.removeObject( *itr );
+            invalidateMethodRoutes();
 
             // Perform callback if allowed.
             if( bi->isProperlyAdded() && bi->isMethod("onBehaviorRemove") )
@@ -281,7 +285,11 @@ bool BehaviorComponent::reOrder( BehaviorInstance *obj, U32 desiredIndex /* = 0
         return false;
 
     SimObject *target = mBehaviors.at( desiredIndex );
-    return mBehaviors.reOrder( obj, target );
+    if ( !mBehaviors.reOrder( obj, target ) )
+        return false;
+
+    invalidateMethodRoutes();
+    return true;
 }
 
 //-----------------------------------------------------------------------------
@@ -913,6 +921,86 @@ void BehaviorComponent::write( Stream &stream, U32 tabStop, U32 flags /* = 0 */
 
 //-----------------------------------------------------------------------------
 
+void BehaviorComponent::invalidateMethodRoutes( void )
+{
+    mMethodRoutes.clear();
+    mMethodRouteEntries.clear();
+    mMethodRouteGeneration++;
+}
+
+//-----------------------------------------------------------------------------
+
+BehaviorComponent::BehaviorMethodRoutes BehaviorComponent::getMethodRoutes( const char* pMethodName )
+{
+    // Flush the routes if the namespace cache has been trashed.
+    if ( mMethodRouteSequence != Namespace::mCacheSequence )
+    {
+        invalidateMethodRoutes();
+        mMethodRouteSequence = Namespace::mCacheSequence;
+    }
+
+    // Find the resolved routes.
+    typeMethodRouteHash::iterator routeItr = mMethodRoutes.find( pMethodName );
+    if ( routeItr != mMethodRoutes.end() )
+        return routeItr->value;
+
+    // Resolve the behaviors implementing the method.
+    // NOTE: Methods no behavior implements are cached too so that they are cheap.
+    StringTableEntry methodName = StringTable->insert( pMethodName );
+
+    BehaviorMethodRoutes routes;
+    routes.mFirst = mMethodRouteEntries.size();
+
+    for( SimSet::iterator itr = mBehaviors.begin(); itr != mBehaviors.end(); ++itr )
+    {
+        BehaviorInstance* pBehavior = static_cast<BehaviorInstance*>( *itr );
+
+        // Use the BehaviorInstance's namespace
+        Namespace* pNamespace = pBehavior->getNamespace();
+        if ( pNamespace == NULL )
+            continue;
+
+        Namespace::Entry* pEntry = pNamespace->lookup( methodName );
+        if ( pEntry == NULL )
+            continue;
+
+        BehaviorMethodRoute route;
+        route.mpBehavior = pBehavior;
+        route.mpEntry = pEntry;
+        mMethodRouteEntries.push_back( route );
+    }
+
+    routes.mCount = mMethodRouteEntries.size() - routes.mFirst;
+    mMethodRoutes.insert( methodName, routes );
+
+    return routes;
+}
+
+//-----------------------------------------------------------------------------
+
+// Needed to be able to directly call execute on a Namespace::Entry
+extern ExprEvalState gEvalState;
+
+const char* BehaviorComponent::executeMethodRoute( const BehaviorMethodRoute& route, U32 argc, char* argv[] )
+{
+    AssertFatal( route.mpBehavior->getId() > 0, "Invalid id for behavior component" );
+
+    // Set %this to our BehaviorInstance's Object ID
+    argv[1] = const_cast<char *>( route.mpBehavior->getIdString() );
+
+    // Change the Current Console object, execute, restore Object
+    SimObject *save = gEvalState.thisObject;
+    gEvalState.thisObject = route.mpBehavior;
+
+    const char* result = route.mpEntry->execute( argc, const_cast<const char **>( argv ), &gEvalState );
+
+    gEvalState.thisObject = save;
+
+    return result;
+}
+
+//-----------------------------------------------------------------------------
+
 bool BehaviorComponent::handlesConsoleMethod( const char *fname, S32 *routingId )
 {
 
@@ -925,14 +1013,10 @@ bool BehaviorComponent::handlesConsoleMethod( const char *fname, S32 *routingId
    if( dStricmp( fname, "delete" ) == 0 )
       return Parent::handlesConsoleMethod( fname, routingId );
 
-   for( SimSet::iterator nItr = mBehaviors.begin(); nItr != mBehaviors.end(); nItr++ )
+   if( !mBehaviors.empty() && getMethodRoutes( fname ).mCount > 0 )
    {
-      SimObject *pComponent = dynamic_cast<SimObject *>(*nItr);
-      if( pComponent != NULL && pComponent->isMethod( fname ) )
-      {
-         *routingId = -2; // -2 denotes method on component
-         return true;
-      }
+      *routingId = -2; // -2 denotes method on component
+      return true;
    }
 
    // Let parent handle it
@@ -941,14 +1025,17 @@ bool BehaviorComponent::handlesConsoleMethod( const char *fname, S32 *routingId
 
 //-----------------------------------------------------------------------------
 
-// Needed to be able to directly call execute on a Namespace::Entry
-extern ExprEvalState gEvalState;
-
 const char *BehaviorComponent::callOnBehaviors( U32 argc, const char *argv[] )
 {   
     if( mBehaviors.empty() )   
         return Parent::callOnBehaviors( argc, argv );
-      
+
+    // If no behavior implements the method then pass along to the parent DynamicConsoleMethodComponent
+    // to deal with it.  If the parent cannot handle the message it will return an error string.
+    const BehaviorMethodRoutes routes = getMethodRoutes( argv[0] );
+    if ( routes.mCount == 0 )
+        return Parent::callOnBehaviors( argc, argv );
+
     // Copy the arguments to avoid weird clobbery situations.
     FrameTemp<char *> argPtrs (argc);
    
@@ -959,46 +1046,9 @@ const char *BehaviorComponent::callOnBehaviors( U32 argc, const char *argv[] )
         dStrcpy( argPtrs[i], argv[i] );
     }
 
-    // Walk backwards through the list just as with components
-    const char* result = "";
-    bool handled = false;
-    for( SimSet::iterator i = (mBehaviors.end()-1); i >= mBehaviors.begin(); i-- )
-    {
-        BehaviorInstance *pBehavior = dynamic_cast<BehaviorInstance *>( *i );
-        AssertFatal( pBehavior, "BehaviorComponent::callOnBehaviors - Bad behavior instance in list." );
-        AssertFatal( pBehavior->getId() > 0, "Invalid id for behavior component" );
-
-        // Use the BehaviorInstance's namespace
-        Namespace *pNamespace = pBehavior->getNamespace();
-        if(!pNamespace)
-            continue;
-
-        // Lookup the Callback Namespace entry and then splice callback
-        const char *cbName = StringTable->insert(argv[0]);
-        Namespace::Entry *pNSEntry = pNamespace->lookup(cbName);
-        if( pNSEntry )
-        {
-            // Set %this to our BehaviorInstance's Object ID
-            argPtrs[1] = const_cast<char *>( pBehavior->getIdString() );
-
-            // Change the Current Console object, execute, restore Object
-            SimObject *save = gEvalState.thisObject;
-            gEvalState.thisObject = pBehavior;
-
-            result = pNSEntry->execute(argc, const_cast<const char **>( ~argPtrs ), &gEvalState);
-
-            gEvalState.thisObject = save;
-            handled = true;
-            break;
-        }
-    }
-
-    // If this wasn't handled by a behavior above then pass along to the parent DynamicConsoleMethodComponent
-    // to deal with it.  If the parent cannot handle the message it will return an error string.
-    if (!handled)
-    {
-        result = Parent::callOnBehaviors( argc, argv );
-    }
+    // The last behavior implementing the method handles it just as with components.
+    const BehaviorMethodRoute route = mMethodRouteEntries[routes.mFirst + routes.mCount - 1];
+    const char* result = executeMethodRoute( route, argc, ~argPtrs );
 
     // Clean up.
     FrameAllocator::setWaterMark( strdupWatermark );
@@ -1012,43 +1062,31 @@ const char *BehaviorComponent::_callMethod( U32 argc, const char *argv[], bool c
 {   
     if( mBehaviors.empty() )   
         return Parent::_callMethod( argc, argv, callThis );
-     
-    // Copy the arguments to avoid weird clobbery situations.
-    FrameTemp<char *> argPtrs (argc);
-   
+
     U32 strdupWatermark = FrameAllocator::getWaterMark();
-    for( U32 i = 0; i < argc; i++ )
-    {
-        argPtrs[i] = reinterpret_cast<char *>( FrameAllocator::alloc( dStrlen( argv[i] ) + 1 ) );
-        dStrcpy( argPtrs[i], argv[i] );
-    }
 
-    for( SimSet::iterator i = mBehaviors.begin(); i != mBehaviors.end(); i++ )
+    const BehaviorMethodRoutes routes = getMethodRoutes( argv[0] );
+    if ( routes.mCount > 0 )
     {
-        BehaviorInstance *pBehavior = dynamic_cast<BehaviorInstance *>( *i );
-        AssertFatal( pBehavior, "BehaviorComponent::_callMethod - Bad behavior instance in list." );
-        AssertFatal( pBehavior->getId() > 0, "Invalid id for behavior component" );
-
-        // Use the BehaviorInstance's namespace
-        Namespace *pNamespace = pBehavior->getNamespace();
-        if(!pNamespace)
-            continue;
+        // Copy the arguments to avoid weird clobbery situations.
+        FrameTemp<char *> argPtrs (argc);
 
-        // Lookup the Callback Namespace entry and then splice callback
-        const char *cbName = StringTable->insert(argv[0]);
-        Namespace::Entry *pNSEntry = pNamespace->lookup(cbName);
-        if( pNSEntry )
+        for( U32 i = 0; i < argc; i++ )
         {
-            // Set %this to our BehaviorInstance's Object ID
-            argPtrs[1] = const_cast<char *>( pBehavior->getIdString() );
-
-            // Change the Current Console object, execute, restore Object
-            SimObject *save = gEvalState.thisObject;
-            gEvalState.thisObject = pBehavior;
+            argPtrs[i] = reinterpret_cast<char *>( FrameAllocator::alloc( dStrlen( argv[i] ) + 1 ) );
+            dStrcpy( argPtrs[i], argv[i] );
+        }
 
-            pNSEntry->execute(argc, const_cast<const char **>( ~argPtrs ), &gEvalState);
+        // Call every behavior implementing the method in order.
+        const U32 routeGeneration = mMethodRouteGeneration;
+        for( U32 index = 0; index < routes.mCount; ++index )
+        {
+            const BehaviorMethodRoute route = mMethodRouteEntries[routes.mFirst + index];
+            executeMethodRoute( route, argc, ~argPtrs );
 
-            gEvalState.thisObject = save;
+            // Stop if the behaviors were changed by the call as the remaining routes may be stale.
+            if ( routeGeneration != mMethodRouteGeneration )
+                break;
         }
     }
 
@@ -31,6 +31,10 @@
 #include "behaviorInstance.h"
 #endif
 
+#ifndef _FLATHASHMAP_H_
+#include "collection/flatHashMap.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class BehaviorComponent : public DynamicConsoleMethodComponent
@@ -47,6 +51,27 @@ private:
 
     Vector<StringTableEntry>* mpBehaviorFieldNames;
 
+    /// A behavior implementing a method.
+    struct BehaviorMethodRoute
+    {
+        BehaviorInstance*   mpBehavior;
+        Namespace::Entry*   mpEntry;
+    };
+
+    /// The behaviors implementing a method as a range of the method route entries, in behavior order.
+    struct BehaviorMethodRoutes
+    {
+        U32 mFirst;
+        U32 mCount;
+    };
+
+    /// Method routing.
+    /// NOTE: Routes are resolved on demand per method and flushed when the behaviors or namespaces change.
+    typedef FlatHashMap<StringTableEntry, BehaviorMethodRoutes> typeMethodRouteHash;
+    typeMethodRouteHash mMethodRoutes;
+    Vector<BehaviorMethodRoute> mMethodRouteEntries;
+    U32 mMethodRouteSequence;
+    U32 mMethodRouteGeneration;
 
 public:
     /// A behavior port connection.
@@ -87,6 +112,10 @@ protected:
 private:
     void destroyBehaviorOutputConnections( BehaviorInstance* pOutputBehavior );
     void destroyBehaviorInputConnections( BehaviorInstance* pInputBehavior );
+
+    void invalidateMethodRoutes( void );
+    BehaviorMethodRoutes getMethodRoutes( const char* pMethodName );
+    const char* executeMethodRoute( const BehaviorMethodRoute& route, U32 argc, char* argv[] );
     
   
 public:
@@ -104,6 +104,10 @@ struct ExprNode : StmtNode
    virtual U32 precompile(TypeReq type) = 0;
    virtual U32 compile(U32 *codeStream, U32 ip, TypeReq type) = 0;
    virtual TypeReq getPreferredType() = 0;
+
+   /// Compiles the expression as a test followed by a conditional jump to the target.
+   /// Takes the size of the test expression plus two words.
+   virtual U32 compileJump(U32 *codeStream, U32 ip, bool integer, bool jumpIf, U32 target);
 };
 
 struct ReturnStmtNode : StmtNode
@@ -187,6 +191,7 @@ struct IntBinaryExprNode : BinaryExprNode
    U32 precompile(TypeReq type);
    U32 compile(U32 *codeStream, U32 ip, TypeReq type);
    TypeReq getPreferredType();
+   U32 compileJump(U32 *codeStream, U32 ip, bool integer, bool jumpIf, U32 target);
 };
 
 struct StreqExprNode : BinaryExprNode
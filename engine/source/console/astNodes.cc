@@ -236,6 +236,17 @@ U32 ExprNode::compileStmt(U32 *codeStream, U32 ip, U32, U32)
    return compile(codeStream, ip, TypeReqNone);
 }
 
+U32 ExprNode::compileJump(U32 *codeStream, U32 ip, bool integer, bool jumpIf, U32 target)
+{
+   ip = compile(codeStream, ip, integer ? TypeReqUInt : TypeReqFloat);
+   if(integer)
+      codeStream[ip++] = jumpIf ? OP_JMPIF : OP_JMPIFNOT;
+   else
+      codeStream[ip++] = jumpIf ? OP_JMPIFF : OP_JMPIFFNOT;
+   codeStream[ip++] = target;
+   return ip;
+}
+
 //------------------------------------------------------------
 
 U32 ReturnStmtNode::precompileStmt(U32)
@@ -315,12 +326,9 @@ U32 IfStmtNode::compileStmt(U32 *codeStream, U32 ip, U32 continuePoint, U32 brea
    U32 start = ip;
    addBreakLine(ip);
 
-   ip = testExpr->compile(codeStream, ip, integer ? TypeReqUInt : TypeReqFloat);
-   codeStream[ip++] = integer ? OP_JMPIFNOT : OP_JMPIFFNOT;
-
    if(elseBlock)
    {
-      codeStream[ip++] = start + elseOffset;
+      ip = testExpr->compileJump(codeStream, ip, integer, false, start + elseOffset);
       ip = compileBlock(ifBlock, codeStream, ip, continuePoint, breakPoint);
       codeStream[ip++] = OP_JMP;
       codeStream[ip++] = start + endifOffset;
@@ -328,7 +336,7 @@ U32 IfStmtNode::compileStmt(U32 *codeStream, U32 ip, U32 continuePoint, U32 brea
    }
    else
    {
-      codeStream[ip++] = start + endifOffset;
+      ip = testExpr->compileJump(codeStream, ip, integer, false, start + endifOffset);
       ip = compileBlock(ifBlock, codeStream, ip, continuePoint, breakPoint);
    }
    return ip;
@@ -409,9 +417,7 @@ U32 LoopStmtNode::compileStmt(U32 *codeStream, U32 ip, U32, U32)
 
    if(!isDoLoop)
    {
-      ip = testExpr->compile(codeStream, ip, integer ? TypeReqUInt : TypeReqFloat);
-      codeStream[ip++] = integer ? OP_JMPIFNOT : OP_JMPIFFNOT;
-      codeStream[ip++] = start + breakOffset;
+      ip = testExpr->compileJump(codeStream, ip, integer, false, start + breakOffset);
    }
 
    // Compile internals of loop.
@@ -420,10 +426,7 @@ U32 LoopStmtNode::compileStmt(U32 *codeStream, U32 ip, U32, U32)
    if(endLoopExpr)
       ip = endLoopExpr->compile(codeStream, ip, TypeReqNone);
 
-   ip = testExpr->compile(codeStream, ip, integer ? TypeReqUInt : TypeReqFloat);
-
-   codeStream[ip++] = integer ? OP_JMPIF : OP_JMPIFF;
-   codeStream[ip++] = start + loopBlockStartOffset;
+   ip = testExpr->compileJump(codeStream, ip, integer, true, start + loopBlockStartOffset);
 
    return ip;
 }
@@ -456,9 +459,8 @@ U32 ConditionalExprNode::precompile(TypeReq type)
 
 U32 ConditionalExprNode::compile(U32 *codeStream, U32 ip, TypeReq type)
 {
-   ip = testExpr->compile(codeStream, ip, integer ? TypeReqUInt : TypeReqFloat);
-   codeStream[ip++] = integer ? OP_JMPIFNOT : OP_JMPIFFNOT;
-   U32 jumpElseIp = ip++;
+   ip = testExpr->compileJump(codeStream, ip, integer, false, 0);
+   U32 jumpElseIp = ip - 1;
    ip = trueExpr->compile(codeStream, ip, type);
    codeStream[ip++] = OP_JMP;
    U32 jumpEndIp = ip++;
@@ -612,6 +614,20 @@ TypeReq IntBinaryExprNode::getPreferredType()
    return TypeReqUInt;
 }
 
+U32 IntBinaryExprNode::compileJump(U32 *codeStream, U32 ip, bool integer, bool jumpIf, U32 target)
+{
+   // Only float compares tested as integers are fused with the jump.
+   if(!integer || subType != TypeReqFloat || !gSuperInstructions)
+      return ExprNode::compileJump(codeStream, ip, integer, jumpIf, target);
+
+   ip = right->compile(codeStream, ip, subType);
+   ip = left->compile(codeStream, ip, subType);
+   codeStream[ip++] = jumpIf ? OP_JMPIF_CMP : OP_JMPIFNOT_CMP;
+   codeStream[ip++] = operand;
+   codeStream[ip++] = target;
+   return ip;
+}
+
 //------------------------------------------------------------
 
 U32 StreqExprNode::precompile(TypeReq type)
@@ -790,6 +806,10 @@ U32 VarNode::precompile(TypeReq type)
    // OP_LOADVAR (type)
 
    // else
+   // OP_LOADVAR_IDENT (type)
+   // varName
+
+   // or without superinstructions
    // OP_SETCURVAR
    // varName
    // OP_LOADVAR (type)
@@ -800,7 +820,7 @@ U32 VarNode::precompile(TypeReq type)
    if(arrayIndex)
       return arrayIndex->precompile(TypeReqString) + 6;
    else
-      return 3;
+      return gSuperInstructions ? 2 : 3;
 }
 
 U32 VarNode::compile(U32 *codeStream, U32 ip, TypeReq type)
@@ -808,6 +828,25 @@ U32 VarNode::compile(U32 *codeStream, U32 ip, TypeReq type)
    if(type == TypeReqNone)
       return ip;
 
+   if(!arrayIndex && gSuperInstructions)
+   {
+      switch(type)
+      {
+      case TypeReqUInt:
+         codeStream[ip++] = OP_LOADVAR_UINT_IDENT;
+         break;
+      case TypeReqFloat:
+         codeStream[ip++] = OP_LOADVAR_FLT_IDENT;
+         break;
+      default:
+         codeStream[ip++] = OP_LOADVAR_STR_IDENT;
+         break;
+      }
+      codeStream[ip] = STEtoU32(varName, ip);
+      ip++;
+      return ip;
+   }
+
    codeStream[ip++] = arrayIndex ? OP_LOADIMMED_IDENT : OP_SETCURVAR;
    codeStream[ip] = STEtoU32(varName, ip);
    ip++;
@@ -818,6 +857,7 @@ U32 VarNode::compile(U32 *codeStream, U32 ip, TypeReq type)
       codeStream[ip++] = OP_REWIND_STR;
       codeStream[ip++] = OP_SETCURVAR_ARRAY;
    }
+
    switch(type)
    {
    case TypeReqUInt:
@@ -1356,8 +1396,8 @@ U32 SlotAccessNode::precompile(TypeReq type)
    // eval object expression sub + 3 (op_setCurField + OP_SETCUROBJECT)
    size += objectExpr->precompile(TypeReqString) + 3;
 
-   // get field in desired type:
-   return size + 1;
+   // get field in desired type (fused with op_setCurField without an array):
+   return (arrayExpr || !gSuperInstructions) ? size + 1 : size;
 }
 
 U32 SlotAccessNode::compile(U32 *codeStream, U32 ip, TypeReq type)
@@ -1372,6 +1412,25 @@ U32 SlotAccessNode::compile(U32 *codeStream, U32 ip, TypeReq type)
    }
    ip = objectExpr->compile(codeStream, ip, TypeReqString);
    codeStream[ip++] = OP_SETCUROBJECT;
+
+   if(!arrayExpr && gSuperInstructions)
+   {
+      switch(type)
+      {
+      case TypeReqUInt:
+         codeStream[ip++] = OP_LOADFIELD_UINT_IDENT;
+         break;
+      case TypeReqFloat:
+         codeStream[ip++] = OP_LOADFIELD_FLT_IDENT;
+         break;
+      default:
+         codeStream[ip++] = OP_LOADFIELD_STR_IDENT;
+         break;
+      }
+      codeStream[ip] = STEtoU32(slotName, ip);
+      ip++;
+      return ip;
+   }
    
    codeStream[ip++] = OP_SETCURFIELD;
    
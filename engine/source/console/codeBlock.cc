@@ -31,6 +31,10 @@
 #include "debug/remote/RemoteDebuggerBase.h"
 #endif
 
+#ifndef _SCRIPT_PROFILER_H_
+#include "console/scriptProfiler.h"
+#endif
+
 using namespace Compiler;
 
 bool           CodeBlock::smInFunction = false;
@@ -129,6 +133,11 @@ void CodeBlock::clearAllBreaks()
 {
    if(!lineBreakPairs)
       return;
+#ifdef TORQUE_ENABLE_PROFILER
+   // The script profiler needs all the breaks kept in place.
+   if(ScriptProfiler::isProfilingLines())
+      return;
+#endif
    for(U32 i = 0; i < lineBreakPairCount; i++)
    {
       U32 *p = lineBreakPairs + i * 2;
@@ -140,6 +149,10 @@ void CodeBlock::clearBreakpoint(U32 lineNumber)
 {
    if(!lineBreakPairs)
       return;
+#ifdef TORQUE_ENABLE_PROFILER
+   if(ScriptProfiler::isProfilingLines())
+      return;
+#endif
    for(U32 i = 0; i < lineBreakPairCount; i++)
    {
       U32 *p = lineBreakPairs + i * 2;
@@ -346,9 +359,89 @@ void CodeBlock::calcBreakList()
    RemoteDebuggerBase* pRemoteDebugger = RemoteDebuggerBase::getRemoteDebugger();
    if ( pRemoteDebugger != NULL )
        pRemoteDebugger->addCodeBlock( this );
+
+#ifdef TORQUE_ENABLE_PROFILER
+   // Let the script profiler see every line.
+   if ( ScriptProfiler::isProfilingLines() )
+      setAllBreaks();
+#endif
 }
 
+//-------------------------------------------------------------------------
+
+/// Reads little-endian code block data from memory.
+class CodeBlockReader
+{
+public:
+   CodeBlockReader(const U8 *data, const U32 dataSize) : mData(data), mEnd(data + dataSize) {}
+
+   /// Returns whether the specified number of elements can be read.
+   bool canRead(const U32 count, const U32 elementSize) const
+   {
+      return count <= (U32)(mEnd - mData) / elementSize;
+   }
+
+   bool read(const U32 size, void *buffer)
+   {
+      if(!canRead(size, 1))
+      {
+         dMemset(buffer, 0, size);
+         mData = mEnd;
+         return false;
+      }
+
+      dMemcpy(buffer, mData, size);
+      mData += size;
+      return true;
+   }
+
+   template<class T> bool read(T *value)
+   {
+      T temp;
+      const bool ok = read(sizeof(T), &temp);
+      *value = convertLEndianToHost(temp);
+      return ok;
+   }
+
+   template<class T> bool readArray(const U32 count, T *values)
+   {
+      if(!read(count * sizeof(T), values))
+         return false;
+
+#ifdef TORQUE_BIG_ENDIAN
+      for(U32 i = 0; i < count; i++)
+         values[i] = convertLEndianToHost(values[i]);
+#endif
+      return true;
+   }
+
+private:
+   const U8 *mData;
+   const U8 *mEnd;
+};
+
+//-------------------------------------------------------------------------
+
 bool CodeBlock::read(StringTableEntry fileName, Stream &st)
+{
+   // Read the rest of the stream in one go rather than a value at a time.
+   const U32 dataSize = st.getStreamSize() - st.getPosition();
+   U8 *data = new U8[dataSize];
+   if(!st.read(dataSize, data))
+   {
+      Con::errorf(ConsoleLogEntry::Script, "CodeBlock::read - Failed to read the compiled code for '%s'.", fileName);
+      delete [] data;
+      return false;
+   }
+
+   const bool ret = read(fileName, data, dataSize, false);
+   delete [] data;
+   return ret;
+}
+
+//-------------------------------------------------------------------------
+
+bool CodeBlock::read(StringTableEntry fileName, const U8 *data, const U32 dataSize, const bool expandedCode)
 {
    const StringTableEntry exePath = Platform::getMainDotCsDir();
    const StringTableEntry cwd = Platform::getCurrentDirectory();
@@ -391,75 +484,94 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
    //
    addToCodeList();
 
-   U32 globalSize,size,i;
-   st.read(&size);
-   if(size)
+   CodeBlockReader reader(data, dataSize);
+
+   U32 globalSize = 0,size,i;
+   reader.read(&size);
+   if(size && reader.canRead(size, 1))
    {
       globalSize = size;
       globalStrings = new char[size];
-      st.read(size, globalStrings);
+      reader.read(size, globalStrings);
    }
-   st.read(&size);
-   if(size)
+   reader.read(&size);
+   if(size && reader.canRead(size, 1))
    {
       functionStrings = new char[size];
-      st.read(size, functionStrings);
+      reader.read(size, functionStrings);
    }
-   st.read(&size);
-   if(size)
+   reader.read(&size);
+   if(size && reader.canRead(size, sizeof(F64)))
    {
       globalFloats = new F64[size];
-      for(U32 i = 0; i < size; i++)
-         st.read(&globalFloats[i]);
+      reader.readArray(size, globalFloats);
    }
-   st.read(&size);
-   if(size)
+   reader.read(&size);
+   if(size && reader.canRead(size, sizeof(F64)))
    {
       functionFloats = new F64[size];
-      for(U32 i = 0; i < size; i++)
-         st.read(&functionFloats[i]);
+      reader.readArray(size, functionFloats);
    }
    U32 codeSize;
-   st.read(&codeSize);
-   st.read(&lineBreakPairCount);
+   reader.read(&codeSize);
+   reader.read(&lineBreakPairCount);
+
+   // Every instruction takes at least one byte.
+   if(!reader.canRead(codeSize, 1) || !reader.canRead(lineBreakPairCount * 2, sizeof(U32)))
+   {
+      Con::errorf(ConsoleLogEntry::Script, "CodeBlock::read - Corrupt compiled code for '%s'.", fileName);
+      codeSize = 0;
+      lineBreakPairCount = 0;
+   }
 
    U32 totSize = codeSize + lineBreakPairCount * 2;
-   code = new U32[totSize];
+   code = new U32[totSize > 0 ? totSize : 1];
+   code[0] = OP_RETURN;
 
-   for(i = 0; i < codeSize; i++)
+   if(expandedCode)
    {
-      U8 b;
-      st.read(&b);
-      if(b == 0xFF)
-         st.read(&code[i]);
-      else
-         code[i] = b;
+      // The code has already been expanded to a word per instruction.
+      reader.readArray(codeSize, code);
+   }
+   else
+   {
+      for(i = 0; i < codeSize; i++)
+      {
+         U8 b;
+         reader.read(&b);
+         if(b == 0xFF)
+            reader.read(&code[i]);
+         else
+            code[i] = b;
+      }
    }
 
-   for(i = codeSize; i < totSize; i++)
-      st.read(&code[i]);
+   reader.readArray(lineBreakPairCount * 2, code + codeSize);
 
    lineBreakPairs = code + codeSize;
 
    // StringTable-ize our identifiers.
-   U32 identCount;
-   st.read(&identCount);
+   U32 identCount = 0;
+   reader.read(&identCount);
    while(identCount--)
    {
       U32 offset;
-      st.read(&offset);
+      if(!reader.read(&offset))
+         break;
       StringTableEntry ste;
       if(offset < globalSize)
          ste = StringTable->insert(globalStrings + offset);
       else
          ste = StringTable->EmptyString;
-      U32 count;
-      st.read(&count);
+      U32 count = 0;
+      reader.read(&count);
       while(count--)
       {
          U32 ip;
-         st.read(&ip);
-         code[ip] = *((U32 *) &ste);
+         if(!reader.read(&ip))
+            break;
+         if(ip < codeSize)
+            code[ip] = *((U32 *) &ste);
       }
    }
 
@@ -469,6 +581,69 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
    return true;
 }
 
+//-------------------------------------------------------------------------
+
+bool CodeBlock::expandCode(const U8 *data, const U32 dataSize, Stream &st)
+{
+   CodeBlockReader reader(data, dataSize);
+
+   // Copy the string and float tables.
+   for(U32 table = 0; table < 4; table++)
+   {
+      U32 size;
+      if(!reader.read(&size))
+         return false;
+
+      const U32 elementSize = table < 2 ? 1 : sizeof(F64);
+      if(!reader.canRead(size, elementSize))
+         return false;
+
+      st.write(size);
+      if(elementSize == 1)
+      {
+         char *buffer = new char[size > 0 ? size : 1];
+         reader.read(size, buffer);
+         st.write(size, buffer);
+         delete [] buffer;
+      }
+      else
+      {
+         for(U32 i = 0; i < size; i++)
+         {
+            F64 value;
+            reader.read(&value);
+            st.write(value);
+         }
+      }
+   }
+
+   U32 codeSize, lineBreakPairCount;
+   if(!reader.read(&codeSize) || !reader.read(&lineBreakPairCount))
+      return false;
+   st.write(codeSize);
+   st.write(lineBreakPairCount);
+
+   // Expand the code to a word per instruction.
+   for(U32 i = 0; i < codeSize; i++)
+   {
+      U8 b;
+      if(!reader.read(&b))
+         return false;
+
+      U32 value = b;
+      if(b == 0xFF && !reader.read(&value))
+         return false;
+
+      st.write(value);
+   }
+
+   // Copy the break info and identifiers.
+   U32 value;
+   while(reader.read(&value))
+      st.write(value);
+
+   return true;
+}
 
 bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, const char *script)
 {
@@ -105,6 +105,14 @@ public:
    const char *getFileLine(U32 ip);
 
    bool read(StringTableEntry fileName, Stream &st);
+
+   /// Reads a code block from memory.
+   /// @param expandedCode Whether the code has been expanded to a word per instruction.
+   bool read(StringTableEntry fileName, const U8 *data, const U32 dataSize, const bool expandedCode);
+
+   /// Writes a compiled code block (without the DSO version) with the code expanded to a word per instruction.
+   static bool expandCode(const U8 *data, const U32 dataSize, Stream &st);
+
    bool compile(const char *dsoName, StringTableEntry fileName, const char *script);
 
    void incRefCount();
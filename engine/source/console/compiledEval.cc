@@ -39,6 +39,7 @@
 #include "string/stringStack.h"
 #include "messaging/message.h"
 #include "memory/frameAllocator.h"
+#include "memory/memoryTracker.h"
 
 #include "debug/telnetDebugger.h"
 
@@ -46,6 +47,10 @@
 #include "debug/remote/RemoteDebuggerBase.h"
 #endif
 
+#ifndef _SCRIPT_PROFILER_H_
+#include "console/scriptProfiler.h"
+#endif
+
 using namespace Compiler;
 
 enum EvalConstants {
@@ -69,6 +74,44 @@ StringStack STR;
 U32 FLT = 0;
 U32 UINT = 0;
 
+// Threaded dispatch jumps from the end of an instruction straight to the next
+// one through a table of label addresses rather than going back around the
+// interpreter loop.  It relies on the "labels as values" compiler extension.
+// Instructions without a label are dispatched through the switch.
+#if defined(__GNUC__) && !defined(TORQUE_DISABLE_THREADED_DISPATCH)
+#define TORQUE_THREADED_DISPATCH
+#endif
+
+#ifdef TORQUE_THREADED_DISPATCH
+#define DISPATCH_LABEL(op)    label_##op:
+#define DISPATCH_NEXT         goto *dispatchTable[instruction = code[ip++]]
+#else
+#define DISPATCH_LABEL(op)
+#define DISPATCH_NEXT         break
+#endif
+
+// Evaluates a float compare instruction for the fused compare-and-jump instructions.
+static inline bool compareFloats(U32 compareOp, F64 left, F64 right)
+{
+   switch(compareOp)
+   {
+      case OP_CMPEQ:
+         return left == right;
+      case OP_CMPGR:
+         return left > right;
+      case OP_CMPGE:
+         return left >= right;
+      case OP_CMPLT:
+         return left < right;
+      case OP_CMPLE:
+         return left <= right;
+      case OP_CMPNE:
+         return left != right;
+      default:
+         return false;
+   }
+}
+
 static const char *getNamespaceList(Namespace *ns)
 {
    U32 size = 1;
@@ -449,6 +492,8 @@ static void setFieldComponent( SimObject* object, StringTableEntry field, const
 
 const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame)
 {
+   MEMORY_TAG_SCOPE(TagScript);
+
 #ifdef TORQUE_DEBUG
    U32 stackStart = STR.mStartStackSize;
 #endif
@@ -575,10 +620,102 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
    }
    const char * val;
 
+#ifdef TORQUE_ENABLE_PROFILER
+   // Grab the state of the script profiler here once so that
+   // entering and leaving are always balanced.
+   const bool scriptProfilerOn = ScriptProfiler::isEnabled();
+   if ( scriptProfilerOn )
+      ScriptProfiler::enterFunction( this, thisNamespace, thisFunctionName, packageName );
+#endif
+
    // The frame temp is used by the variable accessor ops (OP_SAVEFIELD_* and
    // OP_LOADFIELD_*) to store temporary values for the fields.
    static S32 VAL_BUFFER_SIZE = 1024;
    FrameTemp<char> valBuffer( VAL_BUFFER_SIZE );
+
+#ifdef TORQUE_THREADED_DISPATCH
+   static void *dispatchTable[OP_INVALID + 1];
+   static bool dispatchTableBuilt = false;
+   if(!dispatchTableBuilt)
+   {
+      for(U32 op = 0; op <= OP_INVALID; op++)
+         dispatchTable[op] = &&breakContinue;
+
+      dispatchTable[OP_JMPIFFNOT] = &&label_OP_JMPIFFNOT;
+      dispatchTable[OP_JMPIFNOT] = &&label_OP_JMPIFNOT;
+      dispatchTable[OP_JMPIFF] = &&label_OP_JMPIFF;
+      dispatchTable[OP_JMPIF] = &&label_OP_JMPIF;
+      dispatchTable[OP_JMPIFNOT_NP] = &&label_OP_JMPIFNOT_NP;
+      dispatchTable[OP_JMPIF_NP] = &&label_OP_JMPIF_NP;
+      dispatchTable[OP_JMP] = &&label_OP_JMP;
+      dispatchTable[OP_CMPEQ] = &&label_OP_CMPEQ;
+      dispatchTable[OP_CMPGR] = &&label_OP_CMPGR;
+      dispatchTable[OP_CMPGE] = &&label_OP_CMPGE;
+      dispatchTable[OP_CMPLT] = &&label_OP_CMPLT;
+      dispatchTable[OP_CMPLE] = &&label_OP_CMPLE;
+      dispatchTable[OP_CMPNE] = &&label_OP_CMPNE;
+      dispatchTable[OP_XOR] = &&label_OP_XOR;
+      dispatchTable[OP_MOD] = &&label_OP_MOD;
+      dispatchTable[OP_BITAND] = &&label_OP_BITAND;
+      dispatchTable[OP_BITOR] = &&label_OP_BITOR;
+      dispatchTable[OP_NOT] = &&label_OP_NOT;
+      dispatchTable[OP_NOTF] = &&label_OP_NOTF;
+      dispatchTable[OP_ONESCOMPLEMENT] = &&label_OP_ONESCOMPLEMENT;
+      dispatchTable[OP_SHR] = &&label_OP_SHR;
+      dispatchTable[OP_SHL] = &&label_OP_SHL;
+      dispatchTable[OP_AND] = &&label_OP_AND;
+      dispatchTable[OP_OR] = &&label_OP_OR;
+      dispatchTable[OP_ADD] = &&label_OP_ADD;
+      dispatchTable[OP_SUB] = &&label_OP_SUB;
+      dispatchTable[OP_MUL] = &&label_OP_MUL;
+      dispatchTable[OP_DIV] = &&label_OP_DIV;
+      dispatchTable[OP_NEG] = &&label_OP_NEG;
+      dispatchTable[OP_SETCURVAR] = &&label_OP_SETCURVAR;
+      dispatchTable[OP_SETCURVAR_CREATE] = &&label_OP_SETCURVAR_CREATE;
+      dispatchTable[OP_LOADVAR_UINT] = &&label_OP_LOADVAR_UINT;
+      dispatchTable[OP_LOADVAR_FLT] = &&label_OP_LOADVAR_FLT;
+      dispatchTable[OP_LOADVAR_STR] = &&label_OP_LOADVAR_STR;
+      dispatchTable[OP_SAVEVAR_UINT] = &&label_OP_SAVEVAR_UINT;
+      dispatchTable[OP_SAVEVAR_FLT] = &&label_OP_SAVEVAR_FLT;
+      dispatchTable[OP_SAVEVAR_STR] = &&label_OP_SAVEVAR_STR;
+      dispatchTable[OP_SETCURFIELD] = &&label_OP_SETCURFIELD;
+      dispatchTable[OP_LOADFIELD_UINT] = &&label_OP_LOADFIELD_UINT;
+      dispatchTable[OP_LOADFIELD_FLT] = &&label_OP_LOADFIELD_FLT;
+      dispatchTable[OP_LOADFIELD_STR] = &&label_OP_LOADFIELD_STR;
+      dispatchTable[OP_STR_TO_UINT] = &&label_OP_STR_TO_UINT;
+      dispatchTable[OP_STR_TO_FLT] = &&label_OP_STR_TO_FLT;
+      dispatchTable[OP_STR_TO_NONE] = &&label_OP_STR_TO_NONE;
+      dispatchTable[OP_FLT_TO_UINT] = &&label_OP_FLT_TO_UINT;
+      dispatchTable[OP_FLT_TO_STR] = &&label_OP_FLT_TO_STR;
+      dispatchTable[OP_FLT_TO_NONE] = &&label_OP_FLT_TO_NONE;
+      dispatchTable[OP_UINT_TO_FLT] = &&label_OP_UINT_TO_FLT;
+      dispatchTable[OP_UINT_TO_STR] = &&label_OP_UINT_TO_STR;
+      dispatchTable[OP_UINT_TO_NONE] = &&label_OP_UINT_TO_NONE;
+      dispatchTable[OP_LOADIMMED_UINT] = &&label_OP_LOADIMMED_UINT;
+      dispatchTable[OP_LOADIMMED_FLT] = &&label_OP_LOADIMMED_FLT;
+      dispatchTable[OP_LOADIMMED_STR] = &&label_OP_LOADIMMED_STR;
+      dispatchTable[OP_LOADIMMED_IDENT] = &&label_OP_LOADIMMED_IDENT;
+      dispatchTable[OP_ADVANCE_STR] = &&label_OP_ADVANCE_STR;
+      dispatchTable[OP_ADVANCE_STR_APPENDCHAR] = &&label_OP_ADVANCE_STR_APPENDCHAR;
+      dispatchTable[OP_ADVANCE_STR_COMMA] = &&label_OP_ADVANCE_STR_COMMA;
+      dispatchTable[OP_ADVANCE_STR_NUL] = &&label_OP_ADVANCE_STR_NUL;
+      dispatchTable[OP_REWIND_STR] = &&label_OP_REWIND_STR;
+      dispatchTable[OP_TERMINATE_REWIND_STR] = &&label_OP_TERMINATE_REWIND_STR;
+      dispatchTable[OP_COMPARE_STR] = &&label_OP_COMPARE_STR;
+      dispatchTable[OP_PUSH] = &&label_OP_PUSH;
+      dispatchTable[OP_PUSH_FRAME] = &&label_OP_PUSH_FRAME;
+      dispatchTable[OP_LOADVAR_UINT_IDENT] = &&label_OP_LOADVAR_UINT_IDENT;
+      dispatchTable[OP_LOADVAR_FLT_IDENT] = &&label_OP_LOADVAR_FLT_IDENT;
+      dispatchTable[OP_LOADVAR_STR_IDENT] = &&label_OP_LOADVAR_STR_IDENT;
+      dispatchTable[OP_LOADFIELD_UINT_IDENT] = &&label_OP_LOADFIELD_UINT_IDENT;
+      dispatchTable[OP_LOADFIELD_FLT_IDENT] = &&label_OP_LOADFIELD_FLT_IDENT;
+      dispatchTable[OP_LOADFIELD_STR_IDENT] = &&label_OP_LOADFIELD_STR_IDENT;
+      dispatchTable[OP_JMPIF_CMP] = &&label_OP_JMPIF_CMP;
+      dispatchTable[OP_JMPIFNOT_CMP] = &&label_OP_JMPIFNOT_CMP;
+
+      dispatchTableBuilt = true;
+   }
+#endif
    
    for(;;)
    {
@@ -910,177 +1047,177 @@ breakContinue:
             break;
          }
 
-         case OP_JMPIFFNOT:
+         case OP_JMPIFFNOT: DISPATCH_LABEL(OP_JMPIFFNOT)
             if(floatStack[FLT--])
             {
                ip++;
-               break;
+               DISPATCH_NEXT;
             }
             ip = code[ip];
-            break;
-         case OP_JMPIFNOT:
+            DISPATCH_NEXT;
+         case OP_JMPIFNOT: DISPATCH_LABEL(OP_JMPIFNOT)
             if(intStack[UINT--])
             {
                ip++;
-               break;
+               DISPATCH_NEXT;
             }
             ip = code[ip];
-            break;
-         case OP_JMPIFF:
+            DISPATCH_NEXT;
+         case OP_JMPIFF: DISPATCH_LABEL(OP_JMPIFF)
             if(!floatStack[FLT--])
             {
                ip++;
-               break;
+               DISPATCH_NEXT;
             }
             ip = code[ip];
-            break;
-         case OP_JMPIF:
+            DISPATCH_NEXT;
+         case OP_JMPIF: DISPATCH_LABEL(OP_JMPIF)
             if(!intStack[UINT--])
             {
                ip ++;
-               break;
+               DISPATCH_NEXT;
             }
             ip = code[ip];
-            break;
-         case OP_JMPIFNOT_NP:
+            DISPATCH_NEXT;
+         case OP_JMPIFNOT_NP: DISPATCH_LABEL(OP_JMPIFNOT_NP)
             if(intStack[UINT])
             {
                UINT--;
                ip++;
-               break;
+               DISPATCH_NEXT;
             }
             ip = code[ip];
-            break;
-         case OP_JMPIF_NP:
+            DISPATCH_NEXT;
+         case OP_JMPIF_NP: DISPATCH_LABEL(OP_JMPIF_NP)
             if(!intStack[UINT])
             {
                UINT--;
                ip++;
-               break;
+               DISPATCH_NEXT;
             }
             ip = code[ip];
-            break;
-         case OP_JMP:
+            DISPATCH_NEXT;
+         case OP_JMP: DISPATCH_LABEL(OP_JMP)
             ip = code[ip];
-            break;
+            DISPATCH_NEXT;
          case OP_RETURN:
             goto execFinished;
-         case OP_CMPEQ:
+         case OP_CMPEQ: DISPATCH_LABEL(OP_CMPEQ)
             intStack[UINT+1] = bool(floatStack[FLT] == floatStack[FLT-1]);
             UINT++;
             FLT -= 2;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_CMPGR:
+         case OP_CMPGR: DISPATCH_LABEL(OP_CMPGR)
             intStack[UINT+1] = bool(floatStack[FLT] > floatStack[FLT-1]);
             UINT++;
             FLT -= 2;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_CMPGE:
+         case OP_CMPGE: DISPATCH_LABEL(OP_CMPGE)
             intStack[UINT+1] = bool(floatStack[FLT] >= floatStack[FLT-1]);
             UINT++;
             FLT -= 2;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_CMPLT:
+         case OP_CMPLT: DISPATCH_LABEL(OP_CMPLT)
             intStack[UINT+1] = bool(floatStack[FLT] < floatStack[FLT-1]);
             UINT++;
             FLT -= 2;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_CMPLE:
+         case OP_CMPLE: DISPATCH_LABEL(OP_CMPLE)
             intStack[UINT+1] = bool(floatStack[FLT] <= floatStack[FLT-1]);
             UINT++;
             FLT -= 2;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_CMPNE:
+         case OP_CMPNE: DISPATCH_LABEL(OP_CMPNE)
             intStack[UINT+1] = bool(floatStack[FLT] != floatStack[FLT-1]);
             UINT++;
             FLT -= 2;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_XOR:
+         case OP_XOR: DISPATCH_LABEL(OP_XOR)
             intStack[UINT-1] = intStack[UINT] ^ intStack[UINT-1];
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_MOD:
+         case OP_MOD: DISPATCH_LABEL(OP_MOD)
             if(  intStack[UINT-1] != 0 )
                intStack[UINT-1] = intStack[UINT] % intStack[UINT-1];
             else
                intStack[UINT-1] = 0;
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_BITAND:
+         case OP_BITAND: DISPATCH_LABEL(OP_BITAND)
             intStack[UINT-1] = intStack[UINT] & intStack[UINT-1];
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_BITOR:
+         case OP_BITOR: DISPATCH_LABEL(OP_BITOR)
             intStack[UINT-1] = intStack[UINT] | intStack[UINT-1];
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_NOT:
+         case OP_NOT: DISPATCH_LABEL(OP_NOT)
             intStack[UINT] = !intStack[UINT];
-            break;
+            DISPATCH_NEXT;
 
-         case OP_NOTF:
+         case OP_NOTF: DISPATCH_LABEL(OP_NOTF)
             intStack[UINT+1] = !floatStack[FLT];
             FLT--;
             UINT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_ONESCOMPLEMENT:
+         case OP_ONESCOMPLEMENT: DISPATCH_LABEL(OP_ONESCOMPLEMENT)
             intStack[UINT] = ~intStack[UINT];
-            break;
+            DISPATCH_NEXT;
 
-         case OP_SHR:
+         case OP_SHR: DISPATCH_LABEL(OP_SHR)
             intStack[UINT-1] = intStack[UINT] >> intStack[UINT-1];
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_SHL:
+         case OP_SHL: DISPATCH_LABEL(OP_SHL)
             intStack[UINT-1] = intStack[UINT] << intStack[UINT-1];
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_AND:
+         case OP_AND: DISPATCH_LABEL(OP_AND)
             intStack[UINT-1] = intStack[UINT] && intStack[UINT-1];
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_OR:
+         case OP_OR: DISPATCH_LABEL(OP_OR)
             intStack[UINT-1] = intStack[UINT] || intStack[UINT-1];
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_ADD:
+         case OP_ADD: DISPATCH_LABEL(OP_ADD)
             floatStack[FLT-1] = floatStack[FLT] + floatStack[FLT-1];
             FLT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_SUB:
+         case OP_SUB: DISPATCH_LABEL(OP_SUB)
             floatStack[FLT-1] = floatStack[FLT] - floatStack[FLT-1];
             FLT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_MUL:
+         case OP_MUL: DISPATCH_LABEL(OP_MUL)
             floatStack[FLT-1] = floatStack[FLT] * floatStack[FLT-1];
             FLT--;
-            break;
-         case OP_DIV:
+            DISPATCH_NEXT;
+         case OP_DIV: DISPATCH_LABEL(OP_DIV)
             floatStack[FLT-1] = floatStack[FLT] / floatStack[FLT-1];
             FLT--;
-            break;
-         case OP_NEG:
+            DISPATCH_NEXT;
+         case OP_NEG: DISPATCH_LABEL(OP_NEG)
             floatStack[FLT] = -floatStack[FLT];
-            break;
+            DISPATCH_NEXT;
 
-         case OP_SETCURVAR:
+         case OP_SETCURVAR: DISPATCH_LABEL(OP_SETCURVAR)
             var = U32toSTE(code[ip]);
             ip++;
 
@@ -1098,9 +1235,9 @@ breakContinue:
             // won't inappropriately carry forward to following function decls.
             curFNDocBlock = NULL;
             curNSDocBlock = NULL;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_SETCURVAR_CREATE:
+         case OP_SETCURVAR_CREATE: DISPATCH_LABEL(OP_SETCURVAR_CREATE)
             var = U32toSTE(code[ip]);
             ip++;
 
@@ -1114,7 +1251,7 @@ breakContinue:
             // See OP_SETCURVAR for why we do this.
             curFNDocBlock = NULL;
             curNSDocBlock = NULL;
-            break;
+            DISPATCH_NEXT;
 
          case OP_SETCURVAR_ARRAY:
             var = STR.getSTValue();
@@ -1146,32 +1283,32 @@ breakContinue:
             curNSDocBlock = NULL;
             break;
 
-         case OP_LOADVAR_UINT:
+         case OP_LOADVAR_UINT: DISPATCH_LABEL(OP_LOADVAR_UINT)
             intStack[UINT+1] = gEvalState.getIntVariable();
             UINT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_LOADVAR_FLT:
+         case OP_LOADVAR_FLT: DISPATCH_LABEL(OP_LOADVAR_FLT)
             floatStack[FLT+1] = gEvalState.getFloatVariable();
             FLT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_LOADVAR_STR:
+         case OP_LOADVAR_STR: DISPATCH_LABEL(OP_LOADVAR_STR)
             val = gEvalState.getStringVariable();
             STR.setStringValue(val);
-            break;
+            DISPATCH_NEXT;
 
-         case OP_SAVEVAR_UINT:
+         case OP_SAVEVAR_UINT: DISPATCH_LABEL(OP_SAVEVAR_UINT)
             gEvalState.setIntVariable((S32)intStack[UINT]);
-            break;
+            DISPATCH_NEXT;
 
-         case OP_SAVEVAR_FLT:
+         case OP_SAVEVAR_FLT: DISPATCH_LABEL(OP_SAVEVAR_FLT)
             gEvalState.setFloatVariable(floatStack[FLT]);
-            break;
+            DISPATCH_NEXT;
 
-         case OP_SAVEVAR_STR:
+         case OP_SAVEVAR_STR: DISPATCH_LABEL(OP_SAVEVAR_STR)
             gEvalState.setStringVariable(STR.getStringValue());
-            break;
+            DISPATCH_NEXT;
 
          case OP_SETCUROBJECT:
             // Save the previous object for parsing vector fields.
@@ -1217,20 +1354,20 @@ breakContinue:
             curObject = currentNewObject;
             break;
 
-         case OP_SETCURFIELD:
+         case OP_SETCURFIELD: DISPATCH_LABEL(OP_SETCURFIELD)
             // Save the previous field for parsing vector fields.
             prevField = curField;
             dStrcpy( prevFieldArray, curFieldArray );
             curField = U32toSTE(code[ip]);
             curFieldArray[0] = 0;
             ip++;
-            break;
+            DISPATCH_NEXT;
 
          case OP_SETCURFIELD_ARRAY:
             dStrcpy(curFieldArray, STR.getStringValue());
             break;
 
-         case OP_LOADFIELD_UINT:
+         case OP_LOADFIELD_UINT: DISPATCH_LABEL(OP_LOADFIELD_UINT)
             if(curObject)
                intStack[UINT+1] = U32(dAtoi(curObject->getDataField(curField, curFieldArray)));
             else
@@ -1242,9 +1379,9 @@ breakContinue:
                intStack[UINT+1] = dAtoi( valBuffer );
             }
             UINT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_LOADFIELD_FLT:
+         case OP_LOADFIELD_FLT: DISPATCH_LABEL(OP_LOADFIELD_FLT)
             if(curObject)
                floatStack[FLT+1] = dAtof(curObject->getDataField(curField, curFieldArray));
             else
@@ -1255,9 +1392,9 @@ breakContinue:
                floatStack[FLT+1] = dAtof( valBuffer );
             }
             FLT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_LOADFIELD_STR:
+         case OP_LOADFIELD_STR: DISPATCH_LABEL(OP_LOADFIELD_STR)
             if(curObject)
             {
                val = curObject->getDataField(curField, curFieldArray);
@@ -1271,7 +1408,7 @@ breakContinue:
                STR.setStringValue( valBuffer );
             }
 
-            break;
+            DISPATCH_NEXT;
 
          case OP_SAVEFIELD_UINT:
             STR.setIntValue((U32)intStack[UINT]);
@@ -1311,60 +1448,60 @@ breakContinue:
             }
             break;
 
-         case OP_STR_TO_UINT:
+         case OP_STR_TO_UINT: DISPATCH_LABEL(OP_STR_TO_UINT)
             intStack[UINT+1] = STR.getIntValue();
             UINT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_STR_TO_FLT:
+         case OP_STR_TO_FLT: DISPATCH_LABEL(OP_STR_TO_FLT)
             floatStack[FLT+1] = STR.getFloatValue();
             FLT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_STR_TO_NONE:
+         case OP_STR_TO_NONE: DISPATCH_LABEL(OP_STR_TO_NONE)
             // This exists simply to deal with certain typecast situations.
-            break;
+            DISPATCH_NEXT;
 
-         case OP_FLT_TO_UINT:
+         case OP_FLT_TO_UINT: DISPATCH_LABEL(OP_FLT_TO_UINT)
             intStack[UINT+1] = (S64)floatStack[FLT];
             FLT--;
             UINT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_FLT_TO_STR:
+         case OP_FLT_TO_STR: DISPATCH_LABEL(OP_FLT_TO_STR)
             STR.setFloatValue(floatStack[FLT]);
             FLT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_FLT_TO_NONE:
+         case OP_FLT_TO_NONE: DISPATCH_LABEL(OP_FLT_TO_NONE)
             FLT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_UINT_TO_FLT:
+         case OP_UINT_TO_FLT: DISPATCH_LABEL(OP_UINT_TO_FLT)
             floatStack[FLT+1] = (F64)intStack[UINT];
             UINT--;
             FLT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_UINT_TO_STR:
+         case OP_UINT_TO_STR: DISPATCH_LABEL(OP_UINT_TO_STR)
             STR.setIntValue((U32)intStack[UINT]);
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_UINT_TO_NONE:
+         case OP_UINT_TO_NONE: DISPATCH_LABEL(OP_UINT_TO_NONE)
             UINT--;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_LOADIMMED_UINT:
+         case OP_LOADIMMED_UINT: DISPATCH_LABEL(OP_LOADIMMED_UINT)
             intStack[UINT+1] = code[ip++];
             UINT++;
-            break;
+            DISPATCH_NEXT;
 
-         case OP_LOADIMMED_FLT:
+         case OP_LOADIMMED_FLT: DISPATCH_LABEL(OP_LOADIMMED_FLT)
             floatStack[FLT+1] = curFloatTable[code[ip]];
             ip++;
             FLT++;
-            break;
+            DISPATCH_NEXT;
          case OP_TAG_TO_STR:
             code[ip-1] = OP_LOADIMMED_STR;
             // it's possible the string has already been converted
@@ -1374,9 +1511,9 @@ breakContinue:
                dSprintf(curStringTable + code[ip] + 1, 7, "%d", id);
                *(curStringTable + code[ip]) = StringTagPrefixByte;
             }
-         case OP_LOADIMMED_STR:
+         case OP_LOADIMMED_STR: DISPATCH_LABEL(OP_LOADIMMED_STR)
             STR.setStringValue(curStringTable + code[ip++]);
-            break;
+            DISPATCH_NEXT;
 
          case OP_DOCBLOCK_STR:
             {
@@ -1409,9 +1546,9 @@ breakContinue:
 
             break;
 
-         case OP_LOADIMMED_IDENT:
+         case OP_LOADIMMED_IDENT: DISPATCH_LABEL(OP_LOADIMMED_IDENT)
             STR.setStringValue(U32toSTE(code[ip++]));
-            break;
+            DISPATCH_NEXT;
 
          case OP_CALLFUNC_RESOLVE:
             // This deals with a function that is potentially living in a namespace.
@@ -1653,39 +1790,159 @@ breakContinue:
                gEvalState.thisObject = saveObject;
             break;
          }
-         case OP_ADVANCE_STR:
+         case OP_ADVANCE_STR: DISPATCH_LABEL(OP_ADVANCE_STR)
             STR.advance();
-            break;
-         case OP_ADVANCE_STR_APPENDCHAR:
+            DISPATCH_NEXT;
+         case OP_ADVANCE_STR_APPENDCHAR: DISPATCH_LABEL(OP_ADVANCE_STR_APPENDCHAR)
             STR.advanceChar(code[ip++]);
-            break;
+            DISPATCH_NEXT;
 
-         case OP_ADVANCE_STR_COMMA:
+         case OP_ADVANCE_STR_COMMA: DISPATCH_LABEL(OP_ADVANCE_STR_COMMA)
             STR.advanceChar('_');
-            break;
+            DISPATCH_NEXT;
 
-         case OP_ADVANCE_STR_NUL:
+         case OP_ADVANCE_STR_NUL: DISPATCH_LABEL(OP_ADVANCE_STR_NUL)
             STR.advanceChar(0);
-            break;
+            DISPATCH_NEXT;
 
-         case OP_REWIND_STR:
+         case OP_REWIND_STR: DISPATCH_LABEL(OP_REWIND_STR)
             STR.rewind();
-            break;
+            DISPATCH_NEXT;
 
-         case OP_TERMINATE_REWIND_STR:
+         case OP_TERMINATE_REWIND_STR: DISPATCH_LABEL(OP_TERMINATE_REWIND_STR)
             STR.rewindTerminate();
-            break;
+            DISPATCH_NEXT;
 
-         case OP_COMPARE_STR:
+         case OP_COMPARE_STR: DISPATCH_LABEL(OP_COMPARE_STR)
             intStack[++UINT] = STR.compare();
-            break;
-         case OP_PUSH:
+            DISPATCH_NEXT;
+         case OP_PUSH: DISPATCH_LABEL(OP_PUSH)
             STR.push();
-            break;
+            DISPATCH_NEXT;
 
-         case OP_PUSH_FRAME:
+         case OP_PUSH_FRAME: DISPATCH_LABEL(OP_PUSH_FRAME)
             STR.pushFrame();
-            break;
+            DISPATCH_NEXT;
+         case OP_LOADVAR_UINT_IDENT: DISPATCH_LABEL(OP_LOADVAR_UINT_IDENT)
+            // See OP_SETCURVAR
+            var = U32toSTE(code[ip]);
+            ip++;
+            prevField = NULL;
+            prevObject = NULL;
+            curObject = NULL;
+            gEvalState.setCurVarName(var);
+            curFNDocBlock = NULL;
+            curNSDocBlock = NULL;
+
+            intStack[UINT+1] = gEvalState.getIntVariable();
+            UINT++;
+            DISPATCH_NEXT;
+
+         case OP_LOADVAR_FLT_IDENT: DISPATCH_LABEL(OP_LOADVAR_FLT_IDENT)
+            // See OP_SETCURVAR
+            var = U32toSTE(code[ip]);
+            ip++;
+            prevField = NULL;
+            prevObject = NULL;
+            curObject = NULL;
+            gEvalState.setCurVarName(var);
+            curFNDocBlock = NULL;
+            curNSDocBlock = NULL;
+
+            floatStack[FLT+1] = gEvalState.getFloatVariable();
+            FLT++;
+            DISPATCH_NEXT;
+
+         case OP_LOADVAR_STR_IDENT: DISPATCH_LABEL(OP_LOADVAR_STR_IDENT)
+            // See OP_SETCURVAR
+            var = U32toSTE(code[ip]);
+            ip++;
+            prevField = NULL;
+            prevObject = NULL;
+            curObject = NULL;
+            gEvalState.setCurVarName(var);
+            curFNDocBlock = NULL;
+            curNSDocBlock = NULL;
+
+            val = gEvalState.getStringVariable();
+            STR.setStringValue(val);
+            DISPATCH_NEXT;
+
+         case OP_LOADFIELD_UINT_IDENT: DISPATCH_LABEL(OP_LOADFIELD_UINT_IDENT)
+            // See OP_SETCURFIELD
+            prevField = curField;
+            dStrcpy( prevFieldArray, curFieldArray );
+            curField = U32toSTE(code[ip]);
+            curFieldArray[0] = 0;
+            ip++;
+
+            // See OP_LOADFIELD_UINT
+            if(curObject)
+               intStack[UINT+1] = U32(dAtoi(curObject->getDataField(curField, curFieldArray)));
+            else
+            {
+               getFieldComponent( prevObject, prevField, prevFieldArray, curField, valBuffer, VAL_BUFFER_SIZE );
+               intStack[UINT+1] = dAtoi( valBuffer );
+            }
+            UINT++;
+            DISPATCH_NEXT;
+
+         case OP_LOADFIELD_FLT_IDENT: DISPATCH_LABEL(OP_LOADFIELD_FLT_IDENT)
+            // See OP_SETCURFIELD
+            prevField = curField;
+            dStrcpy( prevFieldArray, curFieldArray );
+            curField = U32toSTE(code[ip]);
+            curFieldArray[0] = 0;
+            ip++;
+
+            // See OP_LOADFIELD_FLT
+            if(curObject)
+               floatStack[FLT+1] = dAtof(curObject->getDataField(curField, curFieldArray));
+            else
+            {
+               getFieldComponent( prevObject, prevField, prevFieldArray, curField, valBuffer, VAL_BUFFER_SIZE );
+               floatStack[FLT+1] = dAtof( valBuffer );
+            }
+            FLT++;
+            DISPATCH_NEXT;
+
+         case OP_LOADFIELD_STR_IDENT: DISPATCH_LABEL(OP_LOADFIELD_STR_IDENT)
+            // See OP_SETCURFIELD
+            prevField = curField;
+            dStrcpy( prevFieldArray, curFieldArray );
+            curField = U32toSTE(code[ip]);
+            curFieldArray[0] = 0;
+            ip++;
+
+            // See OP_LOADFIELD_STR
+            if(curObject)
+            {
+               val = curObject->getDataField(curField, curFieldArray);
+               STR.setStringValue( val );
+            }
+            else
+            {
+               getFieldComponent( prevObject, prevField, prevFieldArray, curField, valBuffer, VAL_BUFFER_SIZE );
+               STR.setStringValue( valBuffer );
+            }
+            DISPATCH_NEXT;
+
+         case OP_JMPIF_CMP: DISPATCH_LABEL(OP_JMPIF_CMP)
+            if(compareFloats(code[ip], floatStack[FLT], floatStack[FLT-1]))
+               ip = code[ip+1];
+            else
+               ip += 2;
+            FLT -= 2;
+            DISPATCH_NEXT;
+
+         case OP_JMPIFNOT_CMP: DISPATCH_LABEL(OP_JMPIFNOT_CMP)
+            if(!compareFloats(code[ip], floatStack[FLT], floatStack[FLT-1]))
+               ip = code[ip+1];
+            else
+               ip += 2;
+            FLT -= 2;
+            DISPATCH_NEXT;
+
          case OP_BREAK:
          {
             //append the ip and codeptr before managing the breakpoint!
@@ -1697,7 +1954,13 @@ breakContinue:
             findBreakLine(ip-1, breakLine, instruction);
             if(!breakLine)
                goto breakContinue;
-            TelDebugger->executionStopped(this, breakLine);
+#ifdef TORQUE_ENABLE_PROFILER
+            if(ScriptProfiler::isProfilingLines())
+               ScriptProfiler::hitLine(this, breakLine);
+#endif
+            // The script profiler places breaks without a debugger.
+            if(TelDebugger)
+               TelDebugger->executionStopped(this, breakLine);
 
             // Notify the remote debugger.
             if ( pRemoteDebugger != NULL )
@@ -1714,6 +1977,11 @@ breakContinue:
    }
 execFinished:
 
+#ifdef TORQUE_ENABLE_PROFILER
+   if ( scriptProfilerOn )
+      ScriptProfiler::leaveFunction();
+#endif
+
    if ( telDebuggerOn && setFrame < 0 )
       TelDebugger->popStackFrame();
 
@@ -89,6 +89,7 @@ namespace Compiler
    //------------------------------------------------------------
 
    bool gSyntaxError = false;
+   bool gSuperInstructions = true;
 
    //------------------------------------------------------------
 
@@ -139,6 +139,16 @@ namespace Compiler
       OP_PUSH,
       OP_PUSH_FRAME,
 
+      // Superinstructions fusing common instruction sequences.
+      OP_LOADVAR_UINT_IDENT,     ///< OP_SETCURVAR followed by OP_LOADVAR_UINT.
+      OP_LOADVAR_FLT_IDENT,      ///< OP_SETCURVAR followed by OP_LOADVAR_FLT.
+      OP_LOADVAR_STR_IDENT,      ///< OP_SETCURVAR followed by OP_LOADVAR_STR.
+      OP_LOADFIELD_UINT_IDENT,   ///< OP_SETCURFIELD followed by OP_LOADFIELD_UINT.
+      OP_LOADFIELD_FLT_IDENT,    ///< OP_SETCURFIELD followed by OP_LOADFIELD_FLT.
+      OP_LOADFIELD_STR_IDENT,    ///< OP_SETCURFIELD followed by OP_LOADFIELD_STR.
+      OP_JMPIF_CMP,              ///< A float compare (OP_CMPEQ etc) followed by OP_JMPIF.
+      OP_JMPIFNOT_CMP,           ///< A float compare (OP_CMPEQ etc) followed by OP_JMPIFNOT.
+
       OP_BREAK,
 
       OP_INVALID
@@ -249,6 +259,10 @@ namespace Compiler
    void consoleAllocReset();
 
    extern bool gSyntaxError;
+
+   /// Emit superinstructions for common instruction sequences.  On by default;
+   /// turning it off compiles the plain sequences, which is useful for testing.
+   extern bool gSuperInstructions;
 };
 
 #endif
@@ -33,6 +33,8 @@
 #include "debug/telnetDebugger.h"
 #include "sim/simBase.h"
 #include "console/compiler.h"
+#include "console/scriptBundle.h"
+#include "console/consoleLogWriter.h"
 #include "string/stringStack.h"
 #include "component/dynamicConsoleMethodComponent.h"
 #include "memory/safeDelete.h"
@@ -44,6 +46,12 @@
 
 static Mutex* sLogMutex;
 
+// Capacity of the log writer queue in bytes.
+#define CONSOLE_LOG_QUEUE_SIZE      (64 * 1024)
+
+// Milliseconds between the log writer batches.
+#define CONSOLE_LOG_WRITE_PERIOD    50
+
 extern StringStack STR;
 
 ExprEvalState gEvalState;
@@ -204,6 +212,22 @@ static S32 consoleLogMode = 0;
 static bool active = false;
 static bool newLogFile;
 static const char *logFileName;
+static S32 logLevel = ConsoleLogEntry::Normal;
+
+/// Rate limiting and sampling of a log category.
+struct LogFilter
+{
+   S32 mRateLimit;      ///< Messages per second, zero for no limit
+   S32 mSampleRate;     ///< Log one in this many messages, zero for all
+   U32 mSampleCount;    ///< Messages seen for sampling
+   U32 mWindowStart;    ///< Start of the current one second window
+   U32 mWindowCount;    ///< Messages logged in the current window
+   U32 mSuppressed;     ///< Messages suppressed in the current window
+   U32 mUnreported;     ///< Messages suppressed in earlier windows awaiting a report
+};
+static LogFilter logFilters[ConsoleLogEntry::NUM_TYPE];
+static bool logFilterReportPending = false;
+static const char *logTypeNames[ConsoleLogEntry::NUM_TYPE] = { "general", "assert", "script", "gui", "network" };
 
 static const int MaxCompletionBufferSize = 4096;
 static char completionBuffer[MaxCompletionBufferSize];
@@ -280,6 +304,7 @@ void init()
    setVariable("Con::prompt", "% ");
    addVariable("Con::logBufferEnabled", TypeBool, &logBufferEnabled);
    addVariable("Con::printLevel", TypeS32, &printLevel);
+   addVariable("Con::logLevel", TypeS32, &logLevel);
    addVariable("Con::warnUndefinedVariables", TypeBool, &gWarnUndefinedScriptVariables);
 
    // Current script file name and root
@@ -291,6 +316,9 @@ void init()
 
    // And finally, the ACR...
    AbstractClassRep::initialize();
+
+   // Write the log files in the background.
+   ConsoleLogWriter::create(CONSOLE_LOG_QUEUE_SIZE, CONSOLE_LOG_WRITE_PERIOD);
 }
 
 //--------------------------------------
@@ -300,7 +328,9 @@ void shutdown()
    AssertFatal(active == true, "Con::shutdown should only be called once.");
    active = false;
 
+   ConsoleLogWriter::destroy();
    consoleLogFile.close();
+   ScriptBundle::unmountAll();
    Namespace::shutdown();
 
    SAFE_DELETE( sLogMutex );
@@ -448,6 +478,20 @@ U32 tabComplete(char* inputBuffer, U32 cursorPos, U32 maxResultLength, bool forw
 }
 
 //------------------------------------------------------------------------------
+static void writeLogLine(const char *string)
+{
+   // Queue the line for the log writer if it is running.
+   ConsoleLogWriter* pLogWriter = ConsoleLogWriter::get();
+   if (pLogWriter)
+   {
+      pLogWriter->queueLine(&consoleLogFile, string);
+      return;
+   }
+
+   consoleLogFile.write(dStrlen(string), string);
+   consoleLogFile.write(2, "\r\n");
+}
+
 static void log(const char *string)
 {
    // Lock.
@@ -461,8 +505,10 @@ static void log(const char *string)
       return;
    }
 
-   // In mode 1, we open, append, close on each log write.
-   if ((consoleLogMode & 0x3) == 1) 
+   // In mode 1, we open, append, close on each log write.  When the log writer
+   // is running the file is kept open instead and flushed after each batch.
+   const bool reopen = (consoleLogMode & 0x3) == 1 && (!ConsoleLogWriter::get() || consoleLogFile.getStatus() == Stream::Closed);
+   if (reopen) 
    {
       consoleLogFile.open(defLogFileName, FileStream::ReadWrite);
    }
@@ -470,7 +516,9 @@ static void log(const char *string)
    // Write to the log if its status is hunky-dory.
    if ((consoleLogFile.getStatus() == Stream::Ok) || (consoleLogFile.getStatus() == Stream::EOS)) 
    {
-      consoleLogFile.setPosition(consoleLogFile.getStreamSize());
+      if (reopen)
+         consoleLogFile.setPosition(consoleLogFile.getStreamSize());
+
       // If this is the first write...
       if (newLogFile) 
       {
@@ -478,14 +526,14 @@ static void log(const char *string)
          Platform::LocalTime lt;
          Platform::getLocalTime(lt);
          char buffer[128];
-         dSprintf(buffer, sizeof(buffer), "//-------------------------- %d/%d/%d -- %02d:%02d:%02d -----\r\n",
+         dSprintf(buffer, sizeof(buffer), "//-------------------------- %d/%d/%d -- %02d:%02d:%02d -----",
                lt.month + 1,
                lt.monthday,
                lt.year + 1900,
                lt.hour,
                lt.min,
                lt.sec);
-         consoleLogFile.write(dStrlen(buffer), buffer);
+         writeLogLine(buffer);
          newLogFile = false;
          if (consoleLogMode & 0x4) 
          {
@@ -496,18 +544,16 @@ static void log(const char *string)
             getLockLog(log, size);
             for (line = 0; line < size; line++) 
             {
-               consoleLogFile.write(dStrlen(log[line].mString), log[line].mString);
-               consoleLogFile.write(2, "\r\n");
+               writeLogLine(log[line].mString);
             }
             unlockLog();
          }
       }
       // Now write what we came here to write.
-      consoleLogFile.write(dStrlen(string), string);
-      consoleLogFile.write(2, "\r\n");
+      writeLogLine(string);
    }
 
-   if ((consoleLogMode & 0x3) == 1) 
+   if ((consoleLogMode & 0x3) == 1 && !ConsoleLogWriter::get()) 
    {
       consoleLogFile.close();
    }
@@ -596,6 +642,10 @@ static void _printf(ConsoleLogEntry::Level level, ConsoleLogEntry::Type type, co
 
    Con::active = true;
 
+   // Errors reach the log files immediately in case they precede a crash.
+   if(level == ConsoleLogEntry::Error && ConsoleLogWriter::get())
+      ConsoleLogWriter::get()->flush();
+
 #if defined( _MSC_VER )  
    _outputDebugString( buffer );  
 #endif
@@ -603,6 +653,137 @@ static void _printf(ConsoleLogEntry::Level level, ConsoleLogEntry::Type type, co
 
 //------------------------------------------------------------------------------
 
+/// Start a new window every second, keeping what the last one suppressed for the report.
+/// The log mutex must be held.
+static void rollLogWindow(LogFilter& filter, const U32 time)
+{
+   if(time - filter.mWindowStart < 1000)
+      return;
+
+   filter.mUnreported += filter.mSuppressed;
+   filter.mWindowStart = time;
+   filter.mWindowCount = 0;
+   filter.mSuppressed = 0;
+}
+
+/// Check whether a message should be logged before it is formatted.  Called on any thread.
+static bool isLogged(ConsoleLogEntry::Level level, ConsoleLogEntry::Type type)
+{
+   // Filter on severity.
+   if(level < logLevel)
+      return false;
+
+   // Errors are never rate limited or sampled.
+   if(level == ConsoleLogEntry::Error)
+      return true;
+
+   MutexHandle mutex;
+   if( sLogMutex )
+      mutex.lock( sLogMutex, true );
+
+   LogFilter& filter = logFilters[type];
+   if(filter.mRateLimit <= 0 && filter.mSampleRate <= 1)
+      return true;
+
+   rollLogWindow(filter, Platform::getRealMilliseconds());
+
+   if((filter.mSampleRate > 1 && (filter.mSampleCount++ % filter.mSampleRate) != 0) ||
+      (filter.mRateLimit > 0 && filter.mWindowCount >= (U32)filter.mRateLimit))
+   {
+      filter.mSuppressed++;
+      return false;
+   }
+
+   filter.mWindowCount++;
+   return true;
+}
+
+/// Reports the suppressed message counts once a second on the main thread, so they
+/// appear even when no further messages arrive for a category.
+class LogFilterReportEvent : public SimEvent
+{
+public:
+   virtual void process(SimObject *object)
+   {
+      U32 unreported[ConsoleLogEntry::NUM_TYPE];
+      bool active = false;
+
+      {
+         MutexHandle mutex;
+         if( sLogMutex )
+            mutex.lock( sLogMutex, true );
+
+         const U32 time = Platform::getRealMilliseconds();
+         for(U32 type = 0; type < ConsoleLogEntry::NUM_TYPE; type++)
+         {
+            LogFilter& filter = logFilters[type];
+            rollLogWindow(filter, time);
+            unreported[type] = filter.mUnreported;
+            filter.mUnreported = 0;
+
+            active |= filter.mRateLimit > 0 || filter.mSampleRate > 1 || filter.mSuppressed > 0;
+         }
+
+         logFilterReportPending = active;
+      }
+
+      for(U32 type = 0; type < ConsoleLogEntry::NUM_TYPE; type++)
+      {
+         if(unreported[type] == 0)
+            continue;
+
+         char buffer[128];
+         dSprintf(buffer, sizeof(buffer), "Con - Suppressed %d %s messages.", unreported[type], logTypeNames[type]);
+         _printf(ConsoleLogEntry::Warning, (ConsoleLogEntry::Type)type, buffer);
+      }
+
+      // Keep reporting while any category is filtered.
+      if(active)
+         Sim::postEvent(Sim::getRootGroup(), new LogFilterReportEvent, Sim::getCurrentTime() + 1000);
+   }
+};
+
+ConsoleFunction( setLogFilter, void, 3, 4, "( category, maxPerSecond, [sampleRate] ) Use the setLogFilter function to limit the normal and warning messages logged for a category.\n"
+                                                                "Suppressed messages are filtered before they are formatted and are counted once a second. Errors are always logged.\n"
+                                                                "@param category One of general, assert, script, gui or network.\n"
+                                                                "@param maxPerSecond The most messages logged each second, or zero for no limit.\n"
+                                                                "@param sampleRate Log only one in this many messages, or zero to log all of them.\n"
+                                                                "@return No return value.\n"
+                                                                "@sa setLogMode")
+{
+   for(U32 type = 0; type < ConsoleLogEntry::NUM_TYPE; type++)
+   {
+      if(dStricmp(argv[1], logTypeNames[type]) != 0)
+         continue;
+
+      bool report = false;
+
+      {
+         MutexHandle mutex;
+         if( sLogMutex )
+            mutex.lock( sLogMutex, true );
+
+         LogFilter& filter = logFilters[type];
+         filter.mRateLimit = getMax(dAtoi(argv[2]), 0);
+         filter.mSampleRate = argc > 3 ? getMax(dAtoi(argv[3]), 0) : 0;
+         filter.mSampleCount = 0;
+
+         // Start reporting what the filter suppresses.
+         report = !logFilterReportPending && (filter.mRateLimit > 0 || filter.mSampleRate > 1);
+         if(report)
+            logFilterReportPending = true;
+      }
+
+      if(report)
+         Sim::postEvent(Sim::getRootGroup(), new LogFilterReportEvent, Sim::getCurrentTime() + 1000);
+      return;
+   }
+
+   Con::warnf("setLogFilter() - Unknown log category '%s'.", argv[1]);
+}
+
+//------------------------------------------------------------------------------
+
 class ConPrinfThreadedEvent : public SimEvent
 {
    ConsoleLogEntry::Level mLevel;
@@ -653,6 +834,9 @@ public:
 //------------------------------------------------------------------------------
 void printf(const char* fmt,...)
 {
+   if(!isLogged(ConsoleLogEntry::Normal, ConsoleLogEntry::General))
+      return;
+
    va_list argptr;
    va_start(argptr, fmt);
    char buf[8192];
@@ -666,6 +850,9 @@ void printf(const char* fmt,...)
 
 void warnf(ConsoleLogEntry::Type type, const char* fmt,...)
 {
+   if(!isLogged(ConsoleLogEntry::Warning, type))
+      return;
+
    va_list argptr;
    va_start(argptr, fmt);
    char buf[8192];
@@ -679,6 +866,9 @@ void warnf(ConsoleLogEntry::Type type, const char* fmt,...)
 
 void errorf(ConsoleLogEntry::Type type, const char* fmt,...)
 {
+   if(!isLogged(ConsoleLogEntry::Error, type))
+      return;
+
    va_list argptr;
    va_start(argptr, fmt);
    char buf[8192];
@@ -692,6 +882,9 @@ void errorf(ConsoleLogEntry::Type type, const char* fmt,...)
 
 void warnf(const char* fmt,...)
 {
+   if(!isLogged(ConsoleLogEntry::Warning, ConsoleLogEntry::General))
+      return;
+
    va_list argptr;
    va_start(argptr, fmt);
    char buf[8192];
@@ -705,6 +898,9 @@ void warnf(const char* fmt,...)
 
 void errorf(const char* fmt,...)
 {
+   if(!isLogged(ConsoleLogEntry::Error, ConsoleLogEntry::General))
+      return;
+
    va_list argptr;
    va_start(argptr, fmt);
    char buf[8192];
@@ -1127,14 +1323,19 @@ void setLogMode(S32 newMode)
 {
    if ((newMode & 0x3) != (consoleLogMode & 0x3))
    {
+      // Write out anything still queued for the old mode.
+      if (ConsoleLogWriter::get())
+         ConsoleLogWriter::get()->flush();
+
       if (newMode && !consoleLogMode)
       {
          // Enabling logging when it was previously disabled.
          newLogFile = true;
       }
-      if ((consoleLogMode & 0x3) == 2)
+      if ((consoleLogMode & 0x3) == 2 || (consoleLogMode & 0x3) == 1)
       {
-         // Changing away from mode 2, must close logfile.
+         // Changing away from mode 2, must close logfile.  Mode 1 keeps
+         // the logfile open while the log writer is running.
          consoleLogFile.close();
       }
       else if ((newMode & 0x3) == 2)
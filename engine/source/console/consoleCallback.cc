@@ -0,0 +1,156 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "console/consoleCallback.h"
+
+#include "platform/platform.h"
+#include "console/console.h"
+#include "console/consoleInternal.h"
+#include "console/ast.h"
+#include "sim/simBase.h"
+#include "string/stringStack.h"
+#include "component/dynamicConsoleMethodComponent.h"
+
+extern StringStack STR;
+
+//-----------------------------------------------------------------------------
+
+ConsoleCallback::ConsoleCallback( const char* pCallbackName ) :
+    mpCallbackName( pCallbackName ),
+    mCallbackName( NULL ),
+    mCacheSequence( Namespace::mCacheSequence ),
+    mpLastNamespace( NULL ),
+    mpLastEntry( NULL )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry ConsoleCallback::getName( void )
+{
+    // The string table may not exist during static construction so insert the name on demand.
+    if ( mCallbackName == NULL )
+        mCallbackName = StringTable->insert( mpCallbackName );
+
+    return mCallbackName;
+}
+
+//-----------------------------------------------------------------------------
+
+Namespace::Entry* ConsoleCallback::lookup( Namespace* pNamespace )
+{
+    // Finish if no namespace.
+    if ( pNamespace == NULL )
+        return NULL;
+
+    // Flush the resolved entries if the namespace cache has been trashed.
+    if ( mCacheSequence != Namespace::mCacheSequence )
+    {
+        mEntries.clear();
+        mpLastNamespace = NULL;
+        mpLastEntry = NULL;
+        mCacheSequence = Namespace::mCacheSequence;
+    }
+
+    // Finish if this is the last namespace resolved.
+    if ( pNamespace == mpLastNamespace )
+        return mpLastEntry;
+
+    // Find the resolved entry.
+    Namespace::Entry* pEntry;
+    typeEntryHash::iterator entryItr = mEntries.find( pNamespace );
+    if ( entryItr != mEntries.end() )
+    {
+        pEntry = entryItr->value;
+    }
+    else
+    {
+        // Resolve the entry.
+        // NOTE: A NULL entry is cached too so that unimplemented callbacks are cheap.
+        pEntry = pNamespace->lookup( getName() );
+        mEntries.insert( pNamespace, pEntry );
+    }
+
+    mpLastNamespace = pNamespace;
+    mpLastEntry = pEntry;
+
+    return pEntry;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* ConsoleCallback::execute( SimObject* pObject, DynamicConsoleMethodComponent* pComponent, S32 argc, const char* argv[] )
+{
+    // Sanity!
+    AssertFatal( pObject != NULL, "ConsoleCallback::execute() - Cannot execute a callback on a NULL object." );
+    AssertFatal( argc >= 2, "ConsoleCallback::execute() - Invalid argument count." );
+
+    // Call the components first as Con::execute() does.
+    if ( pComponent != NULL && pComponent->getComponentCount() > 0 )
+    {
+        argv[0] = getName();
+        argv[1] = getName();
+        pComponent->callMethodArgList( argc, argv, false );
+    }
+
+    // Resolve the entry.
+    Namespace::Entry* pEntry = lookup( pObject->getNamespace() );
+
+    // Finish if the callback is not implemented.
+    if ( pEntry == NULL )
+        return "";
+
+    // Format the object Id.
+    static char idBuffer[16];
+    dSprintf( idBuffer, sizeof(idBuffer), "%d", pObject->getId() );
+    argv[0] = getName();
+    argv[1] = idBuffer;
+
+    pObject->pushScriptCallbackGuard();
+
+    SimObject* pSaveObject = gEvalState.thisObject;
+    gEvalState.thisObject = pObject;
+    const char* pResult = pEntry->execute( argc, argv, &gEvalState );
+    gEvalState.thisObject = pSaveObject;
+
+    pObject->popScriptCallbackGuard();
+
+    // Reset the function offset so the stack doesn't continue to grow unnecessarily.
+    STR.clearFunctionOffset();
+
+    return pResult;
+}
+
+//-----------------------------------------------------------------------------
+
+DynamicConsoleMethodComponent* ConsoleCallback::getComponent( SimObject* pObject )
+{
+    return dynamic_cast<DynamicConsoleMethodComponent*>( pObject );
+}
+
+//-----------------------------------------------------------------------------
+
+Namespace* ConsoleCallback::getObjectNamespace( SimObject* pObject )
+{
+    return pObject->getNamespace();
+}
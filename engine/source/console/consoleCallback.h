@@ -0,0 +1,121 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _CONSOLE_CALLBACK_H_
+#define _CONSOLE_CALLBACK_H_
+
+#ifndef _CONSOLE_NAMESPACE_H
+#include "console/consoleNamespace.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class SimObject;
+class DynamicConsoleMethodComponent;
+
+//-----------------------------------------------------------------------------
+
+/// A pre-resolved handle to a script callback.
+///
+/// Con::executef() interns the callback name, performs a namespace lookup and
+/// checks for components on every call.  Engine classes that invoke a callback
+/// frequently (per object, per tick) should instead declare a handle once per
+/// callback name and execute it.  The handle resolves the namespace entry once
+/// per namespace and caches it until the namespace cache is trashed i.e. when a
+/// package is activated/deactivated or a function is (re)defined.  When no script
+/// implements the callback, executing it does nothing.
+///
+/// @code
+/// static ConsoleCallback sOnUpdateCallback( "onUpdate" );
+///
+/// sOnUpdateCallback.execute( this );
+/// @endcode
+class ConsoleCallback
+{
+public:
+    ConsoleCallback( const char* pCallbackName );
+
+    /// Gets the callback name.
+    StringTableEntry getName( void );
+
+    /// Gets the namespace entry implementing the callback or NULL if not implemented.
+    Namespace::Entry* lookup( Namespace* pNamespace );
+
+    /// Gets whether the callback is implemented by the object (not its components).
+    inline bool isMethod( SimObject* pObject ) { return lookup( getObjectNamespace( pObject ) ) != NULL; }
+
+    /// Executes the callback on the object and any of its components.
+    /// @param argv Arguments where the first two are reserved for the callback name and object Id.
+    const char* execute( SimObject* pObject, DynamicConsoleMethodComponent* pComponent, S32 argc, const char* argv[] );
+
+    template< class T > inline const char* execute( T* pObject )
+    {
+        const char* argv[2];
+        return execute( pObject, getComponent( pObject ), 2, argv );
+    }
+
+    template< class T > inline const char* execute( T* pObject, const char* pArg1 )
+    {
+        const char* argv[3];
+        argv[2] = pArg1;
+        return execute( pObject, getComponent( pObject ), 3, argv );
+    }
+
+    template< class T > inline const char* execute( T* pObject, const char* pArg1, const char* pArg2 )
+    {
+        const char* argv[4];
+        argv[2] = pArg1;
+        argv[3] = pArg2;
+        return execute( pObject, getComponent( pObject ), 4, argv );
+    }
+
+    template< class T > inline const char* execute( T* pObject, const char* pArg1, const char* pArg2, const char* pArg3 )
+    {
+        const char* argv[5];
+        argv[2] = pArg1;
+        argv[3] = pArg2;
+        argv[4] = pArg3;
+        return execute( pObject, getComponent( pObject ), 5, argv );
+    }
+
+private:
+    /// Objects known to be components at compile-time avoid the dynamic cast.
+    static inline DynamicConsoleMethodComponent* getComponent( DynamicConsoleMethodComponent* pComponent ) { return pComponent; }
+    static DynamicConsoleMethodComponent* getComponent( SimObject* pObject );
+    static Namespace* getObjectNamespace( SimObject* pObject );
+
+    typedef HashMap<Namespace*, Namespace::Entry*> typeEntryHash;
+
+    const char*         mpCallbackName;
+    StringTableEntry    mCallbackName;
+    U32                 mCacheSequence;
+    typeEntryHash       mEntries;
+    Namespace*          mpLastNamespace;
+    Namespace::Entry*   mpLastEntry;
+};
+
+#endif // _CONSOLE_CALLBACK_H_
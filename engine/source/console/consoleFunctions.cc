@@ -27,6 +27,7 @@
 #include "io/resource/resourceManager.h"
 #include "io/fileStream.h"
 #include "console/compiler.h"
+#include "console/scriptBundle.h"
 #include "platform/event.h"
 #include "game/gameInterface.h"
 #include "platform/platformInput.h"
@@ -1078,7 +1079,7 @@ ConsoleFunction(exec, bool, 2, 4, "( fileName [ , nocalls [ , journalScript ] ]
 //release tests on iPhone is irrelevant.
 #ifdef TORQUE_ALLOW_DSO_GENERATION
 
-   if(!ResourceManager->find(pathBuffer))
+   if(!ScriptBundle::contains(pathBuffer) && !ResourceManager->find(pathBuffer))
    {
       // NOTE: this code is pretty much a duplication of code much further down in this
       //       function...
@@ -1178,6 +1179,22 @@ ConsoleFunction(exec, bool, 2, 4, "( fileName [ , nocalls [ , journalScript ] ]
    }
 #endif //TORQUE_ALLOW_JOURNALING
 
+   // Scripts in a mounted bundle are read from memory without probing for the script or DSO.
+   if(compiled)
+   {
+      CodeBlock *code = ScriptBundle::load(scriptFileName);
+      if(code)
+      {
+         code->exec(0, scriptFileName, NULL, 0, NULL, noCalls, NULL, 0);
+
+         if ( scriptExecutionEcho )
+            Con::printf("Loaded bundled script %s.", scriptFileName);
+
+         execDepth--;
+         return true;
+      }
+   }
+
    // Ok, we let's try to load and compile the script.
    ResourceObject *rScr = ResourceManager->find(scriptFileName);
    ResourceObject *rCom = NULL;
@@ -1355,9 +1372,12 @@ ConsoleFunction(exec, bool, 2, 4, "( fileName [ , nocalls [ , journalScript ] ]
       F32 st1 = (F32)Platform::getRealMilliseconds();
 
       CodeBlock *code = new CodeBlock;
-      code->read(scriptFileName, *compiledStream);
+      const bool codeRead = code->read(scriptFileName, *compiledStream);
       ResourceManager->closeStream(compiledStream);
-      code->exec(0, scriptFileName, NULL, 0, NULL, noCalls, NULL, 0);
+      if(codeRead)
+         code->exec(0, scriptFileName, NULL, 0, NULL, noCalls, NULL, 0);
+      else
+         delete code;
 
         F32 et1 = (F32)Platform::getRealMilliseconds();
         
@@ -1366,7 +1386,7 @@ ConsoleFunction(exec, bool, 2, 4, "( fileName [ , nocalls [ , journalScript ] ]
         if ( scriptExecutionEcho )
             Con::printf("Loaded compiled script %s. Took %.0f ms", scriptFileName, etf);
 
-      ret = true;
+      ret = codeRead;
    }
    else if(rScr) //Luma : Load normal cs file here.
    {
@@ -0,0 +1,187 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+#include "console/consoleLogWriter.h"
+#include "io/fileStream.h"
+
+//-----------------------------------------------------------------------------
+
+ConsoleLogWriter* ConsoleLogWriter::smLogWriter = NULL;
+
+// Records are padded so their headers stay aligned.
+static inline U32 logRecordSize( const U32 length )
+{
+   return (U32)((sizeof(FileStream*) + sizeof(U32) + length + sizeof(FileStream*) - 1) & ~(sizeof(FileStream*) - 1));
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleLogWriter::ConsoleLogWriter( const U32 queueSize, const U32 period ) :
+   Thread( 0, NULL, false ),
+   mQueueUsed( 0 ),
+   mQueueSize( queueSize ),
+   mPeriod( period )
+{
+   mQueue = (U8*)dMalloc( mQueueSize );
+   mBatch = (U8*)dMalloc( mQueueSize );
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleLogWriter::~ConsoleLogWriter()
+{
+   dFree( mQueue );
+   dFree( mBatch );
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::create( const U32 queueSize, const U32 period )
+{
+   AssertFatal( smLogWriter == NULL, "ConsoleLogWriter::create() - The log writer is already running." );
+
+   smLogWriter = new ConsoleLogWriter( queueSize, period );
+   smLogWriter->start();
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::destroy( void )
+{
+   if ( smLogWriter == NULL )
+      return;
+
+   // Stop queueing lines before the last batch is written.
+   ConsoleLogWriter* pLogWriter = smLogWriter;
+   smLogWriter = NULL;
+
+   pLogWriter->stop();
+   pLogWriter->join();
+   pLogWriter->flush();
+
+   delete pLogWriter;
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::run( void* arg )
+{
+   while( !checkForStop() )
+   {
+      flush();
+      Platform::sleep( mPeriod );
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::queueLine( FileStream* pStream, const char* pLine )
+{
+   // The line break is queued with the line.
+   const U32 lineLength = dStrlen( pLine );
+   const U32 length = lineLength + 2;
+   const U32 recordSize = logRecordSize( length );
+
+   // Write the line directly if it can never fit in the queue.
+   if ( recordSize > mQueueSize )
+   {
+      MutexHandle writeMutex;
+      writeMutex.lock( &mWriteLock, true );
+      flush();
+      pStream->write( lineLength, pLine );
+      pStream->write( 2, "\r\n" );
+      return;
+   }
+
+   mQueueLock.lock();
+
+   // Write the queue on this thread if it is full.
+   while ( mQueueUsed + recordSize > mQueueSize )
+   {
+      mQueueLock.unlock();
+      flush();
+      mQueueLock.lock();
+   }
+
+   LogRecord* pRecord = (LogRecord*)(mQueue + mQueueUsed);
+   pRecord->mStream = pStream;
+   pRecord->mLength = length;
+
+   char* pText = (char*)(pRecord + 1);
+   dMemcpy( pText, pLine, lineLength );
+   pText[lineLength] = '\r';
+   pText[lineLength + 1] = '\n';
+
+   mQueueUsed += recordSize;
+
+   mQueueLock.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleLogWriter::flush( void )
+{
+   MutexHandle writeMutex;
+   writeMutex.lock( &mWriteLock, true );
+
+   // Swap the queue out so lines can be queued while the batch is written.
+   mQueueLock.lock();
+   U8* pBatch = mQueue;
+   const U32 batchSize = mQueueUsed;
+   mQueue = mBatch;
+   mBatch = pBatch;
+   mQueueUsed = 0;
+   mQueueLock.unlock();
+
+   if ( batchSize == 0 )
+      return;
+
+   // Write the lines, flushing each stream once at the end of the batch.
+   FileStream* pFlushStreams[8];
+   U32 flushCount = 0;
+
+   for ( U32 offset = 0; offset < batchSize; )
+   {
+      const LogRecord* pRecord = (const LogRecord*)(pBatch + offset);
+      pRecord->mStream->write( pRecord->mLength, pRecord + 1 );
+      offset += logRecordSize( pRecord->mLength );
+
+      U32 index = 0;
+      while ( index < flushCount && pFlushStreams[index] != pRecord->mStream )
+         index++;
+
+      if ( index == flushCount )
+      {
+         // Flush early if too many streams were written.
+         if ( flushCount == sizeof(pFlushStreams) / sizeof(FileStream*) )
+         {
+            for ( index = 0; index < flushCount; ++index )
+               pFlushStreams[index]->Flush();
+            flushCount = 0;
+         }
+
+         pFlushStreams[flushCount++] = pRecord->mStream;
+      }
+   }
+
+   for ( U32 index = 0; index < flushCount; ++index )
+      pFlushStreams[index]->Flush();
+}
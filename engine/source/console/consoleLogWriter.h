@@ -0,0 +1,89 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+#ifndef _CONSOLE_LOG_WRITER_H_
+#define _CONSOLE_LOG_WRITER_H_
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class FileStream;
+
+//-----------------------------------------------------------------------------
+
+/// Writes the console log files on a background thread.
+///
+/// Log lines are appended to a queue under a short lock and the writer thread
+/// periodically swaps the queue out and writes it as one batch, flushing each file
+/// once per batch rather than per line.  A full queue is written on the calling
+/// thread.
+///
+/// A stream must not be closed while it has lines queued, flush() the writer first.
+class ConsoleLogWriter : public Thread
+{
+private:
+   /// Prefixes each queued line.
+   struct LogRecord
+   {
+      FileStream* mStream;
+      U32         mLength;
+   };
+
+   Mutex    mQueueLock;          ///< Guards the queue
+   Mutex    mWriteLock;          ///< Serializes writing batches
+   U8*      mQueue;              ///< Lines waiting to be written
+   U8*      mBatch;              ///< Lines being written
+   U32      mQueueUsed;          ///< Bytes used in the queue
+   U32      mQueueSize;          ///< Capacity of the queue and the batch
+   U32      mPeriod;             ///< Milliseconds between batches
+
+   static ConsoleLogWriter* smLogWriter;
+
+   ConsoleLogWriter( const U32 queueSize, const U32 period );
+   virtual ~ConsoleLogWriter();
+
+public:
+   virtual void run( void* arg = 0 );
+
+   /// Start the log writer, writing a batch every period milliseconds.
+   static void create( const U32 queueSize, const U32 period );
+
+   /// Write any queued lines and stop the log writer.
+   static void destroy( void );
+
+   /// Get the log writer or NULL if it isn't running.
+   static inline ConsoleLogWriter* get( void )   { return smLogWriter; }
+
+   /// Queue a line to be written to the stream followed by a line break.
+   void queueLine( FileStream* pStream, const char* pLine );
+
+   /// Write every queued line on the calling thread.
+   void flush( void );
+};
+
+#endif // _CONSOLE_LOG_WRITER_H_
@@ -21,6 +21,7 @@
 //-----------------------------------------------------------------------------
 #include "console/consoleLogger.h"
 #include "console/consoleTypes.h"
+#include "console/consoleLogWriter.h"
 
 Vector<ConsoleLogger *> ConsoleLogger::mActiveLoggers;
 bool ConsoleLogger::smInitialized = false;
@@ -165,6 +166,10 @@ bool ConsoleLogger::detach()
    if( !mLogging )
       return false;
 
+   // Write out any queued lines before closing the filestream
+   if( ConsoleLogWriter::get() )
+      ConsoleLogWriter::get()->flush();
+
    // Close filestream
    mStream.close();
 
@@ -214,6 +219,14 @@ void ConsoleLogger::log( const char *consoleLine )
       }
    }
 
+   // Hand the line to the log writer if it is running
+   ConsoleLogWriter *pLogWriter = ConsoleLogWriter::get();
+   if( pLogWriter )
+   {
+      pLogWriter->queueLine( &mStream, consoleLine );
+      return;
+   }
+
    mStream.writeLine( (U8 *)consoleLine );
 }
 
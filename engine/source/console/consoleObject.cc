@@ -42,6 +42,26 @@ bool                               AbstractClassRep::initialized = false;
 //--------------------------------------
 const AbstractClassRep::Field *AbstractClassRep::findField(StringTableEntry name) const
 {
+   // Use the field hash table if it's been built.
+   const U32 hashSize = mFieldHashTable.size();
+   if(hashSize > 0)
+   {
+      U32 index = HashPointer(name) % hashSize;
+      for(;;)
+      {
+         const S32 fieldIndex = mFieldHashTable[index];
+         if(fieldIndex < 0)
+            return NULL;
+
+         if(mFieldList[fieldIndex].pFieldname == name)
+            return &mFieldList[fieldIndex];
+
+         index++;
+         if(index >= hashSize)
+            index = 0;
+      }
+   }
+
    for(U32 i = 0; i < (U32)mFieldList.size(); i++)
       if(mFieldList[i].pFieldname == name)
          return &mFieldList[i];
@@ -51,6 +71,41 @@ const AbstractClassRep::Field *AbstractClassRep::findField(StringTableEntry name
 
 //-----------------------------------------------------------------------------
 
+void AbstractClassRep::buildFieldHashTable()
+{
+   const U32 fieldCount = mFieldList.size();
+   if(fieldCount == 0)
+   {
+      mFieldHashTable.clear();
+      return;
+   }
+
+   // Keep the load factor at most a half.
+   U32 hashSize = fieldCount * 2 + 1;
+   mFieldHashTable.setSize(hashSize);
+   for(U32 i = 0; i < hashSize; i++)
+      mFieldHashTable[i] = -1;
+
+   for(U32 i = 0; i < fieldCount; i++)
+   {
+      StringTableEntry fieldName = mFieldList[i].pFieldname;
+
+      U32 index = HashPointer(fieldName) % hashSize;
+      while(mFieldHashTable[index] >= 0 && mFieldList[mFieldHashTable[index]].pFieldname != fieldName)
+      {
+         index++;
+         if(index >= hashSize)
+            index = 0;
+      }
+
+      // The first field with a given name wins, as with a linear search.
+      if(mFieldHashTable[index] < 0)
+         mFieldHashTable[index] = i;
+   }
+}
+
+//-----------------------------------------------------------------------------
+
 AbstractClassRep* AbstractClassRep::findFieldRoot( StringTableEntry fieldName )
 {
     // Find the field.
@@ -202,6 +257,9 @@ void AbstractClassRep::initialize()
 
       // And of course delete it every round.
       sg_tempFieldList.clear();
+
+      // Hash the field names for quick lookup.
+      walk->buildFieldHashTable();
    }
 
    // Calculate counts and bit sizes for the various NetClasses.
@@ -241,6 +241,9 @@ public:
 
     FieldList mFieldList;
 
+    /// Open-addressed table of field indices hashed by field name (-1 denotes an empty slot).
+    Vector<S32> mFieldHashTable;
+
     bool mDynamicGroupExpand;
 
     static U32  NetClassCount [NetClassGroupsCount][NetClassTypesCount];
@@ -255,6 +258,7 @@ public:
     AbstractClassRep() 
     {
         VECTOR_SET_ASSOCIATION(mFieldList);
+        VECTOR_SET_ASSOCIATION(mFieldHashTable);
         parentClass  = NULL;
     }
     virtual ~AbstractClassRep() { }
@@ -295,6 +299,7 @@ public:
     virtual ConsoleObject* create() const = 0;
     const Field *findField(StringTableEntry fieldName) const;
     AbstractClassRep* findFieldRoot( StringTableEntry fieldName );
+    void buildFieldHashTable();
     AbstractClassRep* findContainerChildRoot( AbstractClassRep* pChild );
 
 protected:
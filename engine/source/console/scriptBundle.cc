@@ -0,0 +1,379 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "console/scriptBundle.h"
+
+#include "platform/platform.h"
+#include "console/console.h"
+#include "console/compiler.h"
+#include "console/codeBlock.h"
+#include "collection/hashTable.h"
+#include "io/resource/resourceManager.h"
+#include "io/fileStream.h"
+#include "io/memstream.h"
+
+//-----------------------------------------------------------------------------
+
+namespace ScriptBundle
+{
+
+static const U32 BundleMagic = 0x4E425354; // "TSBN"
+static const U32 BundleVersion = 1;
+
+struct BundleEntry
+{
+    const U8* mpData;
+    U32 mSize;
+};
+
+static Vector<U8*> sBundles;
+static HashMap<StringTableEntry, BundleEntry> sEntries;
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry lookupEntryName( const char* pScriptFile )
+{
+    char pathBuffer[1024];
+    Platform::makeFullPathName( pScriptFile, pathBuffer, sizeof(pathBuffer) );
+    return StringTable->lookup( pathBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
+S32 build( const char* pBundleFile, const char* pPattern )
+{
+    char bundlePath[1024];
+    char patternPath[1024];
+    Con::expandPath( bundlePath, sizeof(bundlePath), pBundleFile );
+    Con::expandPath( patternPath, sizeof(patternPath), pPattern );
+
+    // Scripts are compiled to a temporary DSO then expanded into the bundle.
+    char tempPath[1024];
+    dSprintf( tempPath, sizeof(tempPath), "%s.dso", bundlePath );
+
+    const StringTableEntry mainPath = Platform::getMainDotCsDir();
+    const U32 mainPathLength = dStrlen( mainPath );
+
+    Vector<StringTableEntry> names;
+    Vector<U32> offsets;
+    Vector<U32> sizes;
+    Vector<U8> data;
+    bool failed = false;
+
+    const char* pFileName = NULL;
+    ResourceObject* pMatch = NULL;
+    while( (pMatch = ResourceManager->findMatch( patternPath, &pFileName, pMatch )) )
+    {
+        char scriptPath[1024];
+        Platform::makeFullPathName( pFileName, scriptPath, sizeof(scriptPath) );
+
+        // Read the script.
+        Stream* pStream = ResourceManager->openStream( pMatch );
+        if ( pStream == NULL )
+        {
+            Con::errorf( "buildScriptBundle() - Could not read script '%s'.", scriptPath );
+            failed = true;
+            break;
+        }
+
+        const U32 scriptSize = pStream->getStreamSize();
+        char* pScript = new char[scriptSize + 1];
+        pStream->read( scriptSize, pScript );
+        pScript[scriptSize] = 0;
+        ResourceManager->closeStream( pStream );
+
+        // Compile the script.
+        CodeBlock* pCode = new CodeBlock();
+        const bool compiled = pCode->compile( tempPath, StringTable->insert( scriptPath ), pScript );
+        delete pCode;
+        delete [] pScript;
+
+        FileStream dsoStream;
+        U32 version = 0;
+        if ( !compiled || !dsoStream.open( tempPath, FileStream::Read ) || !dsoStream.read( &version ) || version != DSO_VERSION )
+        {
+            Con::errorf( "buildScriptBundle() - Could not compile script '%s'.", scriptPath );
+            failed = true;
+            break;
+        }
+
+        // Expand the compiled code.  Each byte of code expands to at most a word.
+        const U32 dsoSize = dsoStream.getStreamSize() - dsoStream.getPosition();
+        U8* pDso = new U8[dsoSize > 0 ? dsoSize : 1];
+        const bool dsoRead = dsoStream.read( dsoSize, pDso );
+        dsoStream.close();
+
+        const U32 expandedCapacity = dsoSize * sizeof(U32);
+        U8* pExpanded = new U8[expandedCapacity > 0 ? expandedCapacity : 1];
+        MemStream expandedStream( expandedCapacity, pExpanded, false, true );
+        const bool expanded = dsoRead && CodeBlock::expandCode( pDso, dsoSize, expandedStream );
+        const U32 expandedSize = expandedStream.getPosition();
+        delete [] pDso;
+
+        if ( !expanded )
+        {
+            delete [] pExpanded;
+            Con::errorf( "buildScriptBundle() - Could not expand script '%s'.", scriptPath );
+            failed = true;
+            break;
+        }
+
+        // Name the script relative to the main.cs directory where possible.
+        const char* pName = scriptPath;
+        if ( dStrnicmp( scriptPath, mainPath, mainPathLength ) == 0 && scriptPath[mainPathLength] == '/' )
+            pName += mainPathLength + 1;
+
+        names.push_back( StringTable->insert( pName ) );
+        offsets.push_back( data.size() );
+        sizes.push_back( expandedSize );
+
+        data.setSize( data.size() + expandedSize );
+        dMemcpy( data.address() + offsets.last(), pExpanded, expandedSize );
+        delete [] pExpanded;
+    }
+
+    Platform::fileDelete( tempPath );
+
+    if ( failed )
+        return -1;
+
+    // Write the bundle.
+    FileStream bundleStream;
+    if ( !ResourceManager->openFileForWrite( bundleStream, bundlePath ) )
+    {
+        Con::errorf( "buildScriptBundle() - Could not write bundle '%s'.", bundlePath );
+        return -1;
+    }
+
+    bundleStream.write( BundleMagic );
+    bundleStream.write( BundleVersion );
+    bundleStream.write( DSO_VERSION );
+    bundleStream.write( names.size() );
+
+    for( U32 index = 0; index < (U32)names.size(); ++index )
+    {
+        const U32 nameLength = dStrlen( names[index] );
+        bundleStream.write( nameLength );
+        bundleStream.write( nameLength, names[index] );
+        bundleStream.write( offsets[index] );
+        bundleStream.write( sizes[index] );
+    }
+
+    if ( data.size() > 0 )
+        bundleStream.write( data.size(), data.address() );
+
+    const bool written = bundleStream.getStatus() == Stream::Ok;
+    bundleStream.close();
+
+    if ( !written )
+    {
+        Con::errorf( "buildScriptBundle() - Could not write bundle '%s'.", bundlePath );
+        return -1;
+    }
+
+    return names.size();
+}
+
+//-----------------------------------------------------------------------------
+
+bool mount( const char* pBundleFile )
+{
+    char bundlePath[1024];
+    Con::expandPath( bundlePath, sizeof(bundlePath), pBundleFile );
+
+    // Read the whole bundle in one go.
+    FileStream bundleStream;
+    if ( !bundleStream.open( bundlePath, FileStream::Read ) )
+    {
+        Con::warnf( "mountScriptBundle() - Could not open bundle '%s'.", bundlePath );
+        return false;
+    }
+
+    const U32 bundleSize = bundleStream.getStreamSize();
+    U8* pBundle = new U8[bundleSize > 0 ? bundleSize : 1];
+    const bool bundleRead = bundleStream.read( bundleSize, pBundle );
+    bundleStream.close();
+
+    MemStream headerStream( bundleSize, pBundle, true, false );
+    U32 magic = 0;
+    U32 version = 0;
+    U32 dsoVersion = 0;
+    U32 entryCount = 0;
+
+    if ( !bundleRead ||
+        !headerStream.read( &magic ) || magic != BundleMagic ||
+        !headerStream.read( &version ) || version != BundleVersion ||
+        !headerStream.read( &dsoVersion ) ||
+        !headerStream.read( &entryCount ) )
+    {
+        Con::warnf( "mountScriptBundle() - '%s' is not a script bundle.", bundlePath );
+        delete [] pBundle;
+        return false;
+    }
+
+    if ( dsoVersion != DSO_VERSION )
+    {
+        Con::warnf( "mountScriptBundle() - Found an old bundle (%s, ver %d < %d), ignoring.", bundlePath, dsoVersion, DSO_VERSION );
+        delete [] pBundle;
+        return false;
+    }
+
+    // Read all the entries before registering any so a corrupt bundle mounts nothing.
+    Vector<StringTableEntry> names;
+    Vector<U32> offsets;
+    Vector<U32> sizes;
+    bool corrupt = false;
+
+    for( U32 index = 0; index < entryCount; ++index )
+    {
+        char name[1024];
+        U32 nameLength = 0;
+        U32 offset = 0;
+        U32 size = 0;
+
+        if ( !headerStream.read( &nameLength ) || nameLength == 0 || nameLength >= sizeof(name) ||
+            !headerStream.read( nameLength, name ) ||
+            !headerStream.read( &offset ) ||
+            !headerStream.read( &size ) )
+        {
+            corrupt = true;
+            break;
+        }
+
+        name[nameLength] = 0;
+        names.push_back( StringTable->insert( name ) );
+        offsets.push_back( offset );
+        sizes.push_back( size );
+    }
+
+    const U32 dataStart = headerStream.getPosition();
+    const U32 dataSize = bundleSize - dataStart;
+
+    for( U32 index = 0; !corrupt && index < (U32)names.size(); ++index )
+    {
+        if ( offsets[index] > dataSize || sizes[index] > dataSize - offsets[index] )
+            corrupt = true;
+    }
+
+    if ( corrupt )
+    {
+        Con::warnf( "mountScriptBundle() - Bundle '%s' is corrupt.", bundlePath );
+        delete [] pBundle;
+        return false;
+    }
+
+    // Register the entries.
+    const StringTableEntry mainPath = Platform::getMainDotCsDir();
+
+    for( U32 index = 0; index < (U32)names.size(); ++index )
+    {
+        char pathBuffer[1024];
+        Platform::makeFullPathName( names[index], pathBuffer, sizeof(pathBuffer), mainPath );
+
+        BundleEntry& entry = sEntries[StringTable->insert( pathBuffer )];
+        entry.mpData = pBundle + dataStart + offsets[index];
+        entry.mSize = sizes[index];
+    }
+
+    sBundles.push_back( pBundle );
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void unmountAll( void )
+{
+    sEntries.clear();
+
+    for( Vector<U8*>::iterator bundleItr = sBundles.begin(); bundleItr != sBundles.end(); ++bundleItr )
+        delete [] *bundleItr;
+
+    sBundles.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+bool contains( const char* pScriptFile )
+{
+    // Finish quickly when nothing is mounted.
+    if ( sBundles.size() == 0 )
+        return false;
+
+    const StringTableEntry entryName = lookupEntryName( pScriptFile );
+    return entryName != NULL && sEntries.find( entryName ) != sEntries.end();
+}
+
+//-----------------------------------------------------------------------------
+
+CodeBlock* load( StringTableEntry scriptFile )
+{
+    // Finish quickly when nothing is mounted.
+    if ( sBundles.size() == 0 )
+        return NULL;
+
+    const StringTableEntry entryName = lookupEntryName( scriptFile );
+    if ( entryName == NULL )
+        return NULL;
+
+    HashMap<StringTableEntry, BundleEntry>::iterator entryItr = sEntries.find( entryName );
+    if ( entryItr == sEntries.end() )
+        return NULL;
+
+    CodeBlock* pCode = new CodeBlock();
+    if ( !pCode->read( scriptFile, entryItr->value.mpData, entryItr->value.mSize, true ) )
+    {
+        delete pCode;
+        return NULL;
+    }
+
+    return pCode;
+}
+
+} // namespace ScriptBundle
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction(buildScriptBundle, S32, 3, 3, "( bundleFile , pattern ) Compiles all the scripts matching the pattern into a script bundle.\n"
+                                                                "@param bundleFile The path of the bundle to write.\n"
+                                                                "@param pattern A pattern matching the scripts to bundle e.g. \"^MyModule/*.cs\".\n"
+                                                                "@return Returns the number of scripts bundled or -1 on failure.\n"
+                                                                "@sa mountScriptBundle")
+{
+   return ScriptBundle::build( argv[1], argv[2] );
+}
+
+ConsoleFunction(mountScriptBundle, bool, 2, 2, "( bundleFile ) Mounts a script bundle. Scripts in the bundle are executed from it in preference to loose scripts and DSOs.\n"
+                                                                "@param bundleFile The path of the bundle to mount.\n"
+                                                                "@return Returns true if the bundle was mounted, false otherwise.\n"
+                                                                "@sa buildScriptBundle, unmountScriptBundles")
+{
+   return ScriptBundle::mount( argv[1] );
+}
+
+ConsoleFunction(unmountScriptBundles, void, 1, 1, "() Unmounts all the mounted script bundles.\n"
+                                                                "@return No return value.\n"
+                                                                "@sa mountScriptBundle")
+{
+   ScriptBundle::unmountAll();
+}
@@ -0,0 +1,70 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _SCRIPT_BUNDLE_H_
+#define _SCRIPT_BUNDLE_H_
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class CodeBlock;
+
+//-----------------------------------------------------------------------------
+
+/// A script bundle packs the compiled code of many scripts into a single file.
+///
+/// Executing a script normally probes the resource manager for both the script
+/// and its DSO, compares their file times and then reads the DSO a value at a
+/// time.  A mounted bundle is read with a single file read and holds the code
+/// already expanded to a word per instruction so scripts found in it are read
+/// straight from memory without touching the file system.  Bundled scripts take
+/// precedence over loose scripts and DSOs.
+///
+/// Bundle layout (little-endian):
+/// - U32 magic, U32 bundle version, U32 DSO version, U32 entry count.
+/// - Per entry: U32 name length, name (relative to the main.cs directory), U32 offset, U32 size.
+/// - The expanded code for each entry, offsets being relative to the end of the entries.
+namespace ScriptBundle
+{
+    /// Compiles all the scripts matching the pattern into a bundle file.
+    /// @return The number of scripts bundled or -1 on failure.
+    S32 build( const char* pBundleFile, const char* pPattern );
+
+    /// Mounts a bundle file.  Scripts in later bundles replace those in earlier ones.
+    bool mount( const char* pBundleFile );
+
+    /// Unmounts all the mounted bundles.
+    void unmountAll( void );
+
+    /// Gets whether the script is in a mounted bundle.
+    bool contains( const char* pScriptFile );
+
+    /// Reads the script from a mounted bundle.
+    /// @return The code block or NULL if the script is not in a mounted bundle.
+    CodeBlock* load( StringTableEntry scriptFile );
+}
+
+#endif // _SCRIPT_BUNDLE_H_
@@ -0,0 +1,601 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "console/scriptProfiler.h"
+
+#ifdef TORQUE_ENABLE_PROFILER
+
+#include "platform/platform.h"
+#include "console/console.h"
+#include "console/consoleInternal.h"
+#include "console/compiler.h"
+#include "console/codeBlock.h"
+#include "collection/hashTable.h"
+#include "debug/profiler.h"
+#include "debug/telnetDebugger.h"
+
+//-----------------------------------------------------------------------------
+
+namespace ScriptProfiler
+{
+
+bool gEnabled = false;
+bool gProfileLines = false;
+
+struct Function
+{
+    StringTableEntry mNamespace;
+    StringTableEntry mName;
+    StringTableEntry mPackage;
+    StringTableEntry mFile;
+    U32 mCalls;
+    U32 mActive;
+    F64 mInclusiveTime;
+    F64 mExclusiveTime;
+    Function* mNextHash;
+};
+
+struct Node
+{
+    Function* mFunction;
+    Node* mParent;
+    Node* mFirstChild;
+    Node* mNextSibling;
+    U32 mCalls;
+    F64 mInclusiveTime;
+    F64 mExclusiveTime;
+};
+
+struct Line
+{
+    U32 mHits;
+    F64 mTime;
+};
+
+struct FileLines
+{
+    StringTableEntry mFile;
+    Vector<Line> mLines;
+};
+
+struct LineRef
+{
+    FileLines* mpFile;
+    U32 mLine;
+};
+
+struct Frame
+{
+    Node* mNode;
+    F64 mExclusiveTime;
+    F64 mChildTime;
+    LineRef mCallerLine;
+};
+
+static const U32 FunctionHashSize = 1024;
+
+static Function* sFunctionHash[FunctionHashSize];
+static Vector<Function*> sFunctions;
+static Node sRootNode;
+static Vector<Node*> sNodes;
+static Vector<Frame> sFrames;
+static HashMap<StringTableEntry, FileLines*> sFiles;
+static FileLines* sLastFile = NULL;
+static LineRef sCurrentLine = { NULL, 0 };
+static U32 sLastEventTime[2];
+
+//-----------------------------------------------------------------------------
+
+static inline void advance( void )
+{
+    // Fetch the time since the last event.
+    const F64 elapsed = endHighResolutionTimer( sLastEventTime );
+    startHighResolutionTimer( sLastEventTime );
+
+    // Time outside any profiled code is not script time.
+    if ( sFrames.size() == 0 )
+        return;
+
+    sFrames.last().mExclusiveTime += elapsed;
+
+    if ( sCurrentLine.mpFile != NULL )
+        sCurrentLine.mpFile->mLines[sCurrentLine.mLine].mTime += elapsed;
+}
+
+//-----------------------------------------------------------------------------
+
+static Function* findFunction( StringTableEntry namespaceName, StringTableEntry functionName, StringTableEntry packageName, StringTableEntry fileName )
+{
+    // The names are string table entries so hash them by address.
+    const U32 hash = ( Hash::hash( (const void*)namespaceName ) ^
+        Hash::hash( (const void*)functionName ) * 31 ^
+        Hash::hash( (const void*)packageName ) * 17 ^
+        Hash::hash( (const void*)fileName ) * 7 ) % FunctionHashSize;
+
+    for ( Function* pFunction = sFunctionHash[hash]; pFunction != NULL; pFunction = pFunction->mNextHash )
+    {
+        if ( pFunction->mNamespace == namespaceName && pFunction->mName == functionName && pFunction->mPackage == packageName && pFunction->mFile == fileName )
+            return pFunction;
+    }
+
+    Function* pFunction = new Function;
+    pFunction->mNamespace = namespaceName;
+    pFunction->mName = functionName;
+    pFunction->mPackage = packageName;
+    pFunction->mFile = fileName;
+    pFunction->mCalls = 0;
+    pFunction->mActive = 0;
+    pFunction->mInclusiveTime = 0;
+    pFunction->mExclusiveTime = 0;
+    pFunction->mNextHash = sFunctionHash[hash];
+    sFunctionHash[hash] = pFunction;
+    sFunctions.push_back( pFunction );
+    return pFunction;
+}
+
+//-----------------------------------------------------------------------------
+
+static void formatFunctionName( const Function* pFunction, char* pBuffer, const U32 bufferSize )
+{
+    const char* pFile = pFunction->mFile != NULL ? pFunction->mFile : "";
+
+    if ( pFunction->mName == NULL )
+        dSprintf( pBuffer, bufferSize, pFunction->mFile != NULL ? "(exec) %s" : "(eval)", pFile );
+    else if ( pFunction->mNamespace != NULL && pFunction->mPackage != NULL )
+        dSprintf( pBuffer, bufferSize, "[%s]%s::%s() %s", pFunction->mPackage, pFunction->mNamespace, pFunction->mName, pFile );
+    else if ( pFunction->mNamespace != NULL )
+        dSprintf( pBuffer, bufferSize, "%s::%s() %s", pFunction->mNamespace, pFunction->mName, pFile );
+    else if ( pFunction->mPackage != NULL )
+        dSprintf( pBuffer, bufferSize, "[%s]%s() %s", pFunction->mPackage, pFunction->mName, pFile );
+    else
+        dSprintf( pBuffer, bufferSize, "%s() %s", pFunction->mName, pFile );
+}
+
+//-----------------------------------------------------------------------------
+
+static void setLineBreaks( const bool enabled )
+{
+    for ( CodeBlock* pCodeBlock = CodeBlock::getCodeBlockList(); pCodeBlock != NULL; pCodeBlock = pCodeBlock->nextFile )
+    {
+        if ( enabled )
+        {
+            pCodeBlock->setAllBreaks();
+        }
+        else
+        {
+            // Clear the breaks then let the debugger reapply its breakpoints.
+            pCodeBlock->clearAllBreaks();
+
+            if ( TelDebugger )
+                TelDebugger->addAllBreakpoints( pCodeBlock );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void enable( const bool enabled, const bool profileLines )
+{
+    const bool lineProfiling = enabled && profileLines;
+
+    // Start timing from here.
+    if ( enabled && !gEnabled )
+        startHighResolutionTimer( sLastEventTime );
+
+    gEnabled = enabled;
+
+    // Finish if line profiling is unchanged.
+    if ( lineProfiling == gProfileLines )
+        return;
+
+    // Drop the flag before clearing the breaks as the code blocks keep them while it is set.
+    if ( !lineProfiling )
+    {
+        gProfileLines = false;
+        setLineBreaks( false );
+        sCurrentLine.mpFile = NULL;
+        return;
+    }
+
+    gProfileLines = true;
+    setLineBreaks( true );
+}
+
+//-----------------------------------------------------------------------------
+
+void reset( void )
+{
+    // Detach any calls in progress from the data being cleared.
+    for ( S32 index = 0; index < sFrames.size(); ++index )
+    {
+        sFrames[index].mNode = NULL;
+        sFrames[index].mCallerLine.mpFile = NULL;
+    }
+    sCurrentLine.mpFile = NULL;
+
+    for ( S32 index = 0; index < sNodes.size(); ++index )
+        delete sNodes[index];
+    sNodes.clear();
+
+    for ( S32 index = 0; index < sFunctions.size(); ++index )
+        delete sFunctions[index];
+    sFunctions.clear();
+
+    for ( HashMap<StringTableEntry, FileLines*>::iterator fileItr = sFiles.begin(); fileItr != sFiles.end(); ++fileItr )
+        delete fileItr->value;
+    sFiles.clear();
+    sLastFile = NULL;
+
+    dMemset( sFunctionHash, 0, sizeof(sFunctionHash) );
+    dMemset( &sRootNode, 0, sizeof(sRootNode) );
+
+    startHighResolutionTimer( sLastEventTime );
+}
+
+//-----------------------------------------------------------------------------
+
+void enterFunction( CodeBlock* pCodeBlock, Namespace* pNamespace, StringTableEntry functionName, StringTableEntry packageName )
+{
+    advance();
+
+    // Fetch the parent, calls in progress across a reset being parented to the root.
+    Node* pParent = sFrames.size() > 0 && sFrames.last().mNode != NULL ? sFrames.last().mNode : &sRootNode;
+
+    const StringTableEntry namespaceName = functionName != NULL && pNamespace != NULL ? pNamespace->mName : NULL;
+    const StringTableEntry fileName = pCodeBlock->name;
+
+    // Find the node for this call path.
+    Node* pNode = pParent->mFirstChild;
+    while ( pNode != NULL )
+    {
+        const Function* pFunction = pNode->mFunction;
+        if ( pFunction->mName == functionName && pFunction->mNamespace == namespaceName && pFunction->mPackage == packageName && pFunction->mFile == fileName )
+            break;
+
+        pNode = pNode->mNextSibling;
+    }
+
+    if ( pNode == NULL )
+    {
+        pNode = new Node;
+        pNode->mFunction = findFunction( namespaceName, functionName, packageName, fileName );
+        pNode->mParent = pParent;
+        pNode->mFirstChild = NULL;
+        pNode->mNextSibling = pParent->mFirstChild;
+        pNode->mCalls = 0;
+        pNode->mInclusiveTime = 0;
+        pNode->mExclusiveTime = 0;
+        pParent->mFirstChild = pNode;
+        sNodes.push_back( pNode );
+    }
+
+    pNode->mCalls++;
+    pNode->mFunction->mCalls++;
+    pNode->mFunction->mActive++;
+
+    sFrames.increment();
+    Frame& frame = sFrames.last();
+    frame.mNode = pNode;
+    frame.mExclusiveTime = 0;
+    frame.mChildTime = 0;
+    frame.mCallerLine = sCurrentLine;
+}
+
+//-----------------------------------------------------------------------------
+
+void leaveFunction( void )
+{
+    AssertFatal( sFrames.size() > 0, "ScriptProfiler::leaveFunction() - Unbalanced call." );
+
+    advance();
+
+    const Frame frame = sFrames.last();
+    sFrames.pop_back();
+
+    // Resume timing the line that made the call.
+    sCurrentLine = frame.mCallerLine;
+
+    // Finish if the call was detached by a reset.
+    if ( frame.mNode == NULL )
+        return;
+
+    const F64 inclusiveTime = frame.mExclusiveTime + frame.mChildTime;
+
+    Node* pNode = frame.mNode;
+    pNode->mInclusiveTime += inclusiveTime;
+    pNode->mExclusiveTime += frame.mExclusiveTime;
+
+    // Only the outermost of any recursive calls counts towards the function inclusive time.
+    Function* pFunction = pNode->mFunction;
+    pFunction->mExclusiveTime += frame.mExclusiveTime;
+    if ( --pFunction->mActive == 0 )
+        pFunction->mInclusiveTime += inclusiveTime;
+
+    if ( sFrames.size() > 0 )
+        sFrames.last().mChildTime += inclusiveTime;
+}
+
+//-----------------------------------------------------------------------------
+
+void hitLine( CodeBlock* pCodeBlock, const U32 lineNumber )
+{
+    // Ignore evaluated strings.
+    if ( pCodeBlock->name == NULL )
+        return;
+
+    advance();
+
+    // Find the file lines.
+    FileLines* pFile = sLastFile;
+    if ( pFile == NULL || pFile->mFile != pCodeBlock->name )
+    {
+        HashMap<StringTableEntry, FileLines*>::iterator fileItr = sFiles.find( pCodeBlock->name );
+        if ( fileItr != sFiles.end() )
+        {
+            pFile = fileItr->value;
+        }
+        else
+        {
+            pFile = new FileLines;
+            pFile->mFile = pCodeBlock->name;
+            sFiles.insert( pCodeBlock->name, pFile );
+        }
+
+        sLastFile = pFile;
+    }
+
+    // Grow the lines as required.
+    if ( lineNumber >= (U32)pFile->mLines.size() )
+    {
+        const U32 oldSize = pFile->mLines.size();
+        pFile->mLines.setSize( lineNumber + 1 );
+        dMemset( pFile->mLines.address() + oldSize, 0, (lineNumber + 1 - oldSize) * sizeof(Line) );
+    }
+
+    pFile->mLines[lineNumber].mHits++;
+
+    // Time the line if it is in profiled code.
+    sCurrentLine.mpFile = sFrames.size() > 0 ? pFile : NULL;
+    sCurrentLine.mLine = lineNumber;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK functionCompare( const void* a, const void* b )
+{
+    const Function* pFunctionA = *(const Function**)a;
+    const Function* pFunctionB = *(const Function**)b;
+
+    if ( pFunctionA->mExclusiveTime == pFunctionB->mExclusiveTime )
+        return 0;
+
+    return pFunctionA->mExclusiveTime < pFunctionB->mExclusiveTime ? 1 : -1;
+}
+
+//-----------------------------------------------------------------------------
+
+static void dumpFlat( const F64 totalTime )
+{
+    Vector<Function*> functions( sFunctions );
+    dQsort( functions.address(), functions.size(), sizeof(Function*), functionCompare );
+
+    Con::printf( "Script Profiler: functions ordered by exclusive time -" );
+    Con::printf( "%% Excl  %% Incl     Calls  Function" );
+
+    char nameBuffer[1024];
+    for ( S32 index = 0; index < functions.size(); ++index )
+    {
+        const Function* pFunction = functions[index];
+        formatFunctionName( pFunction, nameBuffer, sizeof(nameBuffer) );
+        Con::printf( "%7.3f %7.3f %9d  %s",
+            100 * pFunction->mExclusiveTime / totalTime,
+            100 * pFunction->mInclusiveTime / totalTime,
+            pFunction->mCalls,
+            nameBuffer );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void sortChildren( Node* pNode )
+{
+    // Sort the children by inclusive time.
+    Node* pList = NULL;
+    while ( pNode->mFirstChild != NULL )
+    {
+        Node* pInsert = pNode->mFirstChild;
+        pNode->mFirstChild = pInsert->mNextSibling;
+        Node** pWalk = &pList;
+        while ( *pWalk != NULL && (*pWalk)->mInclusiveTime > pInsert->mInclusiveTime )
+            pWalk = &(*pWalk)->mNextSibling;
+        pInsert->mNextSibling = *pWalk;
+        *pWalk = pInsert;
+    }
+    pNode->mFirstChild = pList;
+}
+
+//-----------------------------------------------------------------------------
+
+static void dumpTreeRecurse( Node* pNode, char* pIndent, const U32 indentLength, const F64 totalTime )
+{
+    char nameBuffer[1024];
+    formatFunctionName( pNode->mFunction, nameBuffer, sizeof(nameBuffer) );
+    Con::printf( "%7.3f %7.3f %9d  %s%s",
+        100 * pNode->mInclusiveTime / totalTime,
+        100 * pNode->mExclusiveTime / totalTime,
+        pNode->mCalls,
+        pIndent,
+        nameBuffer );
+
+    sortChildren( pNode );
+
+    // Limit the indent depth.
+    const bool indent = indentLength < 128;
+    if ( indent )
+    {
+        pIndent[indentLength] = ' ';
+        pIndent[indentLength + 1] = ' ';
+        pIndent[indentLength + 2] = 0;
+    }
+
+    for ( Node* pChild = pNode->mFirstChild; pChild != NULL; pChild = pChild->mNextSibling )
+        dumpTreeRecurse( pChild, pIndent, indent ? indentLength + 2 : indentLength, totalTime );
+
+    pIndent[indentLength] = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static void dumpTree( const F64 totalTime )
+{
+    Con::printf( "Script Profiler: call tree ordered by inclusive time -" );
+    Con::printf( "%% Incl  %% Excl     Calls  Function" );
+
+    char indentBuffer[132];
+    indentBuffer[0] = 0;
+
+    sortChildren( &sRootNode );
+    for ( Node* pChild = sRootNode.mFirstChild; pChild != NULL; pChild = pChild->mNextSibling )
+        dumpTreeRecurse( pChild, indentBuffer, 0, totalTime );
+}
+
+//-----------------------------------------------------------------------------
+
+struct LineEntry
+{
+    StringTableEntry mFile;
+    U32 mLine;
+    const Line* mpLine;
+};
+
+static S32 QSORT_CALLBACK lineCompare( const void* a, const void* b )
+{
+    const LineEntry* pLineA = (const LineEntry*)a;
+    const LineEntry* pLineB = (const LineEntry*)b;
+
+    if ( pLineA->mpLine->mTime == pLineB->mpLine->mTime )
+        return 0;
+
+    return pLineA->mpLine->mTime < pLineB->mpLine->mTime ? 1 : -1;
+}
+
+//-----------------------------------------------------------------------------
+
+static void dumpLines( const F64 totalTime )
+{
+    Vector<LineEntry> lines;
+    for ( HashMap<StringTableEntry, FileLines*>::iterator fileItr = sFiles.begin(); fileItr != sFiles.end(); ++fileItr )
+    {
+        const FileLines* pFile = fileItr->value;
+        for ( U32 line = 0; line < (U32)pFile->mLines.size(); ++line )
+        {
+            if ( pFile->mLines[line].mHits == 0 )
+                continue;
+
+            LineEntry entry;
+            entry.mFile = pFile->mFile;
+            entry.mLine = line;
+            entry.mpLine = &pFile->mLines[line];
+            lines.push_back( entry );
+        }
+    }
+
+    dQsort( lines.address(), lines.size(), sizeof(LineEntry), lineCompare );
+
+    Con::printf( "Script Profiler: lines ordered by exclusive time -" );
+    Con::printf( "%% Excl       Hits  Line" );
+
+    for ( S32 index = 0; index < lines.size(); ++index )
+    {
+        Con::printf( "%7.3f %10d  %s (%d)",
+            100 * lines[index].mpLine->mTime / totalTime,
+            lines[index].mpLine->mHits,
+            lines[index].mFile,
+            lines[index].mLine );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void dump( const char* pReport )
+{
+    // Bring the calls in progress up to date.
+    advance();
+
+    // Total the script time.
+    F64 totalTime = 0;
+    for ( S32 index = 0; index < sFunctions.size(); ++index )
+        totalTime += sFunctions[index]->mExclusiveTime;
+
+    for ( S32 index = 0; index < sFrames.size(); ++index )
+        totalTime += sFrames[index].mExclusiveTime;
+
+    if ( totalTime <= 0 )
+    {
+        Con::printf( "Script Profiler: No script time has been recorded." );
+        return;
+    }
+
+    const bool all = pReport == NULL || *pReport == 0;
+
+    if ( all || dStricmp( pReport, "flat" ) == 0 )
+        dumpFlat( totalTime );
+
+    if ( all || dStricmp( pReport, "tree" ) == 0 )
+        dumpTree( totalTime );
+
+    if ( all || dStricmp( pReport, "lines" ) == 0 )
+        dumpLines( totalTime );
+}
+
+} // namespace ScriptProfiler
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( ScriptProfiler, "Script profiler functionality.");
+
+ConsoleFunction(scriptProfilerEnable, void, 2, 3, "( enable, [profileLines] ) Enables (or disables) profiling of script functions.\n"
+                                                                "@param enable Whether to profile script functions.\n"
+                                                                "@param profileLines Whether to also profile script lines.  Defaults to false.\n"
+                                                                "@return No return value.\n"
+                                                                "@sa scriptProfilerDump, scriptProfilerReset")
+{
+   ScriptProfiler::enable( dAtob(argv[1]), argc > 2 && dAtob(argv[2]) );
+}
+
+ConsoleFunction(scriptProfilerDump, void, 1, 2, "( [report] ) Dumps the script profiler data to the console.\n"
+                                                                "@param report The report to dump: \"flat\" for functions, \"tree\" for the call tree or \"lines\" for lines.  Defaults to all of them.\n"
+                                                                "@return No return value.\n"
+                                                                "@sa scriptProfilerEnable")
+{
+   ScriptProfiler::dump( argc > 1 ? argv[1] : "" );
+}
+
+ConsoleFunction(scriptProfilerReset, void, 1, 1, "() Clears all the data gathered by the script profiler.\n"
+                                                                "@return No return value.")
+{
+   ScriptProfiler::reset();
+}
+
+ConsoleFunctionGroupEnd( ScriptProfiler );
+
+#endif // TORQUE_ENABLE_PROFILER
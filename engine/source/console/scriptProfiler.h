@@ -0,0 +1,94 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCRIPT_PROFILER_H_
+#define _SCRIPT_PROFILER_H_
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#include "torqueConfig.h"
+
+#ifdef TORQUE_ENABLE_PROFILER
+
+//-----------------------------------------------------------------------------
+
+class CodeBlock;
+class Namespace;
+
+//-----------------------------------------------------------------------------
+
+/// The script profiler attributes the time spent in the script interpreter to script functions.
+///
+/// Each call records its inclusive time (including the functions it calls), its exclusive time
+/// and its call count both per function and per call path.  Executing a script file or an
+/// evaluated string counts as a call of its own so that time spent outside of any function is
+/// still accounted for.  Optionally, time and hits are also attributed to script lines by
+/// placing the same break instructions the debuggers use on every line.
+///
+/// The profiler uses the engine profiler timers so it is only available when the engine
+/// profiler is.  When not enabled, the interpreter only tests a flag per call.
+///
+/// Examples of script use:
+/// @code
+/// scriptProfilerEnable(true, true);   // Enable with line profiling.
+/// scriptProfilerDump("flat");         // Dump the per-function report.
+/// scriptProfilerDump("tree");         // Dump the call-tree report.
+/// scriptProfilerDump("lines");        // Dump the per-line report.
+/// scriptProfilerReset();
+/// @endcode
+namespace ScriptProfiler
+{
+    extern bool gEnabled;
+    extern bool gProfileLines;
+
+    /// Gets whether calls are being profiled.
+    inline bool isEnabled( void ) { return gEnabled; }
+
+    /// Gets whether lines are being profiled.
+    inline bool isProfilingLines( void ) { return gProfileLines; }
+
+    /// Enables or disables profiling.
+    void enable( const bool enabled, const bool profileLines );
+
+    /// Clears all the data gathered.
+    void reset( void );
+
+    /// Dumps a report to the console.
+    /// @param pReport "flat", "tree", "lines" or an empty string for all the reports.
+    void dump( const char* pReport );
+
+    /// Called by the interpreter when it starts executing code.
+    /// The function name is NULL when executing a script file or an evaluated string.
+    void enterFunction( CodeBlock* pCodeBlock, Namespace* pNamespace, StringTableEntry functionName, StringTableEntry packageName );
+
+    /// Called by the interpreter when it finishes executing code it started with enterFunction().
+    void leaveFunction( void );
+
+    /// Called by the interpreter when it starts executing a line.
+    void hitLine( CodeBlock* pCodeBlock, const U32 lineNumber );
+}
+
+#endif // TORQUE_ENABLE_PROFILER
+
+#endif // _SCRIPT_PROFILER_H_
@@ -109,6 +109,11 @@ public:
 
 extern Profiler *gProfiler;
 
+/// Start a high resolution timer.
+void startHighResolutionTimer(U32 time[2]);
+/// Get the ticks elapsed since the high resolution timer was started.
+U32 endHighResolutionTimer(U32 time[2]);
+
 struct ProfilerRootData
 {
    const char *mName;
@@ -45,12 +45,14 @@
 #include "network/telnetConsole.h"
 #include "debug/telnetDebugger.h"
 #include "console/consoleTypes.h"
+#include "messaging/dispatcher.h"
 #include "math/mathTypes.h"
 #include "graphics/TextureManager.h"
 #include "io/resource/resourceManager.h"
 #include "platform/platformVideo.h"
 #include "network/netStringTable.h"
 #include "memory/frameAllocator.h"
+#include "memory/memoryTracker.h"
 #include "game/version.h"
 #include "debug/profiler.h"
 #include "network/serverQuery.h"
@@ -459,6 +461,10 @@ void DefaultGame::mainLoop( void )
     Game->processEvents(); // process all non-sim posted events.
          PROFILE_END();
          PROFILE_END();
+
+#ifdef TORQUE_TRACK_MEMORY
+    Memory::samplePeaks();
+#endif
     
 #ifdef TORQUE_OS_IOS_PROFILE
     iPhoneProfilerEnd("MAIN_LOOP");
@@ -568,6 +574,10 @@ void DefaultGame::processTimeEvent(TimeEvent *event)
    Platform::advanceTime(elapsedTime);
    bool tickPass;
 
+   PROFILE_START(DeliverPostedMessages);
+   Dispatcher::deliverPostedMessages();
+   PROFILE_END();
+
     PROFILE_START(ServerProcess);
 #ifdef TORQUE_OS_IOS_PROFILE
 iPhoneProfilerStart("SERVER_PROC");
@@ -32,6 +32,7 @@
 #include "console/consoleInternal.h"
 #include "console/consoleTypes.h"
 #include "memory/safeDelete.h"
+#include "memory/memoryTracker.h"
 #include "math/mMath.h"
 
 //---------------------------------------------------------------------------------------------------------------------
@@ -754,6 +755,8 @@ void TextureManager::createGLName( TextureObject* pTextureObject )
 
 TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap* pNewBitmap, TextureHandle::TextureHandleType type, bool clampToEdge)
 {
+    MEMORY_TAG_SCOPE(TagTextures);
+
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
 
@@ -838,6 +841,8 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
 
 TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly, bool force16Bit )
 {
+    MEMORY_TAG_SCOPE(TagTextures);
+
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
 
@@ -83,6 +83,9 @@ void dglDrawBitmapStretchSR(TextureObject* texture,
                        F32			 fSpin,
                        bool				bSilhouette)
 {	
+   // Draw any batched text first to preserve the drawing order.
+   dglFlushTextBatch();
+
    AssertFatal(texture != NULL, "GSurface::drawBitmapStretchSR: NULL Handle");
    if(!dstRect.isValidRect())
       return;
@@ -323,61 +326,105 @@ struct TextVertex
 
 //------------------------------------------------------------------------------
 
-U32 dglDrawTextN(GFont*          font,
-                 const Point2I&  ptDraw,
-                 const UTF8*     in_string,
-                 U32             n,
-                 const ColorI*   colorTable,
-                 const U32       maxColorIndex,
-                 F32             rot)
+/// Glyph quads are accumulated per texture sheet and drawn with a single call per sheet.
+/// Outside of a text batch the accumulated quads are drawn at the end of each string, within
+/// a text batch they are drawn when the batch ends or the clip rectangle changes.
+struct TextBatchSheet
 {
-   PROFILE_START(DrawText_UTF8);
-   
-   U32 len = dStrlen(in_string) + 1;
-   FrameTemp<UTF16> ubuf(len);
-   convertUTF8toUTF16(in_string, ubuf, len);
-   U32 tmp = dglDrawTextN(font, ptDraw, ubuf, n, colorTable, maxColorIndex, rot);
+   TextureObject*       mpTexture;
+   Vector<TextVertex>   mVertices;
+};
 
-   PROFILE_END();
+#ifdef TORQUE_OS_IOS
+// Triangle list as there are no quads.
+#define TEXT_VERTICES_PER_GLYPH 6
+#else
+#define TEXT_VERTICES_PER_GLYPH 4
+#endif
 
-   return tmp;
-}
+namespace {
 
-//-----------------------------------------------------------------------------
+Vector<TextBatchSheet*> sgTextBatchSheets;
+TextBatchSheet* sgLastTextBatchSheet = NULL;
+U32 sgTextBatchVertexCount = 0;
+S32 sgTextBatchDepth = 0;
 
-#ifdef TORQUE_OS_IOS
-U32 dglDrawTextN(GFont*          font,
-                 const Point2I&  ptDraw,
-                 const UTF16*    in_string,
-                 U32             n,
-                 const ColorI*   colorTable,
-                 const U32       maxColorIndex,
-                 F32             rot)
+} // namespace {}
+
+//------------------------------------------------------------------------------
 
+static TextBatchSheet* dglFindTextBatchSheet( TextureObject* pTexture )
 {
-   // return on zero length strings
-   if( n < 1 )
-      return ptDraw.x;
-   PROFILE_START(DrawText);
+   // Fast path for consecutive glyphs on the same sheet.
+   if ( sgLastTextBatchSheet != NULL && sgLastTextBatchSheet->mpTexture == pTexture )
+      return sgLastTextBatchSheet;
 
-   MatrixF rotMatrix( EulerF( 0.0, 0.0, mDegToRad( rot ) ) );
-   Point3F offset( ptDraw.x, ptDraw.y, 0.0 );
-   Point3F points[4];
+   TextBatchSheet* pUnusedSheet = NULL;
 
-   U32 nCharCount = 0;
+   for( S32 index = 0; index < sgTextBatchSheets.size(); ++index )
+   {
+      TextBatchSheet* pSheet = sgTextBatchSheets[index];
 
-   Point2I     pt;
-   UTF16       c;
-   pt.x                 = 0;
+      if ( pSheet->mpTexture == pTexture )
+      {
+         sgLastTextBatchSheet = pSheet;
+         return pSheet;
+      }
 
-   ColorI                  currentColor;
-   S32                     currentPt = 0;
+      if ( pUnusedSheet == NULL && pSheet->mVertices.size() == 0 )
+         pUnusedSheet = pSheet;
+   }
 
-   TextureObject *lastTexture = NULL;
+   // Reuse an empty sheet or create a new one.
+   if ( pUnusedSheet == NULL )
+   {
+      pUnusedSheet = new TextBatchSheet();
+      sgTextBatchSheets.push_back( pUnusedSheet );
+   }
 
-   currentColor      = sg_bitmapModulation;
+   pUnusedSheet->mpTexture = pTexture;
+   sgLastTextBatchSheet = pUnusedSheet;
+
+   return pUnusedSheet;
+}
+
+//------------------------------------------------------------------------------
+
+static inline void dglSubmitTextGlyph( TextureObject* pTexture, const Point3F* pPoints, const F32 texLeft, const F32 texTop, const F32 texRight, const F32 texBottom, const ColorI& color )
+{
+   // NOTE: Points are ordered top-left, top-right, bottom-right, bottom-left.
+   TextBatchSheet* pSheet = dglFindTextBatchSheet( pTexture );
+
+   const U32 vertexIndex = pSheet->mVertices.size();
+   pSheet->mVertices.setSize( vertexIndex + TEXT_VERTICES_PER_GLYPH );
+   TextVertex* pVertex = pSheet->mVertices.address() + vertexIndex;
+
+#ifdef TORQUE_OS_IOS
+   pVertex[0].set( pPoints[0].x, pPoints[0].y, texLeft, texTop, color );
+   pVertex[1].set( pPoints[1].x, pPoints[1].y, texRight, texTop, color );
+   pVertex[2].set( pPoints[3].x, pPoints[3].y, texLeft, texBottom, color );
+   pVertex[3].set( pPoints[1].x, pPoints[1].y, texRight, texTop, color );
+   pVertex[4].set( pPoints[2].x, pPoints[2].y, texRight, texBottom, color );
+   pVertex[5].set( pPoints[3].x, pPoints[3].y, texLeft, texBottom, color );
+#else
+   pVertex[0].set( pPoints[3].x, pPoints[3].y, texLeft, texBottom, color );
+   pVertex[1].set( pPoints[2].x, pPoints[2].y, texRight, texBottom, color );
+   pVertex[2].set( pPoints[1].x, pPoints[1].y, texRight, texTop, color );
+   pVertex[3].set( pPoints[0].x, pPoints[0].y, texLeft, texTop, color );
+#endif
+
+   sgTextBatchVertexCount += TEXT_VERTICES_PER_GLYPH;
+}
+
+//------------------------------------------------------------------------------
 
-   FrameTemp<TextVertex> vert(4*n);
+void dglFlushTextBatch()
+{
+   // Finish if nothing to draw.
+   if ( sgTextBatchVertexCount == 0 )
+      return;
+
+   PROFILE_SCOPE(DrawTextFlush);
 
    glDisable(GL_LIGHTING);
 
@@ -386,180 +433,114 @@ U32 dglDrawTextN(GFont*          font,
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glEnable(GL_BLEND);
 
-   //Luma: Optimise by setting states once before inner loop
    glEnableClientState ( GL_VERTEX_ARRAY );
    glEnableClientState ( GL_COLOR_ARRAY );
    glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
-   glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
-   glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
-   glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
 
-   // first build the point, color, and coord arrays
-   U32 i;
-
-   for(i = 0,c = in_string[i];in_string[i] && i < n;i++,c = in_string[i])
+   for( S32 index = 0; index < sgTextBatchSheets.size(); ++index )
    {
-      nCharCount++;
-      if(nCharCount > n)
-          break;
-
-      // We have to do a little dance here since \t = 0x9, \n = 0xa, and \r = 0xd
-      if ((c >=  1 && c <=  7) ||
-         (c >= 11 && c <= 12) ||
-         (c == 14))
-      {
-         // Color code
-         if (colorTable)
-         {
-            static U8 remap[15] =
-            {
-               0x0, // 0 special null terminator
-               0x0, // 1 ascii start-of-heading??
-               0x1, 
-               0x2, 
-               0x3, 
-               0x4, 
-               0x5, 
-               0x6, 
-               0x0, // 8 special backspace
-               0x0, // 9 special tab
-               0x0, // a special \n
-               0x7, 
-               0x8,
-               0x0, // a special \r
-               0x9 
-            };
+      TextBatchSheet* pSheet = sgTextBatchSheets[index];
 
-            U8 remapped = remap[c];
-            // Ignore if the color is greater than the specified max index:
-            if ( remapped <= maxColorIndex )
-            {
-               const ColorI &clr = colorTable[remapped];
-               sg_bitmapModulation = clr;
-               currentColor = clr;
-            }
-         }
+      if ( pSheet->mVertices.size() == 0 )
          continue;
-      }
 
-      // reset color?
-      if ( c == 15 )
-      {
-         currentColor = sg_textAnchorColor;
-         sg_bitmapModulation = sg_textAnchorColor;
-         continue;
-      }
+      const TextVertex* pVertices = pSheet->mVertices.address();
 
-      // push color:
-      if ( c == 16 )
-      {
-         sg_stackColor = sg_bitmapModulation;
-         continue;
-      }
+      glBindTexture(GL_TEXTURE_2D, pSheet->mpTexture->getGLTextureName());
+      glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(pVertices[0].p) );
+      glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(pVertices[0].c) );
+      glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(pVertices[0].t) );
 
-      // pop color:
-      if ( c == 17 )
-      {
-         currentColor = sg_stackColor;
-         sg_bitmapModulation = sg_stackColor;
-         continue;
-      }
+#ifdef TORQUE_OS_IOS
+      glDrawArrays( GL_TRIANGLES, 0, pSheet->mVertices.size() );
+#else
+      glDrawArrays( GL_QUADS, 0, pSheet->mVertices.size() );
+#endif
 
-      // Tab character
-      if ( c == dT('\t') ) 
-      {
-          const PlatformFont::CharInfo &ci = font->getCharInfo( dT(' ') );
-          pt.x += ci.xIncrement * GFont::TabWidthInSpaces;
-          continue;
-      }
+      // Keep the storage for the next batch.
+      pSheet->mVertices.setSize( 0 );
+      pSheet->mpTexture = NULL;
+   }
 
-      if( !font->isValidChar( c ) )  
-         continue;
+   glDisableClientState ( GL_VERTEX_ARRAY );
+   glDisableClientState ( GL_COLOR_ARRAY );
+   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
 
-      const PlatformFont::CharInfo &ci = font->getCharInfo(c);
+   glDisable(GL_BLEND);
+   glDisable(GL_TEXTURE_2D);
 
-      if(ci.bitmapIndex == -1)
-      {
-         pt.x += ci.xOrigin + ci.xIncrement;
-         continue;
-      }
+   sgLastTextBatchSheet = NULL;
+   sgTextBatchVertexCount = 0;
+}
 
-      TextureObject *newObj = font->getTextureHandle(ci.bitmapIndex);
-      if(newObj != lastTexture)
-      {
-         if(currentPt)
-         {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
+//------------------------------------------------------------------------------
 
-            //Luma:	More optimal rendering
-            for (S32 i=0; i<currentPt; i+=4) 
-            {
-                glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
-            }
-            currentPt = 0;
-         }
-         lastTexture = newObj;
-      }
-      if(ci.width != 0 && ci.height != 0)
-      {
-         pt.y = font->getBaseline() - ci.yOrigin;
-         pt.x += ci.xOrigin;
+void dglBeginTextBatch()
+{
+   sgTextBatchDepth++;
+}
 
-         F32 texLeft   = F32(ci.xOffset)             / F32(lastTexture->getTextureWidth());
-         F32 texRight  = F32(ci.xOffset + ci.width)  / F32(lastTexture->getTextureWidth());
-         F32 texTop    = F32(ci.yOffset)             / F32(lastTexture->getTextureHeight());
-         F32 texBottom = F32(ci.yOffset + ci.height) / F32(lastTexture->getTextureHeight());
+//------------------------------------------------------------------------------
 
-         F32 screenLeft   = pt.x;
-         F32 screenRight  = pt.x + ci.width;
-         F32 screenTop    = pt.y;
-         F32 screenBottom = pt.y + ci.height;
+void dglEndTextBatch()
+{
+   AssertFatal( sgTextBatchDepth > 0, "dglEndTextBatch() - Unbalanced text batch." );
 
-         points[0] = Point3F(screenLeft, screenTop, 0.0);
-         points[1] = Point3F(screenRight,  screenTop, 0.0);
-         points[2] = Point3F( screenLeft,  screenBottom, 0.0);
-         points[3] = Point3F( screenRight, screenBottom, 0.0);
+   if ( --sgTextBatchDepth == 0 )
+      dglFlushTextBatch();
+}
 
-         for( int i=0; i<4; i++ )
-         {
-            rotMatrix.mulP( points[i] );
-            points[i] += offset;
-         }
-         vert[currentPt++].set(points[0].x, points[0].y, texLeft, texTop, currentColor);
-         vert[currentPt++].set(points[1].x, points[1].y, texRight, texTop, currentColor);
-         vert[currentPt++].set(points[2].x, points[2].y, texLeft, texBottom, currentColor);
-         vert[currentPt++].set(points[3].x, points[3].y, texRight, texBottom, currentColor);
-         pt.x += ci.xIncrement - ci.xOrigin;
-      }
-      else
-         pt.x += ci.xIncrement;
-   }
-   if(currentPt)
+//------------------------------------------------------------------------------
+
+static void dglDrawTextRun( GFont* font, const GFont::TextRun* pRun, const Point2I& ptDraw, const ColorI& color )
+{
+   const F32 offsetX = (F32)ptDraw.x;
+   const F32 offsetY = (F32)ptDraw.y;
+
+   Point3F points[4];
+
+   const GFont::TextRun::Glyph* pGlyph = pRun->mGlyphs.address();
+   const GFont::TextRun::Glyph* pGlyphEnd = pGlyph + pRun->mGlyphs.size();
+
+   for( ; pGlyph != pGlyphEnd; ++pGlyph )
    {
-       //Luma:	More optimal rendering
-       glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-       for (S32 i=0; i<currentPt; i+=4) 
-       {
-            glDrawArrays(GL_TRIANGLE_STRIP, i, 4);
-       }
-   }
+      const F32 screenLeft   = offsetX + pGlyph->mScreenLeft;
+      const F32 screenRight  = offsetX + pGlyph->mScreenRight;
+      const F32 screenTop    = offsetY + pGlyph->mScreenTop;
+      const F32 screenBottom = offsetY + pGlyph->mScreenBottom;
 
-   glDisableClientState ( GL_VERTEX_ARRAY );
-   glDisableClientState ( GL_COLOR_ARRAY );
-   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
+      points[0].set( screenLeft, screenTop, 0.0f );
+      points[1].set( screenRight, screenTop, 0.0f );
+      points[2].set( screenRight, screenBottom, 0.0f );
+      points[3].set( screenLeft, screenBottom, 0.0f );
 
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
+      dglSubmitTextGlyph( font->getTextureObject( pGlyph->mSheet ), points, pGlyph->mTexLeft, pGlyph->mTexTop, pGlyph->mTexRight, pGlyph->mTexBottom, color );
+   }
+}
 
-   pt.x += ptDraw.x; // DAW: Account for the fact that we removed the drawing point from the text start at the beginning.
+//------------------------------------------------------------------------------
+
+U32 dglDrawTextN(GFont*          font,
+                 const Point2I&  ptDraw,
+                 const UTF8*     in_string,
+                 U32             n,
+                 const ColorI*   colorTable,
+                 const U32       maxColorIndex,
+                 F32             rot)
+{
+   PROFILE_START(DrawText_UTF8);
+   
+   U32 len = dStrlen(in_string) + 1;
+   FrameTemp<UTF16> ubuf(len);
+   convertUTF8toUTF16(in_string, ubuf, len);
+   U32 tmp = dglDrawTextN(font, ptDraw, ubuf, n, colorTable, maxColorIndex, rot);
 
-   AssertFatal(pt.x >= ptDraw.x, "How did this happen?");
    PROFILE_END();
 
-   return pt.x - ptDraw.x;
+   return tmp;
 }
 
-#else
+//-----------------------------------------------------------------------------
 
 U32 dglDrawTextN(GFont*          font,
                  const Point2I&  ptDraw,
@@ -574,6 +555,23 @@ U32 dglDrawTextN(GFont*          font,
       return ptDraw.x;
    PROFILE_START(DrawText);
 
+   // Plain, unrotated text uses the font's shaped text runs.
+   if ( mIsZero( rot ) )
+   {
+      const GFont::TextRun* pRun = font->getTextRun( in_string, n );
+
+      if ( pRun != NULL )
+      {
+         dglDrawTextRun( font, pRun, ptDraw, sg_bitmapModulation );
+
+         if ( sgTextBatchDepth == 0 )
+            dglFlushTextBatch();
+
+         PROFILE_END();
+         return pRun->mAdvance;
+      }
+   }
+
    MatrixF rotMatrix( EulerF( 0.0, 0.0, mDegToRad( rot ) ) );
    Point3F offset( (F32)ptDraw.x, (F32)ptDraw.y, 0.0f );
    Point3F points[4];
@@ -585,30 +583,9 @@ U32 dglDrawTextN(GFont*          font,
    pt.x                 = 0;
 
    ColorI                  currentColor;
-   S32                     currentPt = 0;
-
-   TextureObject *lastTexture = NULL;
 
    currentColor      = sg_bitmapModulation;
 
-   FrameTemp<TextVertex> vert(4*n);
-
-   glDisable(GL_LIGHTING);
-
-   glEnable(GL_TEXTURE_2D);
-   glTexEnvi(GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE);
-   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-   glEnable(GL_BLEND);
-
-   glEnableClientState ( GL_VERTEX_ARRAY );
-   glVertexPointer     ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].p) );
-
-   glEnableClientState ( GL_COLOR_ARRAY );
-   glColorPointer      ( 4, GL_UNSIGNED_BYTE, sizeof(TextVertex), &(vert[0].c) );
-
-   glEnableClientState ( GL_TEXTURE_COORD_ARRAY );
-   glTexCoordPointer   ( 2, GL_FLOAT, sizeof(TextVertex), &(vert[0].t) );
-
    // first build the point, color, and coord arrays
    U32 i;
 
@@ -699,36 +676,27 @@ U32 dglDrawTextN(GFont*          font,
          continue;
       }
 
-      TextureObject *newObj = font->getTextureHandle(ci.bitmapIndex);
-      if(newObj != lastTexture)
-      {
-         if(currentPt)
-         {
-            glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-            glDrawArrays( GL_QUADS, 0, currentPt );
-            currentPt = 0;
-         }
-         lastTexture = newObj;
-      }
       if(ci.width != 0 && ci.height != 0)
       {
+         TextureObject *pTexture = font->getTextureObject(ci.bitmapIndex);
+
          pt.y = font->getBaseline() - ci.yOrigin;
          pt.x += ci.xOrigin;
 
-         F32 texLeft   = F32(ci.xOffset)             / F32(lastTexture->getTextureWidth());
-         F32 texRight  = F32(ci.xOffset + ci.width)  / F32(lastTexture->getTextureWidth());
-         F32 texTop    = F32(ci.yOffset)             / F32(lastTexture->getTextureHeight());
-         F32 texBottom = F32(ci.yOffset + ci.height) / F32(lastTexture->getTextureHeight());
+         F32 texLeft   = F32(ci.xOffset)             / F32(pTexture->getTextureWidth());
+         F32 texRight  = F32(ci.xOffset + ci.width)  / F32(pTexture->getTextureWidth());
+         F32 texTop    = F32(ci.yOffset)             / F32(pTexture->getTextureHeight());
+         F32 texBottom = F32(ci.yOffset + ci.height) / F32(pTexture->getTextureHeight());
 
          F32 screenLeft   = (F32)pt.x;
          F32 screenRight  = (F32)(pt.x + ci.width);
          F32 screenTop    = (F32)pt.y;
          F32 screenBottom = (F32)(pt.y + ci.height);
 
-         points[0] = Point3F(screenLeft, screenBottom, 0.0);
-         points[1] = Point3F(screenRight,  screenBottom, 0.0);
-         points[2] = Point3F( screenRight,  screenTop, 0.0);
-         points[3] = Point3F( screenLeft, screenTop, 0.0);
+         points[0] = Point3F( screenLeft, screenTop, 0.0);
+         points[1] = Point3F( screenRight, screenTop, 0.0);
+         points[2] = Point3F( screenRight, screenBottom, 0.0);
+         points[3] = Point3F( screenLeft, screenBottom, 0.0);
 
          for( int i=0; i<4; i++ )
          {
@@ -736,27 +704,16 @@ U32 dglDrawTextN(GFont*          font,
             points[i] += offset;
          }
 
-         vert[currentPt++].set(points[0].x, points[0].y, texLeft, texBottom, currentColor);
-         vert[currentPt++].set(points[1].x, points[1].y, texRight, texBottom, currentColor);
-         vert[currentPt++].set(points[2].x, points[2].y, texRight, texTop, currentColor);
-         vert[currentPt++].set(points[3].x, points[3].y, texLeft, texTop, currentColor);
+         dglSubmitTextGlyph( pTexture, points, texLeft, texTop, texRight, texBottom, currentColor );
+
          pt.x += ci.xIncrement - ci.xOrigin;
       }
       else
          pt.x += ci.xIncrement;
    }
-   if(currentPt)
-   {
-      glBindTexture(GL_TEXTURE_2D, lastTexture->getGLTextureName());
-      glDrawArrays( GL_QUADS, 0, currentPt );
-   }
-
-   glDisableClientState ( GL_VERTEX_ARRAY );
-   glDisableClientState ( GL_COLOR_ARRAY );
-   glDisableClientState ( GL_TEXTURE_COORD_ARRAY );
 
-   glDisable(GL_BLEND);
-   glDisable(GL_TEXTURE_2D);
+   if ( sgTextBatchDepth == 0 )
+      dglFlushTextBatch();
 
    pt.x += ptDraw.x; // DAW: Account for the fact that we removed the drawing point from the text start at the beginning.
 
@@ -765,13 +722,14 @@ U32 dglDrawTextN(GFont*          font,
 
    return pt.x - ptDraw.x;
 }
-#endif
 
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
 // Drawing primitives
 
 void dglDrawLine(S32 x1, S32 y1, S32 x2, S32 y2, const ColorI &color)
 {
+   dglFlushTextBatch();
+
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -804,6 +762,8 @@ void dglDrawLine(const Point2I &startPt, const Point2I &endPt, const ColorI &col
 
 void dglDrawRect(const Point2I &upperL, const Point2I &lowerR, const ColorI &color, const float &lineWidth)
 {
+   dglFlushTextBatch();
+
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -845,6 +805,8 @@ void dglDrawRect(const RectI &rect, const ColorI &color, const float &lineWidth)
 
 void dglDrawRectFill(const Point2I &upperL, const Point2I &lowerR, const ColorI &color)
 {
+   dglFlushTextBatch();
+
    glEnable(GL_BLEND);
    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
    glDisable(GL_TEXTURE_2D);
@@ -1110,6 +1072,9 @@ void dglSolidCube(const Point3F & extent, const Point3F & center)
 
 void dglSetClipRect(const RectI &clipRect)
 {
+   // Draw any batched text with the outgoing clip rectangle.
+   dglFlushTextBatch();
+
    glMatrixMode(GL_PROJECTION);
    glLoadIdentity();
 
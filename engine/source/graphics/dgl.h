@@ -158,6 +158,13 @@ U32 dglDrawText(GFont *font, const Point2I &ptDraw, const UTF8 *in_string, const
 U32 dglDrawTextN(GFont *font, const Point2I &ptDraw, const UTF16 *in_string, U32 n, const ColorI *colorTable = NULL, const U32 maxColorIndex = 9, F32 rot = 0.f);
 /// Converts UTF8 text to UTF16, and calls the UTF16 version of dglDrawTextN
 U32 dglDrawTextN(GFont *font, const Point2I &ptDraw, const UTF8  *in_string, U32 n, const ColorI *colorTable = NULL, const U32 maxColorIndex = 9, F32 rot = 0.f);
+/// Begins a text batch.  Text drawn within a batch is accumulated per font texture sheet and drawn
+/// with a single call per sheet when the batch ends or the clip rectangle changes.  Batches may be nested.
+void dglBeginTextBatch();
+/// Ends a text batch, drawing any accumulated text if this is the outermost batch.
+void dglEndTextBatch();
+/// Draws any accumulated text immediately.
+void dglFlushTextBatch();
 /// @}
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
 // Drawing primitives
@@ -34,6 +34,7 @@
 #include "memory/safeDelete.h"
 #include "memory/frameAllocator.h"
 #include "string/unicode.h"
+#include "algorithm/hashFunction.h"
 #include "zlib.h"
 #include "ctype.h"  // Needed for isupper and tolower
 
@@ -441,9 +442,49 @@ Resource<GFont> GFont::create(const char *faceName, U32 size, const char *cacheD
 
 //-------------------------------------------------------------------------
 
+GFont::CharInfoList::CharInfoList() :
+   mSize(0)
+{
+   for(U32 i = 0; i < PageCount; i++)
+      mPages[i] = NULL;
+}
+
+GFont::CharInfoList::~CharInfoList()
+{
+   for(U32 i = 0; i < PageCount; i++)
+      delete [] mPages[i];
+}
+
+void GFont::CharInfoList::push_back(const PlatformFont::CharInfo& charInfo)
+{
+   AssertFatal(mSize < MaxSize, "GFont::CharInfoList - Too many characters.");
+
+   const S32 page = mSize >> PageShift;
+   if(mPages[page] == NULL)
+      mPages[page] = new PlatformFont::CharInfo[PageSize];
+
+   mPages[page][mSize & (PageSize - 1)] = charInfo;
+   mSize++;
+}
+
+void GFont::CharInfoList::setSize(const S32 size)
+{
+   AssertFatal(size >= 0 && size <= MaxSize, "GFont::CharInfoList - Invalid size.");
+
+   // Pages are only ever added so that existing characters never move.
+   for(S32 page = 0; page < ((size + PageSize - 1) >> PageShift); page++)
+   {
+      if(mPages[page] == NULL)
+         mPages[page] = new PlatformFont::CharInfo[PageSize];
+   }
+
+   mSize = size;
+}
+
+//-------------------------------------------------------------------------
+
 GFont::GFont()
 {
-   VECTOR_SET_ASSOCIATION(mCharInfoList);
    VECTOR_SET_ASSOCIATION(mTextureSheets);
 
    for (U32 i = 0; i < (sizeof(mRemapTable) / sizeof(S32)); i++)
@@ -457,6 +498,7 @@ GFont::GFont()
    mSize = 0;
    mCharSet = 0;
    mNeedSave = false;
+   mTextRunCount = 0;
    
    mMutex = Mutex::createMutex();
 }
@@ -490,6 +532,8 @@ GFont::~GFont()
    }
    
    SAFE_DELETE(mPlatformFont);
+
+   clearTextRuns();
    
    Mutex::destroyMutex(mMutex);
 }
@@ -524,13 +568,19 @@ void GFont::dumpInfo()
 
 bool GFont::loadCharInfo(const UTF16 ch)
 {
+    // The remap table is only read and written under the mutex; "getCharInfo" relies
+    // on the entry being complete before its index is published.
+    Mutex::lockMutex(mMutex);
+
     if(mRemapTable[ch] != -1)
+    {
+        Mutex::unlockMutex(mMutex);
         return true;    // Not really an error
+    }
 
     if(mPlatformFont && mPlatformFont->isValidChar(ch))
     {
-        Mutex::lockMutex(mMutex); // the CharInfo returned by mPlatformFont is static data, must protect from changes.
-        PlatformFont::CharInfo &ci = mPlatformFont->getCharInfo(ch);
+        PlatformFont::CharInfo &ci = mPlatformFont->getCharInfo(ch); // the CharInfo returned by mPlatformFont is static data, must protect from changes.
         if(ci.bitmapData)
             addBitmap(ci);
 
@@ -545,6 +595,7 @@ bool GFont::loadCharInfo(const UTF16 ch)
         return true;
     }
 
+    Mutex::unlockMutex(mMutex);
     return false;
 }
 
@@ -653,26 +704,27 @@ void GFont::addSheet()
 
 //////////////////////////////////////////////////////////////////////////
 
-const PlatformFont::CharInfo &GFont::getCharInfo(const UTF16 in_charIndex)
+const PlatformFont::CharInfo &GFont::loadAndGetCharInfo(const UTF16 in_charIndex)
 {
    PROFILE_START(NewFontGetCharInfo);
 
    AssertFatal(in_charIndex, "GFont::getCharInfo - can't get info for char 0!");
 
-   if(mRemapTable[in_charIndex] == -1)
-   {
-      loadCharInfo(in_charIndex);
-   }
+   loadCharInfo(in_charIndex);
 
-   AssertFatal(mRemapTable[in_charIndex] != -1, "No remap info for this character");
+   Mutex::lockMutex(mMutex);
+   const S32 remapIndex = mRemapTable[in_charIndex];
+   Mutex::unlockMutex(mMutex);
+
+   AssertFatal(remapIndex != -1, "No remap info for this character");
 
    PROFILE_END();
 
    // if we still have no character info, return the default char info.
-   if(mRemapTable[in_charIndex] == -1)
+   if(remapIndex == -1)
       return getDefaultCharInfo();
    else
-      return mCharInfoList[mRemapTable[in_charIndex]];
+      return mCharInfoList[remapIndex];
 }
 
 const PlatformFont::CharInfo &GFont::getDefaultCharInfo()
@@ -684,6 +736,153 @@ const PlatformFont::CharInfo &GFont::getDefaultCharInfo()
 
 //////////////////////////////////////////////////////////////////////////
 
+const GFont::TextRun* GFont::getTextRun(const UTF16* string, U32 n)
+{
+   // Find the actual length, rejecting anything with color codes as those depend on draw-time state.
+   U32 length = 0;
+   for( ; length < n && string[length]; length++ )
+   {
+      const UTF16 c = string[length];
+
+      if ( (c >= 1 && c <= 7) || (c >= 11 && c <= 12) || (c >= 14 && c <= 17) )
+         return NULL;
+   }
+
+   if ( length == 0 || length > MaxTextRunLength )
+      return NULL;
+
+   const U32 stringHash = hash( (U8*)string, length * sizeof(UTF16), 0 );
+
+   // Find an existing run.
+   typeTextRunHash::iterator itr = mTextRuns.find( stringHash );
+   if ( itr != mTextRuns.end() )
+   {
+      for( TextRun* pRun = itr->value; pRun != NULL; pRun = pRun->mpNext )
+      {
+         if ( pRun->mLength == length && dMemcmp( pRun->mpString, string, length * sizeof(UTF16) ) == 0 )
+            return pRun;
+      }
+   }
+
+   // Flush the cache if it's full.
+   if ( mTextRunCount >= MaxTextRunCount )
+   {
+      clearTextRuns();
+      itr = mTextRuns.end();
+   }
+
+   // Build a new run.
+   TextRun* pRun = buildTextRun( string, length, stringHash );
+
+   // Chain it into the hash.
+   if ( itr != mTextRuns.end() )
+   {
+      pRun->mpNext = itr->value;
+      itr->value = pRun;
+   }
+   else
+   {
+      mTextRuns.insert( stringHash, pRun );
+   }
+
+   mTextRunCount++;
+
+   return pRun;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+GFont::TextRun* GFont::buildTextRun(const UTF16* string, const U32 length, const U32 hash)
+{
+   PROFILE_SCOPE(GFont_BuildTextRun);
+
+   TextRun* pRun = new TextRun();
+   pRun->mHash = hash;
+   pRun->mLength = length;
+   pRun->mpString = new UTF16[length];
+   dMemcpy( pRun->mpString, string, length * sizeof(UTF16) );
+   pRun->mpNext = NULL;
+
+   // NOTE: This must match the shaping performed by "dglDrawTextN".
+   S32 x = 0;
+   for( U32 index = 0; index < length; index++ )
+   {
+      const UTF16 c = string[index];
+
+      // Tab character.
+      if ( c == dT('\t') )
+      {
+         const PlatformFont::CharInfo &ci = getCharInfo( dT(' ') );
+         x += ci.xIncrement * TabWidthInSpaces;
+         continue;
+      }
+
+      if ( !isValidChar( c ) )
+         continue;
+
+      const PlatformFont::CharInfo &ci = getCharInfo( c );
+
+      if ( ci.bitmapIndex == -1 )
+      {
+         x += ci.xOrigin + ci.xIncrement;
+         continue;
+      }
+
+      if ( ci.width == 0 || ci.height == 0 )
+      {
+         x += ci.xIncrement;
+         continue;
+      }
+
+      TextureObject* pTexture = getTextureObject( ci.bitmapIndex );
+      const F32 textureWidth = F32(pTexture->getTextureWidth());
+      const F32 textureHeight = F32(pTexture->getTextureHeight());
+
+      const S32 y = getBaseline() - ci.yOrigin;
+      x += ci.xOrigin;
+
+      pRun->mGlyphs.increment();
+      TextRun::Glyph& glyph = pRun->mGlyphs.last();
+      glyph.mSheet = ci.bitmapIndex;
+      glyph.mScreenLeft = F32(x);
+      glyph.mScreenTop = F32(y);
+      glyph.mScreenRight = F32(x + ci.width);
+      glyph.mScreenBottom = F32(y + ci.height);
+      glyph.mTexLeft = F32(ci.xOffset) / textureWidth;
+      glyph.mTexTop = F32(ci.yOffset) / textureHeight;
+      glyph.mTexRight = F32(ci.xOffset + ci.width) / textureWidth;
+      glyph.mTexBottom = F32(ci.yOffset + ci.height) / textureHeight;
+
+      x += ci.xIncrement - ci.xOrigin;
+   }
+
+   pRun->mAdvance = x;
+
+   return pRun;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void GFont::clearTextRuns()
+{
+   for( typeTextRunHash::iterator itr = mTextRuns.begin(); itr != mTextRuns.end(); ++itr )
+   {
+      TextRun* pRun = itr->value;
+      while( pRun != NULL )
+      {
+         TextRun* pNext = pRun->mpNext;
+         delete [] pRun->mpString;
+         delete pRun;
+         pRun = pNext;
+      }
+   }
+
+   mTextRuns.clear();
+   mTextRunCount = 0;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
 U32 GFont::getStrWidth(const UTF8* in_pString)
 {
    AssertFatal(in_pString != NULL, "GFont::getStrWidth: String is NULL, width is undefined");
@@ -928,6 +1127,8 @@ bool GFont::read(Stream& io_rStream)
 
     U32 size = 0;
     io_rStream.read(&size);
+    if(size > CharInfoList::MaxSize)
+        return false;
     mCharInfoList.setSize(size);
     U32 i;
     for(i = 0; i < size; i++)
@@ -1180,6 +1381,9 @@ void GFont::importStrip(const char *fileName, U32 padding, U32 kerning)
    // Also deal with kerning.
    // Also, we may have to load RGBA instead of RGB.
 
+   // Glyph placement is about to change so any shaped text is stale.
+   clearTextRuns();
+
    // Wipe our texture sheets.
    mCurSheet = mCurX = mCurY = 0;
    mTextureSheets.clear();
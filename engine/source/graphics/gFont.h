@@ -42,6 +42,12 @@
 #ifndef _RESMANAGER_H_
 #include "io/resource/resourceManager.h"
 #endif
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
 
 #include "graphics/TextureManager.h"
 
@@ -69,6 +75,70 @@ public:
    {
       TabWidthInSpaces = 3,
       TextureSheetSize = 256,
+      MaxTextRunLength = 256,    ///< Longest string that is cached as a text run.
+      MaxTextRunCount = 1024,    ///< Number of cached text runs before the cache is flushed.
+   };
+
+   /// A string shaped into glyph quads positioned relative to the draw point.
+   struct TextRun
+   {
+      struct Glyph
+      {
+         S32 mSheet;
+         F32 mScreenLeft;
+         F32 mScreenTop;
+         F32 mScreenRight;
+         F32 mScreenBottom;
+         F32 mTexLeft;
+         F32 mTexTop;
+         F32 mTexRight;
+         F32 mTexBottom;
+      };
+
+      U32            mHash;
+      U32            mLength;
+      UTF16*         mpString;
+      U32            mAdvance;
+      Vector<Glyph>  mGlyphs;
+      TextRun*       mpNext;
+   };
+
+   /// Character info storage made of fixed size pages that are never moved
+   /// once allocated, so a resident character stays put whilst others load.
+   class CharInfoList
+   {
+   public:
+      enum Constants
+      {
+         PageShift = 8,
+         PageSize = 1 << PageShift,
+         PageCount = 65536 >> PageShift,
+         MaxSize = PageSize * PageCount,
+      };
+
+      CharInfoList();
+      ~CharInfoList();
+
+      S32 size() const { return mSize; }
+
+      PlatformFont::CharInfo& operator[](const S32 index)
+      {
+         AssertFatal(index >= 0 && index < mSize, "GFont::CharInfoList - Index out of range.");
+         return mPages[index >> PageShift][index & (PageSize - 1)];
+      }
+
+      const PlatformFont::CharInfo& operator[](const S32 index) const
+      {
+         AssertFatal(index >= 0 && index < mSize, "GFont::CharInfoList - Index out of range.");
+         return mPages[index >> PageShift][index & (PageSize - 1)];
+      }
+
+      void push_back(const PlatformFont::CharInfo& charInfo);
+      void setSize(const S32 size);
+
+   private:
+      PlatformFont::CharInfo* mPages[PageCount];
+      S32 mSize;
    };
 
 
@@ -92,16 +162,22 @@ private:
    U32 mAscent;
    U32 mDescent;
 
-   Vector<PlatformFont::CharInfo>  mCharInfoList;       // - List of character info structures, must
+   CharInfoList    mCharInfoList;         // - List of character info structures, must
                                           //    be accessed through the getCharInfo(U32)
                                           //    function to account for remapping...
    S32             mRemapTable[65536];    // - Index remapping
+
+   typedef HashMap<U32, TextRun*> typeTextRunHash;
+   typeTextRunHash mTextRuns;             // - Shaped text runs keyed by string hash.
+   U32             mTextRunCount;
 public:
    GFont();
    virtual ~GFont();
 
 protected:
     bool loadCharInfo(const UTF16 ch);
+    const PlatformFont::CharInfo& loadAndGetCharInfo(const UTF16 in_charIndex);
+    TextRun* buildTextRun(const UTF16* string, const U32 length, const U32 hash);
     void addBitmap(PlatformFont::CharInfo &charInfo);
     void addSheet(void);
     void assignSheet(S32 sheetNum, GBitmap *bmp);
@@ -116,9 +192,21 @@ public:
        return mTextureSheets[index];
    }
 
+   TextureObject* getTextureObject(S32 index)
+   {
+       return mTextureSheets[index];
+   }
+
    const PlatformFont::CharInfo& getCharInfo(const UTF16 in_charIndex);
    static const PlatformFont::CharInfo& getDefaultCharInfo();
 
+   /// Get the shaped text run for the first "n" characters of a string.
+   /// Returns NULL if the string cannot be cached i.e. it contains color codes or is too long.
+   const TextRun* getTextRun(const UTF16* string, U32 n);
+
+   /// Flush all cached text runs.
+   void clearTextRuns();
+
    U32  getCharHeight(const UTF16 in_charIndex);
    U32  getCharWidth(const UTF16 in_charIndex);
    U32  getCharXIncrement(const UTF16 in_charIndex);
@@ -187,6 +275,20 @@ public:
    }
 };
 
+inline const PlatformFont::CharInfo& GFont::getCharInfo(const UTF16 in_charIndex)
+{
+    // The remap table is published under the mutex by "loadCharInfo" but the info
+    // never moves once resident so it can be used after unlocking.
+    Mutex::lockMutex(mMutex);
+    const S32 remapIndex = mRemapTable[in_charIndex];
+    Mutex::unlockMutex(mMutex);
+
+    if ( remapIndex != -1 )
+        return mCharInfoList[remapIndex];
+
+    return loadAndGetCharInfo(in_charIndex);
+}
+
 inline U32 GFont::getCharXIncrement(const UTF16 in_charIndex)
 {
     const PlatformFont::CharInfo& rChar = getCharInfo(in_charIndex);
@@ -207,7 +309,11 @@ inline U32 GFont::getCharHeight(const UTF16 in_charIndex)
 
 inline bool GFont::isValidChar(const UTF16 in_charIndex) const
 {
-   if(mRemapTable[in_charIndex] != -1)
+   Mutex::lockMutex(mMutex);
+   const bool resident = mRemapTable[in_charIndex] != -1;
+   Mutex::unlockMutex(mMutex);
+
+   if(resident)
       return true;
 
    if(mPlatformFont)
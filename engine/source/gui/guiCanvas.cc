@@ -460,10 +460,15 @@ GuiCanvas::GuiCanvas()
     /// Background color.
     mBackgroundColor.set( 0.0f, 0.0f, 0.0f, 0.0f );
     mUseBackgroundColor = true;
+
+   mRenderCacheInputPending = false;
+   mRenderCacheCallbackKey = TextureManager::registerEventCallback( GuiControl::onRenderCacheTextureEvent, NULL );
 }
 
 GuiCanvas::~GuiCanvas()
 {
+   TextureManager::unregisterEventCallback( mRenderCacheCallbackKey );
+
    if(Canvas == this)
       Canvas = 0;
 }
@@ -571,6 +576,8 @@ bool GuiCanvas::tabPrev(void)
 
 void GuiCanvas::processScreenTouchEvent(const ScreenTouchEvent *event)
 {
+    invalidateInputRenderCaches();
+
     //copy the cursor point into the event
     mLastEvent.mousePoint.x = S32(event->xPos);
     mLastEvent.mousePoint.y = S32(event->yPos);
@@ -602,6 +609,8 @@ void GuiCanvas::processScreenTouchEvent(const ScreenTouchEvent *event)
 
 void GuiCanvas::processMouseMoveEvent(const MouseMoveEvent *event)
 {
+   invalidateInputRenderCaches();
+
    if( cursorON )
    {
         //copy the modifier into the new event
@@ -642,6 +651,8 @@ void GuiCanvas::processMouseMoveEvent(const MouseMoveEvent *event)
 
 bool GuiCanvas::processInputEvent(const InputEvent *event)
 {
+    invalidateInputRenderCaches();
+
     // First call the general input handler (on the extremely off-chance that it will be handled):
     if ( mFirstResponder )
    {
@@ -1551,6 +1562,13 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
 
    //preRender (recursive) all controls
    preRender();
+
+   // Controls may have changed their appearance in response to input.
+   if ( mRenderCacheInputPending )
+   {
+      invalidateInputRenderCaches();
+      mRenderCacheInputPending = false;
+   }
    PROFILE_END();
    if(preRenderOnly)
       return;
@@ -1620,7 +1638,7 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
          GuiControl *contentCtrl = static_cast<GuiControl*>(*i);
          dglSetClipRect(updateUnion);
          glDisable( GL_CULL_FACE );
-         contentCtrl->onRender(contentCtrl->getPosition(), updateUnion);
+         contentCtrl->renderControl(contentCtrl->getPosition(), updateUnion);
       }
 
       // Tooltip resource
@@ -1769,6 +1787,26 @@ void GuiCanvas::addUpdateRegion(Point2I pos, Point2I ext)
    }
 }
 
+void GuiCanvas::invalidateInputRenderCaches()
+{
+   // Finish if nothing is being cached.
+   if ( GuiControl::smRenderCacheCount == 0 )
+      return;
+
+   // Controls routinely change their appearance in response to input (hover, pressed, selection)
+   // without flagging an update so we treat any control receiving input as dirty.
+   if ( bool(mMouseCapturedControl) )
+      mMouseCapturedControl->invalidateRenderCache();
+
+   if ( bool(mMouseControl) )
+      mMouseControl->invalidateRenderCache();
+
+   if ( bool(mFirstResponder) )
+      mFirstResponder->invalidateRenderCache();
+
+   mRenderCacheInputPending = true;
+}
+
 void GuiCanvas::resetUpdateRegions()
 {
    //DEBUG - get surface width and height
@@ -91,6 +91,11 @@ protected:
    RectI      mOldUpdateRects[2];
    RectI      mCurUpdateRect;
    F32        rLastFrameTime;
+   U32        mRenderCacheCallbackKey;   ///< Texture manager callback used to invalidate control render caches.
+   bool       mRenderCacheInputPending;  ///< Input has been processed since the last frame was rendered.
+
+   /// Invalidates the render cache of the controls currently receiving input.
+   void invalidateInputRenderCaches();
    /// @}
 
    /// @name Cursor Properties
@@ -52,6 +52,9 @@ GuiEditCtrl *GuiControl::smEditorHandle = NULL;
 
 bool GuiControl::smDesignTime = false;
 
+U32 GuiControl::smRenderCacheCount = 0;
+U32 GuiControl::smRenderCacheGeneration = 0;
+
 GuiControl::GuiControl()
 {
    mLayer = 0;
@@ -80,10 +83,15 @@ GuiControl::GuiControl()
    mTipHoverTime        = 1000;
    mTooltipWidth		= 250;
    mIsContainer         = false;
+   mUseRenderCache      = false;
+   mRenderCacheDirty    = true;
+   mRenderCacheGeneration = 0;
 }
 
 GuiControl::~GuiControl()
 {
+   if ( mUseRenderCache )
+      smRenderCacheCount--;
 }
 
 bool GuiControl::onAdd()
@@ -166,6 +174,7 @@ void GuiControl::initPersistFields()
    addField("AltCommand",        TypeString,		Offset(mAltConsoleCommand, GuiControl));
    addField("Accelerator",       TypeString,		Offset(mAcceleratorKey, GuiControl));
    addField("Active",			 TypeBool,			Offset(mActive, GuiControl));
+   addProtectedField("RenderCache", TypeBool,	Offset(mUseRenderCache, GuiControl), &setRenderCache, &defaultProtectedGetFn, "");
    endGroup("GuiControl");	
 
    addGroup("ToolTip");
@@ -236,6 +245,8 @@ void GuiControl::addObject(SimObject *object)
   if( parent )
      parent->onChildAdded( ctrl );
 
+   invalidateRenderCache();
+
 
 }
 
@@ -245,6 +256,8 @@ void GuiControl::removeObject(SimObject *object)
    if (mAwake)
       static_cast<GuiControl*>(object)->sleep();
     Parent::removeObject(object);
+
+   invalidateRenderCache();
 }
 
 GuiControl *GuiControl::getParent()
@@ -350,6 +363,9 @@ void GuiControl::resize(const Point2I &newPosition, const Point2I &newExtent)
       setUpdate();
    }
    else {
+      if ( newPosition != mBounds.point && smRenderCacheCount > 0 )
+         invalidateRenderCache();
+
       mBounds.point = newPosition;
    }
 }
@@ -636,7 +652,7 @@ void GuiControl::renderChildControls(Point2I offset, const RectI &updateRect)
          {
             dglSetClipRect(childClip);
             glDisable(GL_CULL_FACE);
-            ctrl->onRender(childPosition, childClip);
+            ctrl->renderControl(childPosition, childClip);
          }
       }
       size_cpy = objectList.size(); //	CHRIS: i know its wierd but the size of the list changes sometimes during execution of this loop
@@ -656,6 +672,8 @@ void GuiControl::setUpdateRegion(Point2I pos, Point2I ext)
    {
       root->addUpdateRegion(upos, ext);
    }
+
+   invalidateRenderCache();
 }
 
 void GuiControl::setUpdate()
@@ -663,6 +681,129 @@ void GuiControl::setUpdate()
    setUpdateRegion(Point2I(0,0), mBounds.extent);
 }
 
+void GuiControl::renderControl(Point2I offset, const RectI &updateRect)
+{
+   // Render directly if we're not caching.
+   if ( !mUseRenderCache || smDesignTime )
+   {
+      onRender( offset, updateRect );
+      return;
+   }
+
+   RectI ctrlRect( offset, mBounds.extent );
+
+   // Is the cached image still valid?
+   if ( !mRenderCacheDirty && mRenderCacheGeneration == smRenderCacheGeneration && mRenderCacheTexture.NotNull() )
+   {
+      PROFILE_SCOPE(GuiControl_RenderCacheComposite);
+
+      dglClearBitmapModulation();
+      dglDrawBitmapSR( mRenderCacheTexture, offset, RectI( Point2I(0,0), mBounds.extent ), GFlip_Y );
+      return;
+   }
+
+   // Render the subtree as normal.
+   // NOTE: The dirty flag is cleared first so that any invalidation during rendering is retained.
+   mRenderCacheDirty = false;
+   onRender( offset, updateRect );
+
+   // We can only capture the control if all of it was rendered.
+   const RectI windowRect( Point2I(0,0), Platform::getWindowSize() );
+   if ( updateRect != ctrlRect || !windowRect.contains( ctrlRect ) || !captureRenderCache( ctrlRect ) )
+   {
+      mRenderCacheDirty = true;
+      return;
+   }
+
+   mRenderCacheGeneration = smRenderCacheGeneration;
+}
+
+bool GuiControl::captureRenderCache( const RectI &ctrlRect )
+{
+   PROFILE_SCOPE(GuiControl_RenderCacheCapture);
+
+   const U32 width = ctrlRect.extent.x;
+   const U32 height = ctrlRect.extent.y;
+
+   if ( width == 0 || height == 0 || width > MaximumProductSupportedTextureWidth || height > MaximumProductSupportedTextureHeight )
+      return false;
+
+   // (Re)create the cache texture if the extent has changed.
+   if ( mRenderCacheTexture.IsNull() || mRenderCacheTexture.getWidth() != width || mRenderCacheTexture.getHeight() != height )
+   {
+      // NOTE: The bitmap is owned by the texture manager once set.
+      // We use an RGB texture so that the framebuffer alpha is not captured.
+      GBitmap* pBitmap = new GBitmap( width, height, false, GBitmap::RGB );
+      mRenderCacheTexture.set( TextureManager::getUniqueTextureKey(), pBitmap, TextureHandle::BitmapKeepTexture, true );
+
+      if ( mRenderCacheTexture.IsNull() )
+         return false;
+   }
+
+   // Copy the rendered area from the framebuffer.
+   // NOTE: Window coordinates have their origin at the bottom-left so the image is captured upside-down.
+   const S32 windowHeight = Platform::getWindowSize().y;
+
+   glEnable( GL_TEXTURE_2D );
+   glBindTexture( GL_TEXTURE_2D, mRenderCacheTexture.getGLName() );
+   glCopyTexSubImage2D( GL_TEXTURE_2D, 0, 0, 0, ctrlRect.point.x, windowHeight - (ctrlRect.point.y + ctrlRect.extent.y), width, height );
+   glDisable( GL_TEXTURE_2D );
+
+   return true;
+}
+
+void GuiControl::setRenderCache( const bool useRenderCache )
+{
+   // Finish if no change.
+   if ( useRenderCache == mUseRenderCache )
+      return;
+
+   mUseRenderCache = useRenderCache;
+
+   if ( mUseRenderCache )
+   {
+      smRenderCacheCount++;
+   }
+   else
+   {
+      smRenderCacheCount--;
+      mRenderCacheTexture.clear();
+   }
+
+   mRenderCacheDirty = true;
+}
+
+void GuiControl::invalidateRenderCache( void )
+{
+   // Finish if nothing is being cached.
+   if ( smRenderCacheCount == 0 )
+      return;
+
+   // Our image is contained in every cached ancestor.
+   for ( GuiControl* pWalk = this; pWalk != NULL; pWalk = pWalk->getParent() )
+      pWalk->mRenderCacheDirty = true;
+
+   // Our image is the backdrop of every cached descendant.
+   invalidateChildRenderCaches();
+}
+
+void GuiControl::invalidateChildRenderCaches( void )
+{
+   for( iterator itr = begin(); itr != end(); ++itr )
+   {
+      GuiControl* pChild = static_cast<GuiControl*>(*itr);
+      pChild->mRenderCacheDirty = true;
+      pChild->invalidateChildRenderCaches();
+   }
+}
+
+void GuiControl::onRenderCacheTextureEvent( const TextureManager::TextureEventCode eventCode, void *userData )
+{
+   // Resurrected textures lose their captured contents.
+   if ( eventCode == TextureManager::EndResurrection )
+      smRenderCacheGeneration++;
+}
+
 // -=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=-=- //
 
 void GuiControl::awaken()
@@ -825,6 +966,10 @@ void GuiControl::onSleep()
    if( isMethod("onSleep") )
       Con::executef(this, 1, "onSleep");
 
+   // Release any cached image.
+   mRenderCacheTexture.clear();
+   mRenderCacheDirty = true;
+
    // Set Flag
    mAwake = false;
 }
@@ -840,6 +985,7 @@ void GuiControl::setControlProfile(GuiControlProfile *prof)
    if(mAwake)
       mProfile->incRefCount();
 
+   invalidateRenderCache();
 }
 
 void GuiControl::onPreRender()
@@ -990,6 +1136,12 @@ ConsoleMethod( GuiControl, setVisible, void, 3, 3, "( isVisible ) Use the setVis
    object->setVisible(dAtob(argv[2]));
 }
 
+ConsoleMethod( GuiControl, invalidateRenderCache, void, 2, 2, "() Use the invalidateRenderCache method to force this control to re-render if it is using the render cache.\n"
+                                                                "@return No return value")
+{
+   object->invalidateRenderCache();
+}
+
 ConsoleMethod( GuiControl, makeFirstResponder, void, 3, 3, "( isFirst ) Use the makeFirstResponder method to force this control to become the first responder.\n"
                                                                 "@param isFirst A boolean value. If true, then this control become first reponder and at captures inputs before all other controls, excluding dialogs above this control.\n"
                                                                 "@return No return value")
@@ -169,6 +169,19 @@ protected:
 
     /// @}
 
+    /// @name Render Cache
+    /// @{
+
+    bool                mUseRenderCache;        ///< If true, the rendered subtree is captured to a texture and recomposited until invalidated.
+    bool                mRenderCacheDirty;      ///< Set when the cached image no longer matches what the subtree would render.
+    U32                 mRenderCacheGeneration; ///< Texture generation the cached image was captured in.
+    TextureHandle       mRenderCacheTexture;    ///< Captured image of the subtree.
+
+    static U32          smRenderCacheCount;      ///< Number of controls with the render cache enabled.
+    static U32          smRenderCacheGeneration; ///< Bumped whenever textures are resurrected, invalidating every cached image.
+
+    /// @}
+
     /// @name Console
     /// The console variable collection of functions allows a console variable to be bound to the GUI control.
     ///
@@ -396,6 +409,37 @@ public:
 
     /// Sets the update area of the control to encompass the whole control
     virtual void setUpdate();
+
+    /// Renders this control, compositing the render cache if it is enabled and valid.
+    /// @param   offset   The location this control is to begin rendering
+    /// @param   updateRect   The screen area this control has drawing access to
+    void renderControl(Point2I offset, const RectI &updateRect);
+    /// @}
+
+    /// @name Render Cache
+    /// A control with the render cache enabled renders its whole subtree once, captures the
+    /// result into a texture and then draws that texture until the cache is invalidated.
+    /// The capture includes whatever was drawn beneath the control so the cache is best
+    /// suited to opaque, mostly static controls such as text panels, lists and tree views.
+    /// @{
+
+    /// Enables or disables the render cache for this control.
+    void setRenderCache( const bool useRenderCache );
+    inline bool getRenderCache( void ) const { return mUseRenderCache; }
+
+    /// Invalidates the cache of this control, every cached ancestor (which contains this control)
+    /// and every cached descendant (which contains this control as its backdrop).
+    void invalidateRenderCache( void );
+
+    /// Called when the texture manager resurrects textures and all cached images are lost.
+    static void onRenderCacheTextureEvent( const TextureManager::TextureEventCode eventCode, void *userData );
+
+protected:
+    void invalidateChildRenderCaches( void );
+    bool captureRenderCache( const RectI &ctrlRect );
+    static bool setRenderCache( void *obj, const char *data ) { static_cast<GuiControl*>(obj)->setRenderCache( dAtob(data) ); return false; }
+
+public:
     /// @}
 
     //child hierarchy calls
@@ -100,6 +100,8 @@ void GuiListBoxCtrl::clearSelection()
       (*i)->isSelected = false;
 
    mSelectedItems.clear();
+
+   setUpdate();
 }
 
 
@@ -143,6 +145,7 @@ void GuiListBoxCtrl::removeSelection( LBItem *item, S32 index )
       {
          mSelectedItems.erase( &mSelectedItems[i] );
          item->isSelected = false;
+         setUpdate();
          Con::executef(this, 3, "onUnSelect", Con::getIntArg( index ), item->itemText);
          return;
       }
@@ -189,6 +192,8 @@ void GuiListBoxCtrl::addSelection( LBItem *item, S32 index )
    item->isSelected = true;
    mSelectedItems.push_front( item );
 
+   setUpdate();
+
    Con::executef(this, 3, "onSelect", Con::getIntArg( index ), item->itemText);
 
 }
@@ -456,6 +461,8 @@ void GuiListBoxCtrl::setItemColor( S32 index, ColorF color )
    LBItem* item = mItems[index];
    item->hasColor = true;
    item->color = color;
+
+   setUpdate();
 }
 
 ConsoleMethod(GuiListBoxCtrl, clearItemColor, void, 3, 3, "(index) Clears the color of the item at index.\n"
@@ -475,6 +482,8 @@ void GuiListBoxCtrl::clearItemColor( S32 index )
 
    LBItem* item = mItems[index];
    item->hasColor = false;
+
+   setUpdate();
 }
 
 ConsoleMethod( GuiListBoxCtrl, insertItem, void, 4, 4, "( text, index ) Inserts an item into the list at the specified index.\n"
@@ -654,6 +663,8 @@ void GuiListBoxCtrl::setItemText( S32 index, StringTableEntry text )
    }
 
    mItems[ index ]->itemText = StringTable->insert( text );
+
+   setUpdate();
 }
 //////////////////////////////////////////////////////////////////////////
 // Sizing Functions
@@ -708,6 +719,9 @@ void GuiListBoxCtrl::onRender( Point2I offset, const RectI &updateRect )
    // Save our original clip rect
    RectI oldClipRect = clipRect;
 
+   // Draw the item text in as few batches as possible.
+   dglBeginTextBatch();
+
    for ( S32 i = 0; i < mItems.size(); i++)
    {
       S32 colorBoxSize = 0;
@@ -737,6 +751,8 @@ void GuiListBoxCtrl::onRender( Point2I offset, const RectI &updateRect )
       onRenderItem( itemRect, mItems[i] );
    }
 
+   dglEndTextBatch();
+
    dglSetClipRect( oldClipRect );
 }
 
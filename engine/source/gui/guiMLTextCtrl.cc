@@ -288,6 +288,7 @@ void GuiMLTextCtrl::onRender(Point2I offset, const RectI& updateRect)
    }
 
    // draw all the text and dividerStyles
+   dglBeginTextBatch();
    for(Line *lwalk = mLineList; lwalk; lwalk = lwalk->next)
    {
       RectI lineRect(offset.x, offset.y + lwalk->y, mBounds.extent.x, lwalk->height);
@@ -319,6 +320,7 @@ void GuiMLTextCtrl::onRender(Point2I offset, const RectI& updateRect)
          }
       }
    }
+   dglEndTextBatch();
    dglClearBitmapModulation();
 }
 
@@ -1421,6 +1423,7 @@ void GuiMLTextCtrl::reflow()
    AssertFatal(mAwake, "Can't reflow a sleeping control.");
    freeLineBuffers();
    mDirty = false;
+   setUpdate();
    mScanPos = 0;
 
    mLineList = NULL;
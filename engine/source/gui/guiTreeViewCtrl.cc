@@ -673,6 +673,9 @@ void GuiTreeViewCtrl::buildVisibleTree(bool bForceFullUpdate)
    setSize(Point2I(1, mVisibleItems.size()));
    syncSelection();
 
+   // Our rendering has changed.
+   setUpdate();
+
    // Done Recursing.
    mFlags.clear( BuildingVisTree );
 }
@@ -1547,6 +1550,9 @@ bool GuiTreeViewCtrl::setItemSelected(S32 itemId, bool select)
 {
    Item * item = getItem(itemId);
 
+   // Selection rendering is about to change.
+   setUpdate();
+
    if (select)
    {
       if (mDebug) Con::printf("setItemSelected called true");
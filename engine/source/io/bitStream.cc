@@ -29,6 +29,10 @@
 #include "platform/event.h"
 #include "console/consoleObject.h"
 
+// Number of bits read or written per step; keeps the source byte aligned and leaves
+// room to shift the chunk into any bit position within 64 bits.
+static const S32 BitStreamChunkBits = 56;
+
 static BitStream gPacketStream(NULL, 0);
 static U8 gPacketBuffer[MaxPacketDataSize];
 
@@ -212,20 +216,68 @@ void BitStream::writeBits(S32 bitCount, const void *bitPtr)
       return;
    }
 
-   // [tom, 8/17/2006] This is probably a lot lamer then it needs to be. However,
-   // at least it doesnt clobber data or overrun the buffer like the old code did.
    const U8 *ptr = (U8 *)bitPtr;
 
-   for(S32 srcBitNum = 0;srcBitNum < bitCount;srcBitNum++)
+   // Byte aligned so copy the whole bytes directly.
+   if((bitNum & 0x7) == 0)
    {
-      if((*(ptr + (srcBitNum >> 3)) & (1 << (srcBitNum & 0x7))) != 0)
-         *(dataPtr + (bitNum >> 3)) |= (1 << (bitNum & 0x7));
-      else
-         *(dataPtr + (bitNum >> 3)) &= ~(1 << (bitNum & 0x7));
-      bitNum++;
+      const S32 byteCount = bitCount >> 3;
+      dMemcpy(dataPtr + (bitNum >> 3), ptr, byteCount);
+      bitNum += byteCount << 3;
+      bitCount &= 0x7;
+      ptr += byteCount;
+   }
+
+   // Write the rest a word at a time.  Chunks are 56 bits so that the source stays
+   // byte aligned and the chunk shifted into position still fits in 64 bits.
+   while(bitCount > 0)
+   {
+      const S32 chunkBits = getMin(bitCount, BitStreamChunkBits);
+      const S32 chunkBytes = (chunkBits + 7) >> 3;
+
+      U64 value = 0;
+      for(S32 i = 0; i < chunkBytes; i++)
+         value |= U64(ptr[i]) << (i << 3);
+
+      writeChunk(value, chunkBits);
+
+      bitCount -= chunkBits;
+      ptr += chunkBytes;
    }
 }
 
+void BitStream::writeChunk(U64 value, S32 bitCount)
+{
+   // Only the bits being written are changed in the buffer.
+   const S32 shift = bitNum & 0x7;
+   const U64 mask = ((U64(1) << bitCount) - 1) << shift;
+   value = (value << shift) & mask;
+
+   U8 *dstPtr = dataPtr + (bitNum >> 3);
+   const S32 byteCount = (shift + bitCount + 7) >> 3;
+   for(S32 i = 0; i < byteCount; i++)
+   {
+      const S32 byteShift = i << 3;
+      dstPtr[i] = U8((dstPtr[i] & ~U8(mask >> byteShift)) | U8(value >> byteShift));
+   }
+
+   bitNum += bitCount;
+}
+
+U64 BitStream::readChunk(S32 bitCount)
+{
+   const S32 shift = bitNum & 0x7;
+   const U8 *srcPtr = dataPtr + (bitNum >> 3);
+   const S32 byteCount = (shift + bitCount + 7) >> 3;
+
+   U64 value = 0;
+   for(S32 i = 0; i < byteCount; i++)
+      value |= U64(srcPtr[i]) << (i << 3);
+
+   bitNum += bitCount;
+   return (value >> shift) & ((U64(1) << bitCount) - 1);
+}
+
 void BitStream::setBit(S32 bitCount, bool set)
 {
    if(set)
@@ -266,23 +318,31 @@ void BitStream::readBits(S32 bitCount, void *bitPtr)
       AssertWarn(false, "Out of range read");
       return;
    }
-   U8 *stPtr = dataPtr + (bitNum >> 3);
-   S32 byteCount = (bitCount + 7) >> 3;
-
    U8 *ptr = (U8 *) bitPtr;
 
-   S32 downShift = bitNum & 0x7;
-   S32 upShift = 8 - downShift;
-
-   U8 curB = *stPtr;
-   while(byteCount--)
+   // Byte aligned so copy the whole bytes directly.
+   if((bitNum & 0x7) == 0)
    {
-      U8 nextB = *++stPtr;
-      *ptr++ = (curB >> downShift) | (nextB << upShift);
-      curB = nextB;
+      const S32 byteCount = bitCount >> 3;
+      dMemcpy(ptr, dataPtr + (bitNum >> 3), byteCount);
+      bitNum += byteCount << 3;
+      bitCount &= 0x7;
+      ptr += byteCount;
    }
 
-   bitNum += bitCount;
+   // Read the rest a word at a time.
+   while(bitCount > 0)
+   {
+      const S32 chunkBits = getMin(bitCount, BitStreamChunkBits);
+      const S32 chunkBytes = (chunkBits + 7) >> 3;
+
+      const U64 value = readChunk(chunkBits);
+      for(S32 i = 0; i < chunkBytes; i++)
+         ptr[i] = U8(value >> (i << 3));
+
+      bitCount -= chunkBits;
+      ptr += chunkBytes;
+   }
 }
 
 bool BitStream::_read(U32 size, void *dataPtr)
@@ -299,20 +359,37 @@ bool BitStream::_write(U32 size, const void *dataPtr)
 
 S32 BitStream::readInt(S32 bitCount)
 {
-   S32 ret = 0;
-   readBits(bitCount, &ret);
-   ret = convertLEndianToHost(ret);
-   if(bitCount == 32)
-      return ret;
-   else
-      ret &= (1 << bitCount) - 1;
-   return ret;
+   AssertFatal(bitCount >= 0 && bitCount <= 32, "BitStream::readInt() - Invalid bit count.");
+
+   if(!bitCount)
+      return 0;
+   if(bitCount + bitNum > maxReadBitNum)
+   {
+      error = true;
+      AssertWarn(false, "Out of range read");
+      return 0;
+   }
+
+   // The value is assembled from the buffer bytes so no endian conversion is needed.
+   return S32(readChunk(bitCount));
 }
 
 void BitStream::writeInt(S32 val, S32 bitCount)
 {
-   val = convertHostToLEndian(val);
-   writeBits(bitCount, &val);
+   AssertFatal(bitCount >= 0 && bitCount <= 32, "BitStream::writeInt() - Invalid bit count.");
+
+   if(!bitCount)
+      return;
+
+   // Let derived streams grow the buffer or flag the error.
+   if(bitCount + bitNum > maxWriteBitNum)
+   {
+      val = convertHostToLEndian(val);
+      writeBits(bitCount, &val);
+      return;
+   }
+
+   writeChunk(U64(U32(val)), bitCount);
 }
 
 void BitStream::writeFloat(F32 f, S32 bitCount)
@@ -351,6 +428,44 @@ S32 BitStream::readSignedInt(S32 bitCount)
       return readInt(bitCount - 1);
 }
 
+void BitStream::writeGolombS32(S32 value, U32 order)
+{
+   AssertFatal(order < 32, "BitStream::writeGolombS32() - Invalid order.");
+
+   // Fold the sign into the low bit so that small magnitudes make small codes.
+   const U32 folded = (U32(value) << 1) ^ U32(value >> 31);
+   const U64 code = U64(folded) + (U64(1) << order);
+
+   S32 suffixBits = order;
+   while((code >> (suffixBits + 1)) != 0)
+      suffixBits++;
+
+   // The code length in unary, then the code without its leading one.
+   writeInt(0, suffixBits - order);
+   writeFlag(true);
+   writeInt(S32(U32(code)), suffixBits);
+}
+
+S32 BitStream::readGolombS32(U32 order)
+{
+   AssertFatal(order < 32, "BitStream::readGolombS32() - Invalid order.");
+
+   S32 prefixBits = 0;
+   while(!readFlag())
+   {
+      if(error || ++prefixBits + S32(order) > 32)
+      {
+         error = true;
+         return 0;
+      }
+   }
+
+   const S32 suffixBits = prefixBits + order;
+   const U64 code = (U64(1) << suffixBits) | U32(readInt(suffixBits));
+   const U32 folded = U32(code - (U64(1) << order));
+   return S32((folded >> 1) ^ (0 - (folded & 1)));
+}
+
 void BitStream::writeNormalVector(const Point3F& vec, S32 bitCount)
 {
    F32 phi   = mAtan(vec.x, vec.y) / (F32)M_PI;
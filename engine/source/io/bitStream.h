@@ -61,6 +61,13 @@ protected:
    Point3F mCompressPoint;
 
    friend class HuffmanProcessor;
+
+   /// Write the low bits of the value at the current position; at most 57 bits.
+   void writeChunk(U64 value, S32 bitCount);
+
+   /// Read bits from the current position; at most 57 bits.
+   U64 readChunk(S32 bitCount);
+
 public:
    static BitStream *getPacketStream(U32 writeSize = 0);
    static void sendPacketStream(const NetAddress *addr);
@@ -126,6 +133,15 @@ public:
    void writeSignedInt(S32 value, S32 bitCount);
    S32  readSignedInt(S32 bitCount);
 
+   /// Writes a signed value as an exponential Golomb code of the given order.
+   /// Values near zero take the fewest bits: with order k, values of magnitude
+   /// below 2^(k-1) take k+1 bits and each doubling adds two more.  Good for
+   /// deltas and other values that are usually small but may be any size.
+   void writeGolombS32(S32 value, U32 order);
+
+   /// Reads a signed value written with writeGolombS32 using the same order.
+   S32  readGolombS32(U32 order);
+
    void writeRangedU32(U32 value, U32 rangeStart, U32 rangeEnd);
    U32  readRangedU32(U32 rangeStart, U32 rangeEnd);
    
@@ -0,0 +1,172 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "memory/classPool.h"
+#include "console/console.h"
+#include "math/mMathFn.h"
+
+//-----------------------------------------------------------------------------
+
+ClassPool* ClassPool::smPoolList = NULL;
+
+// Approximate size of each slab.
+static const dsize_t ClassPoolSlabSize = 64 * 1024;
+
+// Minimum number of blocks in each slab.
+static const U32 ClassPoolMinBlocksPerSlab = 8;
+
+// Alignment of each block.
+static const dsize_t ClassPoolBlockAlignment = 16;
+
+//-----------------------------------------------------------------------------
+
+ClassPool::ClassPool( const char* pClassName, const dsize_t blockSize ) :
+    mClassName( pClassName ),
+    mSlabs( NULL ),
+    mFreeList( NULL ),
+    mLiveCount( 0 ),
+    mPeakCount( 0 ),
+    mAllocCount( 0 ),
+    mSlabCount( 0 )
+{
+    // Round the block size up to the alignment.
+    mBlockSize = (getMax( blockSize, (dsize_t)sizeof(FreeBlock) ) + ClassPoolBlockAlignment - 1) & ~(ClassPoolBlockAlignment - 1);
+    mBlocksPerSlab = getMax( (U32)(ClassPoolSlabSize / mBlockSize), ClassPoolMinBlocksPerSlab );
+
+    // Link into the pool list.
+    mNextPool = smPoolList;
+    smPoolList = this;
+}
+
+//-----------------------------------------------------------------------------
+
+ClassPool::~ClassPool()
+{
+    // Free the slabs.
+    while( mSlabs != NULL )
+    {
+        void* pSlab = mSlabs;
+        mSlabs = *(void**)pSlab;
+        dFree( pSlab );
+    }
+
+    // Unlink from the pool list.
+    for ( ClassPool** pWalk = &smPoolList; *pWalk != NULL; pWalk = &(*pWalk)->mNextPool )
+    {
+        if ( *pWalk == this )
+        {
+            *pWalk = mNextPool;
+            break;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void* ClassPool::alloc( void )
+{
+#ifdef TORQUE_MULTITHREAD
+    MutexHandle mutex;
+    mutex.lock( &mMutex, true );
+#endif
+
+    // Allocate a slab if there are no free blocks.
+    if ( mFreeList == NULL )
+        allocSlab();
+
+    // Take the most recently freed block as it is the most likely to be in the cache.
+    FreeBlock* pBlock = mFreeList;
+    mFreeList = pBlock->mNext;
+
+    mAllocCount++;
+    if ( ++mLiveCount > mPeakCount )
+        mPeakCount = mLiveCount;
+
+    return pBlock;
+}
+
+//-----------------------------------------------------------------------------
+
+void ClassPool::free( void* pBlock )
+{
+    if ( pBlock == NULL )
+        return;
+
+#ifdef TORQUE_DEBUG
+    // Scrub the block so stale references are easier to spot.
+    dMemset( pBlock, 0xCD, mBlockSize );
+#endif
+
+#ifdef TORQUE_MULTITHREAD
+    MutexHandle mutex;
+    mutex.lock( &mMutex, true );
+#endif
+
+    AssertFatal( mLiveCount > 0, "ClassPool::free() - More blocks freed than allocated." );
+
+    FreeBlock* pFreeBlock = (FreeBlock*)pBlock;
+    pFreeBlock->mNext = mFreeList;
+    mFreeList = pFreeBlock;
+
+    mLiveCount--;
+}
+
+//-----------------------------------------------------------------------------
+
+void ClassPool::allocSlab( void )
+{
+    // The slab starts with a link to the next slab, padded to the block alignment.
+    U8* pSlab = (U8*)dMalloc( ClassPoolBlockAlignment + mBlockSize * mBlocksPerSlab );
+    *(void**)pSlab = mSlabs;
+    mSlabs = pSlab;
+    mSlabCount++;
+
+    // Thread the blocks onto the free list in address order.
+    U8* pBlocks = pSlab + ClassPoolBlockAlignment;
+    for ( S32 index = (S32)mBlocksPerSlab - 1; index >= 0; --index )
+    {
+        FreeBlock* pBlock = (FreeBlock*)(pBlocks + index * mBlockSize);
+        pBlock->mNext = mFreeList;
+        mFreeList = pBlock;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunction(dumpClassPools, void, 1, 1, "() Dumps the statistics of the class pools to the console.\n"
+                                            "@return No return value.")
+{
+    Con::printf( "Class Pools:" );
+    Con::printf( "     Live      Peak      Allocs  Slabs   Block      Bytes  Class" );
+
+    for ( ClassPool* pPool = ClassPool::getPoolList(); pPool != NULL; pPool = pPool->getNextPool() )
+    {
+        Con::printf( "%9d %9d %11d %6d %7d %10d  %s",
+            pPool->getLiveCount(),
+            pPool->getPeakCount(),
+            pPool->getAllocCount(),
+            pPool->getSlabCount(),
+            (U32)pPool->getBlockSize(),
+            (U32)(pPool->getSlabCount() * pPool->getBlocksPerSlab() * pPool->getBlockSize()),
+            pPool->getClassName() );
+    }
+}
@@ -0,0 +1,110 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _CLASS_POOL_H_
+#define _CLASS_POOL_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifdef TORQUE_MULTITHREAD
+#ifndef _PLATFORM_THREADS_MUTEX_H_
+#include "platform/threads/mutex.h"
+#endif
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A pool of fixed-size blocks for the instances of a single class.
+///
+/// Blocks are carved from slabs and recycled through a free list so instances of
+/// high-churn classes are allocated from warm memory without going to the heap.
+/// Slabs are kept until the pool is destroyed.
+///
+/// A class opts in with DECLARE_CLASS_POOL in its declaration and IMPLEMENT_CLASS_POOL
+/// in its implementation.  Derived classes that are larger than the pooled class fall
+/// back to the heap unless they opt in themselves.
+class ClassPool
+{
+public:
+    ClassPool( const char* pClassName, const dsize_t blockSize );
+    ~ClassPool();
+
+    void* alloc( void );
+    void free( void* pBlock );
+
+    /// Statistics.
+    inline const char* getClassName( void ) const   { return mClassName; }
+    inline dsize_t getBlockSize( void ) const       { return mBlockSize; }
+    inline U32 getLiveCount( void ) const           { return mLiveCount; }
+    inline U32 getPeakCount( void ) const           { return mPeakCount; }
+    inline U32 getAllocCount( void ) const          { return mAllocCount; }
+    inline U32 getSlabCount( void ) const           { return mSlabCount; }
+    inline U32 getBlocksPerSlab( void ) const       { return mBlocksPerSlab; }
+
+    /// All the class pools.
+    static ClassPool* getPoolList( void )           { return smPoolList; }
+    inline ClassPool* getNextPool( void ) const     { return mNextPool; }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* mNext;
+    };
+
+    void allocSlab( void );
+
+    const char* mClassName;
+    dsize_t     mBlockSize;
+    U32         mBlocksPerSlab;
+    void*       mSlabs;
+    FreeBlock*  mFreeList;
+    U32         mLiveCount;
+    U32         mPeakCount;
+    U32         mAllocCount;
+    U32         mSlabCount;
+    ClassPool*  mNextPool;
+
+#ifdef TORQUE_MULTITHREAD
+    Mutex       mMutex;
+#endif
+
+    static ClassPool* smPoolList;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Declares a class pool for the class and routes its allocations through it.
+#define DECLARE_CLASS_POOL( className ) \
+   public: \
+      static ClassPool smClassPool; \
+      static void* operator new( size_t size ) { return size == sizeof(className) ? smClassPool.alloc() : ::operator new( size ); } \
+      static void operator delete( void* pObject, size_t size ) { if ( size == sizeof(className) ) smClassPool.free( pObject ); else ::operator delete( pObject ); } \
+      static void* operator new( size_t size, void* pPlacement ) { return pPlacement; } \
+      static void operator delete( void* pObject, void* pPlacement ) {}
+
+/// Implements the class pool for the class.
+#define IMPLEMENT_CLASS_POOL( className ) \
+   ClassPool className::smClassPool( #className, sizeof(className) )
+
+#endif // _CLASS_POOL_H_
@@ -0,0 +1,538 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+#include "memory/memoryTracker.h"
+
+#ifdef TORQUE_TRACK_MEMORY
+
+#include "platform/platform.h"
+#include "platform/threads/mutex.h"
+#include "console/console.h"
+#include "collection/vector.h"
+#include <stdlib.h>
+
+//-----------------------------------------------------------------------------
+
+#if defined(TORQUE_COMPILER_VISUALC)
+#define MEMORY_THREAD_LOCAL __declspec(thread)
+#else
+#define MEMORY_THREAD_LOCAL __thread
+#endif
+
+// Marks a live tracked block.
+static const U32 MemoryBlockMagic = 0x4D454D54;
+
+// Number of allocation sites tracked by each thread, a power of two.
+static const U32 MemorySiteTableBits = 11;
+static const U32 MemorySiteTableSize = 1 << MemorySiteTableBits;
+
+// Probes before a site is counted against the overflow site.
+static const U32 MemorySiteMaxProbes = 32;
+
+// Number of sites dumped by default.
+static const U32 MemoryDefaultDumpCount = 20;
+
+//-----------------------------------------------------------------------------
+
+namespace Memory
+{
+    /// Prefixes each tracked block.
+    struct BlockHeader
+    {
+        const char* mFileName;
+        U32         mLine;
+        U32         mTag;
+        dsize_t     mSize;
+        U32         mMagic;
+    };
+
+    /// Live totals of a tag or an allocation site.
+    struct Counters
+    {
+        S64 mLiveBytes;
+        S64 mLiveCount;
+        U64 mAllocCount;
+
+        inline void add( const dsize_t size )       { mLiveBytes += size; mLiveCount++; mAllocCount++; }
+        inline void remove( const dsize_t size )    { mLiveBytes -= size; mLiveCount--; }
+    };
+
+    struct Site
+    {
+        const char* mFileName;
+        U32         mLine;
+        Counters    mCounters;
+    };
+
+    /// The counters owned by one thread.  Blocks freed on another thread than the
+    /// one that allocated them make the counters of either thread drift, only the
+    /// sum over all threads is meaningful.
+    struct ThreadCounters
+    {
+        Counters        mTags[TagCount];
+        Site            mSites[MemorySiteTableSize];
+        Site            mOverflowSite;
+        ThreadCounters* mNext;
+    };
+
+    /// Totals of an allocation site over all threads.
+    struct SiteTotal
+    {
+        const char* mFileName;
+        U32         mLine;
+        Counters    mCounters;
+    };
+}
+
+using namespace Memory;
+
+// Size of the block header, keeping the allocation aligned.
+static const dsize_t MemoryHeaderSize = (sizeof(BlockHeader) + 15) & ~(dsize_t)15;
+
+static MEMORY_THREAD_LOCAL ThreadCounters* tThreadCounters = NULL;
+static MEMORY_THREAD_LOCAL U32 tThreadTag = TagGeneral;
+
+static ThreadCounters* sThreadCountersList = NULL;
+static Mutex* sThreadCountersMutex = NULL;
+
+static S64 sPeakTagBytes[TagCount];
+static S64 sPeakTotalBytes = 0;
+
+static Counters sSnapshotTags[TagCount];
+static Vector<SiteTotal> sSnapshotSites;
+static bool sSnapshotTaken = false;
+
+static const char* sTagNames[TagCount] =
+{
+    "General",
+    "Script",
+    "Scene",
+    "Textures",
+    "Audio",
+    "Taml",
+};
+
+//-----------------------------------------------------------------------------
+
+static ThreadCounters* getThreadCounters( void )
+{
+    ThreadCounters* pCounters = tThreadCounters;
+    if ( pCounters != NULL )
+        return pCounters;
+
+    // The counters are allocated from the system so they are not tracked themselves.
+    pCounters = (ThreadCounters*)malloc( sizeof(ThreadCounters) );
+    dMemset( pCounters, 0, sizeof(ThreadCounters) );
+    pCounters->mOverflowSite.mFileName = "<other sites>";
+    tThreadCounters = pCounters;
+
+    // The first allocation is made during static initialization before any other
+    // thread exists so the mutex can be created without a lock.
+    if ( sThreadCountersMutex == NULL )
+        sThreadCountersMutex = new Mutex;
+
+    MutexHandle mutex;
+    mutex.lock( sThreadCountersMutex, true );
+    pCounters->mNext = sThreadCountersList;
+    sThreadCountersList = pCounters;
+
+    return pCounters;
+}
+
+//-----------------------------------------------------------------------------
+
+static Site* findSite( ThreadCounters* pCounters, const char* pFileName, const U32 line )
+{
+    U32 index = ((U32)(size_t)pFileName * 0x9E3779B9 + line * 0x85EBCA6B) >> (32 - MemorySiteTableBits);
+
+    for ( U32 probe = 0; probe < MemorySiteMaxProbes; ++probe, index = (index + 1) & (MemorySiteTableSize - 1) )
+    {
+        Site& site = pCounters->mSites[index];
+
+        if ( site.mFileName == pFileName && site.mLine == line )
+            return &site;
+
+        if ( site.mFileName == NULL )
+        {
+            // Claim the slot, publishing the file name last as reports skip empty slots.
+            site.mLine = line;
+            site.mFileName = pFileName;
+            return &site;
+        }
+    }
+
+    return &pCounters->mOverflowSite;
+}
+
+//-----------------------------------------------------------------------------
+
+static void* trackBlock( void* pRaw, dsize_t size, const char* pFileName, const U32 line )
+{
+    if ( pRaw == NULL )
+        return NULL;
+
+    if ( pFileName == NULL )
+        pFileName = "<unknown>";
+
+    BlockHeader* pHeader = (BlockHeader*)pRaw;
+    pHeader->mFileName = pFileName;
+    pHeader->mLine = line;
+    pHeader->mTag = tThreadTag;
+    pHeader->mSize = size;
+    pHeader->mMagic = MemoryBlockMagic;
+
+    ThreadCounters* pCounters = getThreadCounters();
+    pCounters->mTags[pHeader->mTag].add( size );
+    findSite( pCounters, pFileName, line )->mCounters.add( size );
+
+    return (U8*)pRaw + MemoryHeaderSize;
+}
+
+//-----------------------------------------------------------------------------
+
+static BlockHeader* untrackBlock( void* pBlock )
+{
+    BlockHeader* pHeader = (BlockHeader*)((U8*)pBlock - MemoryHeaderSize);
+    AssertFatal( pHeader->mMagic == MemoryBlockMagic, "Memory - Freeing a block that is not tracked or was already freed." );
+    pHeader->mMagic = 0;
+
+    ThreadCounters* pCounters = getThreadCounters();
+    pCounters->mTags[pHeader->mTag].remove( pHeader->mSize );
+    findSite( pCounters, pHeader->mFileName, pHeader->mLine )->mCounters.remove( pHeader->mSize );
+
+    return pHeader;
+}
+
+//-----------------------------------------------------------------------------
+
+void* Memory::trackedAlloc( dsize_t size, const char* pFileName, const U32 line )
+{
+    return trackBlock( malloc( MemoryHeaderSize + size ), size, pFileName, line );
+}
+
+//-----------------------------------------------------------------------------
+
+void* Memory::trackedRealloc( void* pBlock, dsize_t size, const char* pFileName, const U32 line )
+{
+    if ( pBlock == NULL )
+        return trackedAlloc( size, pFileName, line );
+
+    if ( size == 0 )
+    {
+        trackedFree( pBlock );
+        return NULL;
+    }
+
+    // The grown block is charged to the site that grew it.
+    BlockHeader* pHeader = untrackBlock( pBlock );
+    void* pRaw = realloc( pHeader, MemoryHeaderSize + size );
+    if ( pRaw == NULL )
+    {
+        // The original block is still valid.
+        trackBlock( pHeader, pHeader->mSize, pHeader->mFileName, pHeader->mLine );
+        return NULL;
+    }
+
+    return trackBlock( pRaw, size, pFileName, line );
+}
+
+//-----------------------------------------------------------------------------
+
+void Memory::trackedFree( void* pBlock )
+{
+    if ( pBlock == NULL )
+        return;
+
+    free( untrackBlock( pBlock ) );
+}
+
+//-----------------------------------------------------------------------------
+
+Tag Memory::setThreadTag( const Tag tag )
+{
+    AssertFatal( tag < TagCount, "Memory::setThreadTag() - Invalid tag." );
+
+    const Tag previousTag = (Tag)tThreadTag;
+    tThreadTag = tag;
+    return previousTag;
+}
+
+//-----------------------------------------------------------------------------
+
+static void sumTags( Counters* pTotals )
+{
+    dMemset( pTotals, 0, sizeof(Counters) * TagCount );
+
+    if ( sThreadCountersMutex == NULL )
+        return;
+
+    MutexHandle mutex;
+    mutex.lock( sThreadCountersMutex, true );
+
+    // The counters of other threads are read without stopping them so the totals are approximate.
+    for ( ThreadCounters* pCounters = sThreadCountersList; pCounters != NULL; pCounters = pCounters->mNext )
+    {
+        for ( U32 tag = 0; tag < TagCount; ++tag )
+        {
+            pTotals[tag].mLiveBytes += pCounters->mTags[tag].mLiveBytes;
+            pTotals[tag].mLiveCount += pCounters->mTags[tag].mLiveCount;
+            pTotals[tag].mAllocCount += pCounters->mTags[tag].mAllocCount;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Memory::samplePeaks( void )
+{
+    Counters totals[TagCount];
+    sumTags( totals );
+
+    S64 totalBytes = 0;
+    for ( U32 tag = 0; tag < TagCount; ++tag )
+    {
+        if ( totals[tag].mLiveBytes > sPeakTagBytes[tag] )
+            sPeakTagBytes[tag] = totals[tag].mLiveBytes;
+
+        totalBytes += totals[tag].mLiveBytes;
+    }
+
+    if ( totalBytes > sPeakTotalBytes )
+        sPeakTotalBytes = totalBytes;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareSiteLocation( const void* a, const void* b )
+{
+    const SiteTotal* pSiteA = (const SiteTotal*)a;
+    const SiteTotal* pSiteB = (const SiteTotal*)b;
+
+    const S32 result = dStrcmp( pSiteA->mFileName, pSiteB->mFileName );
+    if ( result != 0 )
+        return result;
+
+    return (S32)pSiteA->mLine - (S32)pSiteB->mLine;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK compareSiteLiveBytes( const void* a, const void* b )
+{
+    const S64 bytesA = ((const SiteTotal*)a)->mCounters.mLiveBytes;
+    const S64 bytesB = ((const SiteTotal*)b)->mCounters.mLiveBytes;
+
+    return bytesA < bytesB ? 1 : bytesA > bytesB ? -1 : 0;
+}
+
+//-----------------------------------------------------------------------------
+
+static void pushSite( Vector<SiteTotal>& sites, const Site& site )
+{
+    if ( site.mFileName == NULL || site.mCounters.mAllocCount == 0 )
+        return;
+
+    SiteTotal total;
+    total.mFileName = site.mFileName;
+    total.mLine = site.mLine;
+    total.mCounters = site.mCounters;
+    sites.push_back( total );
+}
+
+//-----------------------------------------------------------------------------
+
+/// Sum the sites of all threads, sorted by location.
+static void collectSites( Vector<SiteTotal>& sites )
+{
+    Vector<SiteTotal> threadSites;
+
+    if ( sThreadCountersMutex != NULL )
+    {
+        MutexHandle mutex;
+        mutex.lock( sThreadCountersMutex, true );
+
+        for ( ThreadCounters* pCounters = sThreadCountersList; pCounters != NULL; pCounters = pCounters->mNext )
+        {
+            for ( U32 index = 0; index < MemorySiteTableSize; ++index )
+                pushSite( threadSites, pCounters->mSites[index] );
+
+            pushSite( threadSites, pCounters->mOverflowSite );
+        }
+    }
+
+    if ( threadSites.size() > 0 )
+        dQsort( threadSites.address(), threadSites.size(), sizeof(SiteTotal), compareSiteLocation );
+
+    // Merge the same site from different threads.
+    sites.clear();
+    for ( S32 index = 0; index < threadSites.size(); ++index )
+    {
+        const SiteTotal& site = threadSites[index];
+
+        if ( sites.size() > 0 && compareSiteLocation( &sites.last(), &site ) == 0 )
+        {
+            sites.last().mCounters.mLiveBytes += site.mCounters.mLiveBytes;
+            sites.last().mCounters.mLiveCount += site.mCounters.mLiveCount;
+            sites.last().mCounters.mAllocCount += site.mCounters.mAllocCount;
+        }
+        else
+        {
+            sites.push_back( site );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void dumpSites( Vector<SiteTotal>& sites, const U32 count )
+{
+    if ( sites.size() > 0 )
+        dQsort( sites.address(), sites.size(), sizeof(SiteTotal), compareSiteLiveBytes );
+
+    Con::printf( "      Live KB      Live      Allocs  Site" );
+
+    for ( S32 index = 0; index < sites.size() && index < (S32)count; ++index )
+    {
+        const SiteTotal& site = sites[index];
+
+        Con::printf( "%13.1f %9d %11.0f  %s(%d)",
+            (F64)site.mCounters.mLiveBytes / 1024.0,
+            (S32)site.mCounters.mLiveCount,
+            (F64)site.mCounters.mAllocCount,
+            site.mFileName,
+            site.mLine );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+ConsoleFunctionGroupBegin( Memory, "Memory tracking functionality." );
+
+ConsoleFunction(dumpMemoryTotals, void, 1, 1, "() Dumps the live memory and high-water mark of each memory tag to the console.\n"
+                                              "@return No return value.")
+{
+    Memory::samplePeaks();
+
+    Counters totals[TagCount];
+    sumTags( totals );
+
+    Con::printf( "Memory Tags:" );
+    Con::printf( "      Live KB      Live      Allocs      Peak KB  Tag" );
+
+    Counters sum;
+    dMemset( &sum, 0, sizeof(sum) );
+    for ( U32 tag = 0; tag < TagCount; ++tag )
+    {
+        Con::printf( "%13.1f %9d %11.0f %12.1f  %s",
+            (F64)totals[tag].mLiveBytes / 1024.0,
+            (S32)totals[tag].mLiveCount,
+            (F64)totals[tag].mAllocCount,
+            (F64)sPeakTagBytes[tag] / 1024.0,
+            sTagNames[tag] );
+
+        sum.mLiveBytes += totals[tag].mLiveBytes;
+        sum.mLiveCount += totals[tag].mLiveCount;
+        sum.mAllocCount += totals[tag].mAllocCount;
+    }
+
+    Con::printf( "%13.1f %9d %11.0f %12.1f  Total",
+        (F64)sum.mLiveBytes / 1024.0,
+        (S32)sum.mLiveCount,
+        (F64)sum.mAllocCount,
+        (F64)sPeakTotalBytes / 1024.0 );
+}
+
+ConsoleFunction(dumpMemorySites, void, 1, 2, "([count]) Dumps the allocation sites holding the most live memory to the console.\n"
+                                             "@param count The number of sites to dump (20 by default).\n"
+                                             "@return No return value.")
+{
+    Vector<SiteTotal> sites;
+    collectSites( sites );
+
+    Con::printf( "Memory Sites:" );
+    dumpSites( sites, argc > 1 ? dAtoi(argv[1]) : MemoryDefaultDumpCount );
+}
+
+ConsoleFunction(takeMemorySnapshot, void, 1, 1, "() Records the live memory of each tag and allocation site for dumpMemorySnapshotDiff().\n"
+                                                "@return No return value.")
+{
+    sumTags( sSnapshotTags );
+    collectSites( sSnapshotSites );
+    sSnapshotTaken = true;
+}
+
+ConsoleFunction(dumpMemorySnapshotDiff, void, 1, 2, "([count]) Dumps the tags and allocation sites whose live memory grew the most since takeMemorySnapshot().\n"
+                                                    "Sites that keep growing between snapshots are the likely leaks.\n"
+                                                    "@param count The number of sites to dump (20 by default).\n"
+                                                    "@return No return value.")
+{
+    if ( !sSnapshotTaken )
+    {
+        Con::warnf( "dumpMemorySnapshotDiff() - No snapshot has been taken." );
+        return;
+    }
+
+    Counters totals[TagCount];
+    sumTags( totals );
+
+    Con::printf( "Memory Tags since snapshot:" );
+    Con::printf( "      Live KB      Live      Allocs  Tag" );
+    for ( U32 tag = 0; tag < TagCount; ++tag )
+    {
+        Con::printf( "%+13.1f %+9d %11.0f  %s",
+            (F64)(totals[tag].mLiveBytes - sSnapshotTags[tag].mLiveBytes) / 1024.0,
+            (S32)(totals[tag].mLiveCount - sSnapshotTags[tag].mLiveCount),
+            (F64)(totals[tag].mAllocCount - sSnapshotTags[tag].mAllocCount),
+            sTagNames[tag] );
+    }
+
+    // Both lists are sorted by location so they can be walked together.
+    Vector<SiteTotal> sites;
+    collectSites( sites );
+
+    Vector<SiteTotal> growth;
+    S32 snapshotIndex = 0;
+    for ( S32 index = 0; index < sites.size(); ++index )
+    {
+        SiteTotal site = sites[index];
+
+        while ( snapshotIndex < sSnapshotSites.size() && compareSiteLocation( &sSnapshotSites[snapshotIndex], &site ) < 0 )
+            snapshotIndex++;
+
+        if ( snapshotIndex < sSnapshotSites.size() && compareSiteLocation( &sSnapshotSites[snapshotIndex], &site ) == 0 )
+        {
+            const Counters& previous = sSnapshotSites[snapshotIndex].mCounters;
+            site.mCounters.mLiveBytes -= previous.mLiveBytes;
+            site.mCounters.mLiveCount -= previous.mLiveCount;
+            site.mCounters.mAllocCount -= previous.mAllocCount;
+        }
+
+        if ( site.mCounters.mLiveBytes > 0 )
+            growth.push_back( site );
+    }
+
+    Con::printf( "Memory Sites since snapshot:" );
+    dumpSites( growth, argc > 1 ? dAtoi(argv[1]) : MemoryDefaultDumpCount );
+}
+
+ConsoleFunctionGroupEnd( Memory );
+
+#endif // TORQUE_TRACK_MEMORY
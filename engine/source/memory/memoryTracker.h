@@ -0,0 +1,89 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+#ifndef _MEMORY_TRACKER_H_
+#define _MEMORY_TRACKER_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Optional tracking of the allocations made through dMalloc, dRealloc and dFree.
+///
+/// When 'TORQUE_TRACK_MEMORY' is defined each allocation carries a small header
+/// recording its size, the file and line that allocated it and the subsystem tag
+/// that was current on the allocating thread.  Live bytes and counts are kept per
+/// tag and per allocation site in counters owned by each thread, so tracking does
+/// not take a lock on the allocation path.  The counters of all threads are summed
+/// when they are reported.
+///
+/// Subsystems tag their allocations with MEMORY_TAG_SCOPE, the innermost scope wins.
+/// Allocations made with the system allocator directly, including operator new, are
+/// not tracked.
+namespace Memory
+{
+    enum Tag
+    {
+        TagGeneral,
+        TagScript,
+        TagScene,
+        TagTextures,
+        TagAudio,
+        TagTaml,
+
+        TagCount
+    };
+
+#ifdef TORQUE_TRACK_MEMORY
+    void* trackedAlloc( dsize_t size, const char* pFileName, const U32 line );
+    void* trackedRealloc( void* pBlock, dsize_t size, const char* pFileName, const U32 line );
+    void trackedFree( void* pBlock );
+
+    /// Change the tag of the allocations made on the calling thread, returning the previous tag.
+    Tag setThreadTag( const Tag tag );
+
+    /// Fold the live totals into the high-water marks.  Called once a frame.
+    void samplePeaks( void );
+
+    /// Sets the tag of the allocations made on the calling thread for its lifetime.
+    class TagScope
+    {
+    public:
+        TagScope( const Tag tag ) : mPreviousTag( setThreadTag( tag ) ) {}
+        ~TagScope() { setThreadTag( mPreviousTag ); }
+
+    private:
+        Tag mPreviousTag;
+    };
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_TRACK_MEMORY
+#define MEMORY_TAG_SCOPE( tag ) Memory::TagScope memoryTagScope( Memory::tag )
+#else
+#define MEMORY_TAG_SCOPE( tag )
+#endif
+
+#endif // _MEMORY_TRACKER_H_
@@ -37,6 +37,7 @@
 #include "platform/threads/mutex.h"
 #include "collection/simpleHashTable.h"
 #include "memory/safeDelete.h"
+#include "memory/frameAllocator.h"
 
 namespace Dispatcher
 {
@@ -85,9 +86,20 @@ static struct _DispatchData
    void *mMutex;
    SimpleHashTable<MessageQueue> mQueues;
 
+   /// Guards #mQueues against posting threads and #mPostedQueues. Held with
+   /// #mMutex when queues are added or removed and only to find a queue when
+   /// posting, so a queue's post mutex is taken while holding it.
+   void *mQueuesMutex;
+   /// Queues with messages waiting for deliverPostedMessages().
+   Vector<StringTableEntry> mPostedQueues;
+   /// Incremented when a queue is unregistered.
+   U32 mQueueSequence;
+
    _DispatchData()
    {
       mMutex = Mutex::createMutex();
+      mQueuesMutex = Mutex::createMutex();
+      mQueueSequence = 0;
    }
 
    ~_DispatchData()
@@ -100,11 +112,26 @@ static struct _DispatchData
       }
 
       Mutex::destroyMutex( mMutex );
+      Mutex::destroyMutex( mQueuesMutex );
       //SAFE_DELETE(mMutex);
       mMutex = NULL;
+      mQueuesMutex = NULL;
    }
 } gDispatchData;
 
+/// Header for each message posted to a queue. The payload follows it.
+struct PostedMessage
+{
+   U32 mType;
+   U32 mSize;
+};
+
+// Records are padded so the payloads stay aligned.
+static inline U32 postedMessageSize(const U32 size)
+{
+   return (sizeof(PostedMessage) + size + 7) & ~7;
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Queue Registration
 //////////////////////////////////////////////////////////////////////////
@@ -129,7 +156,11 @@ void registerMessageQueue(const char *name)
    {
       MessageQueue *queue = new MessageQueue;
       queue->mQueueName = StringTable->insert(name);
+
+      MutexHandle queuesMutex;
+      queuesMutex.lock(gDispatchData.mQueuesMutex, true);
       gDispatchData.mQueues.insert(queue, name);
+      queuesMutex.unlock();
 
       Mutex::unlockMutex( gDispatchData.mMutex );
    }
@@ -140,10 +171,31 @@ void unregisterMessageQueue(const char *name)
    MutexHandle mh;
    if(mh.lock(gDispatchData.mMutex, true))
    {
+      // Posted messages are discarded with the queue.
+      MutexHandle queuesMutex;
+      queuesMutex.lock(gDispatchData.mQueuesMutex, true);
       MessageQueue *queue = gDispatchData.mQueues.remove(name);
       if(queue == NULL)
          return;
 
+      // Forget that it has messages waiting, or a queue registered with the
+      // same name would be listed twice and never have its messages delivered.
+      for(S32 i = 0;i < gDispatchData.mPostedQueues.size();i++)
+      {
+         if(gDispatchData.mPostedQueues[i] == queue->mQueueName)
+         {
+            gDispatchData.mPostedQueues.erase(i);
+            break;
+         }
+      }
+
+      gDispatchData.mQueueSequence++;
+      queuesMutex.unlock();
+
+      // Wait for any thread still posting to it.
+      Mutex::lockMutex(queue->mPostMutex, true);
+      Mutex::unlockMutex(queue->mPostMutex);
+
       // Tell the listeners about it
       for(S32 i = 0;i < queue->mListeners.size();i++)
       {
@@ -278,6 +330,112 @@ bool dispatchMessageObject(const char *queue, Message *msg)
    return bResult;
 }
 
+//////////////////////////////////////////////////////////////////////////
+// Batched Delivery
+//////////////////////////////////////////////////////////////////////////
+
+bool postMessage(const char *queue, U32 type, const void *data, U32 size)
+{
+   const U32 recordSize = postedMessageSize(size);
+
+   MutexHandle queuesMutex;
+
+   if(! queuesMutex.lock(gDispatchData.mQueuesMutex, true))
+      return false;
+
+   MessageQueue *q = gDispatchData.mQueues.retrieve(queue);
+   if(q == NULL)
+   {
+      queuesMutex.unlock();
+      Con::errorf("Dispatcher::postMessage - Attempting to post to unknown queue '%s'", queue);
+      return false;
+   }
+
+   // Hold the queue before letting go of the table so it can't be removed
+   // under us, then copy the message holding only the queue.
+   MutexHandle mh;
+   mh.lock(q->mPostMutex, true);
+
+   Vector<U8> &posted = q->mPosted[q->mPostIndex];
+   if(posted.empty())
+      gDispatchData.mPostedQueues.push_back(q->mQueueName);
+
+   queuesMutex.unlock();
+
+   const U32 offset = posted.size();
+   posted.increment(recordSize);
+
+   PostedMessage *record = (PostedMessage *)(posted.address() + offset);
+   record->mType = type;
+   record->mSize = size;
+   dMemcpy(record + 1, data, size);
+
+   return true;
+}
+
+void deliverPostedMessages()
+{
+   AssertFatal(Con::isMainThread(), "Dispatcher::deliverPostedMessages - Messages must be delivered on the main thread.");
+
+   MutexHandle mh;
+
+   if(! mh.lock(gDispatchData.mMutex, true))
+      return;
+
+   // Take the queues with waiting messages.  Anything posted from here on is
+   // held for the next delivery.
+   static Vector<StringTableEntry> deliverQueues;
+   if(Mutex::lockMutex(gDispatchData.mQueuesMutex, true))
+   {
+      deliverQueues.merge(gDispatchData.mPostedQueues);
+      gDispatchData.mPostedQueues.clear();
+
+      for(S32 i = 0;i < deliverQueues.size();i++)
+      {
+         MessageQueue *q = gDispatchData.mQueues.retrieve(deliverQueues[i]);
+         if(q == NULL)
+            continue;
+
+         Mutex::lockMutex(q->mPostMutex, true);
+         q->mPostIndex ^= 1;
+         Mutex::unlockMutex(q->mPostMutex);
+      }
+
+      Mutex::unlockMutex(gDispatchData.mQueuesMutex);
+   }
+
+   for(S32 i = 0;i < deliverQueues.size();i++)
+   {
+      MessageQueue *q = gDispatchData.mQueues.retrieve(deliverQueues[i]);
+      if(q == NULL)
+         continue;
+
+      Vector<U8> &batch = q->mPosted[q->mPostIndex ^ 1];
+      const U32 batchSize = batch.size();
+      const U32 queueSequence = gDispatchData.mQueueSequence;
+
+      for(U32 offset = 0;offset < batchSize;)
+      {
+         const PostedMessage *record = (const PostedMessage *)(batch.address() + offset);
+         offset += postedMessageSize(record->mSize);
+
+         q->dispatchMessageData(record->mType, record + 1, record->mSize);
+
+         // Stop if a listener unregistered a queue, which may have been this one.
+         if(gDispatchData.mQueueSequence != queueSequence && gDispatchData.mQueues.retrieve(deliverQueues[i]) != q)
+         {
+            q = NULL;
+            break;
+         }
+      }
+
+      if(q != NULL)
+         batch.clear();
+   }
+
+   deliverQueues.clear();
+}
+
 //////////////////////////////////////////////////////////////////////////
 // Internal Functions
 //////////////////////////////////////////////////////////////////////////
@@ -382,3 +540,21 @@ ConsoleFunction(dispatchMessageObject, bool, 3, 3, "(queueName, message) Dispatc
 
    return dispatchMessageObject(argv[1], msg);
 }
+
+ConsoleFunction(postMessage, bool, 3, 4, "(queueName, event, data) Posts a message to given message queue for delivery with the next batch\n"
+                "Posted messages are delivered once per tick instead of when they are dispatched.\n"
+                "@param queueName The queue to post to\n"
+                "@param event The message you are passing\n"
+                "@param data Data\n"
+                "@return Returns true on success and false otherwise")
+{
+   const char *data = argc > 3 ? argv[3] : "";
+   const U32 eventLength = dStrlen(argv[2]) + 1;
+   const U32 dataLength = dStrlen(data) + 1;
+
+   FrameTemp<char> payload(eventLength + dataLength);
+   dMemcpy(~payload, argv[2], eventLength);
+   dMemcpy(~payload + eventLength, data, dataLength);
+
+   return postMessage(argv[1], StringMessageType, ~payload, eventLength + dataLength);
+}
@@ -35,6 +35,7 @@
 
 #include "messaging/message.h"
 #include "console/console.h"
+#include "platform/threads/mutex.h"
 
 #ifndef _DISPATCHER_H_
 #define _DISPATCHER_H_
@@ -94,6 +95,20 @@ public:
    //////////////////////////////////////////////////////////////////////////
    virtual bool onMessageObjectReceived(StringTableEntry queue, Message *msg ) = 0;
 
+   //////////////////////////////////////////////////////////////////////////
+   /// @brief Callback for when typed messages posted with postMessage() are delivered
+   ///
+   /// The default implementation ignores the message.
+   /// 
+   /// @param queue The name of the queue the message was posted to
+   /// @param type The application defined type of the message
+   /// @param data The payload for the message
+   /// @param size The size of the payload in bytes
+   /// @return false to prevent other listeners receiving this message, true otherwise
+   /// @see postMessage()
+   //////////////////////////////////////////////////////////////////////////
+   virtual bool onMessageDataReceived(StringTableEntry queue, U32 type, const void *data, U32 size) { return true; }
+
 
    //////////////////////////////////////////////////////////////////////////
    /// @brief Callback for when the listener is added to a queue
@@ -122,6 +137,14 @@ public:
    virtual void onRemoveFromQueue(StringTableEntry queue);
 };
 
+//////////////////////////////////////////////////////////////////////////
+/// @brief Message type used for string messages posted with postMessage()
+///
+/// The payload holds the message and its data as two consecutive strings
+/// and is delivered through IMessageListener::onMessageReceived().
+//////////////////////////////////////////////////////////////////////////
+const U32 StringMessageType = 0;
+
 //////////////////////////////////////////////////////////////////////////
 /// @brief Internal class for tracking message queues
 //////////////////////////////////////////////////////////////////////////
@@ -130,8 +153,21 @@ struct MessageQueue
    StringTableEntry mQueueName;
    VectorPtr<IMessageListener *> mListeners;
 
-   MessageQueue() : mQueueName("")
+   /// Messages posted for batched delivery. Messages are posted to the buffer
+   /// at #mPostIndex while the other buffer is delivered.
+   Vector<U8> mPosted[2];
+   U32 mPostIndex;
+   /// Guards #mPosted and #mPostIndex so queues can be posted to independently.
+   void *mPostMutex;
+
+   MessageQueue() : mQueueName(""), mPostIndex(0)
    {
+      mPostMutex = Mutex::createMutex();
+   }
+
+   ~MessageQueue()
+   {
+      Mutex::destroyMutex(mPostMutex);
    }
 
    bool isEmpty()    { return mListeners.size() == 0; }
@@ -155,6 +191,22 @@ struct MessageQueue
       }
       return true;
    }
+
+   bool dispatchMessageData(U32 type, const void *data, U32 size)
+   {
+      if(type == StringMessageType)
+      {
+         const char *event = (const char *)data;
+         return dispatchMessage(event, event + dStrlen(event) + 1);
+      }
+
+      for(VectorPtr<IMessageListener *>::iterator i = mListeners.begin();i != mListeners.end();i++)
+      {
+         if( !(*i)->onMessageDataReceived(mQueueName, type, data, size) )
+            return false;
+      }
+      return true;
+   }
 };
 
 //////////////////////////////////////////////////////////////////////////
@@ -236,6 +288,55 @@ extern bool dispatchMessageObject(const char *queue, Message *msg);
 
 // @}
 
+/// @name Batched Delivery
+// @{
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Post a typed message to a queue for batched delivery
+///
+/// The payload is copied and delivered to the listeners of the queue by the
+/// next call to deliverPostedMessages(). Messages are delivered in the order
+/// they were posted to each queue. This may be called from any thread and
+/// does not wait on the dispatcher mutex, so worker threads do not contend
+/// with messages being dispatched on the main thread. Each queue has its own
+/// post buffer, so posts to different queues only share a brief lookup.
+/// 
+/// @param queue Queue to post the message to
+/// @param type Application defined type of the message
+/// @param data Payload for the message, which must be safe to copy with dMemcpy
+/// @param size Size of the payload in bytes
+/// @return true for success, false if the queue is not registered
+/// @see deliverPostedMessages(), IMessageListener::onMessageDataReceived()
+//////////////////////////////////////////////////////////////////////////
+extern bool postMessage(const char *queue, U32 type, const void *data, U32 size);
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Post a typed message to a queue for batched delivery
+///
+/// @param queue Queue to post the message to
+/// @param type Application defined type of the message
+/// @param data Payload for the message, which must be safe to copy with dMemcpy
+/// @return true for success, false if the queue is not registered
+/// @see postMessage()
+//////////////////////////////////////////////////////////////////////////
+template<class T> inline bool postMessage(const char *queue, U32 type, const T &data)
+{
+   return postMessage(queue, type, &data, sizeof(T));
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// @brief Deliver all messages posted since the last delivery
+///
+/// This is called on the main thread once per time event, before the
+/// process lists are ticked. Messages posted while delivering are held
+/// for the next delivery.
+/// 
+/// @see postMessage()
+//////////////////////////////////////////////////////////////////////////
+extern void deliverPostedMessages();
+
+// @}
+
 //////////////////////////////////////////////////////////////////////////
 // Internal Functions
 //////////////////////////////////////////////////////////////////////////
@@ -34,6 +34,13 @@ class ModuleCallbacks
     friend class ModuleManager;
 
 private:
+    // Called for each module queued for loading, in load order, before any of them are loaded.
+    // Work started here must not depend on anything the modules loaded ahead of it provide.
+    virtual void onModulePrefetch( ModuleDefinition* pModuleDefinition ) {}
+
+    // Called for a module that was prefetched but will not be loaded, e.g. as it was loaded by a module ahead of it.
+    virtual void onModulePrefetchCancel( ModuleDefinition* pModuleDefinition ) {}
+
     // Called when a module is about to be loaded.
     virtual void onModulePreLoad( ModuleDefinition* pModuleDefinition ) {}
 
@@ -355,6 +355,9 @@ bool ModuleManager::loadModuleGroup( const char* pModuleGroup )
     // Add module group.
     mGroupsLoaded.push_back( moduleGroup );
 
+    // Raise notifications.
+    raiseModulePrefetchNotifications( moduleReadyQueue );
+
     // Reset modules loaded count.
     U32 modulesLoadedCount = 0;
 
@@ -376,6 +379,9 @@ bool ModuleManager::loadModuleGroup( const char* pModuleGroup )
             // Yes, so increase load count.
             pLoadedEntry->mpModuleDefinition->increaseLoadCount();
 
+            // Raise notifications.
+            raiseModulePrefetchCancelNotifications( pLoadReadyModuleDefinition );
+
             // Skip.
             continue;
         }
@@ -718,6 +724,9 @@ bool ModuleManager::loadModuleExplicit( const char* pModuleId, const U32 version
         }
     }
 
+    // Raise notifications.
+    raiseModulePrefetchNotifications( moduleReadyQueue );
+
     // Reset modules loaded count.
     U32 modulesLoadedCount = 0;
 
@@ -739,6 +748,9 @@ bool ModuleManager::loadModuleExplicit( const char* pModuleId, const U32 version
             // Yes, so increase load count.
             pLoadedEntry->mpModuleDefinition->increaseLoadCount();
 
+            // Raise notifications.
+            raiseModulePrefetchCancelNotifications( pLoadReadyModuleDefinition );
+
             // Skip.
             continue;
         }
@@ -2159,6 +2171,45 @@ bool ModuleManager::unregisterModule( const char* pModuleId, const U32 versionId
 
 //-----------------------------------------------------------------------------
 
+void ModuleManager::raiseModulePrefetchNotifications( typeModuleLoadEntryVector& moduleReadyQueue )
+{
+    // Iterate the modules in load order.
+    for ( typeModuleLoadEntryVector::iterator moduleReadyItr = moduleReadyQueue.begin(); moduleReadyItr != moduleReadyQueue.end(); ++moduleReadyItr )
+    {
+        // Fetch load ready module definition.
+        ModuleDefinition* pLoadReadyModuleDefinition = moduleReadyItr->mpModuleDefinition;
+
+        // Skip if the module is already loaded.
+        if ( findModuleLoaded( pLoadReadyModuleDefinition->getModuleId() ) != NULL )
+            continue;
+
+        // Raise notifications.
+        for( SimSet::iterator notifyItr = mNotificationListeners.begin(); notifyItr != mNotificationListeners.end(); ++notifyItr )
+        {
+            // Perform object callback.
+            ModuleCallbacks* pCallbacks = dynamic_cast<ModuleCallbacks*>( *notifyItr );
+            if ( pCallbacks != NULL )
+                pCallbacks->onModulePrefetch( pLoadReadyModuleDefinition );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ModuleManager::raiseModulePrefetchCancelNotifications( ModuleDefinition* pModuleDefinition )
+{
+    // Raise notifications.
+    for( SimSet::iterator notifyItr = mNotificationListeners.begin(); notifyItr != mNotificationListeners.end(); ++notifyItr )
+    {
+        // Perform object callback.
+        ModuleCallbacks* pCallbacks = dynamic_cast<ModuleCallbacks*>( *notifyItr );
+        if ( pCallbacks != NULL )
+            pCallbacks->onModulePrefetchCancel( pModuleDefinition );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 void ModuleManager::raiseModulePreLoadNotifications( ModuleDefinition* pModuleDefinition )
 {
     // Raise notifications.
@@ -185,6 +185,8 @@ private:
     bool removeModuleDefinition( ModuleDefinition* pModuleDefinition );
     bool registerModule( const char* pModulePath, const char* pModuleFile );
 
+    void raiseModulePrefetchNotifications( typeModuleLoadEntryVector& moduleReadyQueue );
+    void raiseModulePrefetchCancelNotifications( ModuleDefinition* pModuleDefinition );
     void raiseModulePreLoadNotifications( ModuleDefinition* pModuleDefinition );
     void raiseModulePostLoadNotifications( ModuleDefinition* pModuleDefinition );
     void raiseModulePreUnloadNotifications( ModuleDefinition* pModuleDefinition );
@@ -0,0 +1,272 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "network/ghostSnapshot.h"
+#include "network/netObject.h"
+#include "io/bitStream.h"
+
+//-----------------------------------------------------------------------------
+
+// The deltas are computed in unsigned arithmetic so that they wrap instead of overflowing.
+static inline S32 getSnapshotDelta(const S32 *baseline, const S32 *fields, const U32 index)
+{
+   return S32(U32(fields[index]) - U32(baseline ? baseline[index] : 0));
+}
+
+//-----------------------------------------------------------------------------
+
+void GhostSnapshot::writeDelta(BitStream *stream, const S32 *baseline, const S32 *fields, U32 count)
+{
+   AssertFatal(count <= MaxFieldCount, "GhostSnapshot::writeDelta() - Too many snapshot fields.");
+
+   // Find the average size of the changes.
+   U32 changedCount = 0;
+   U64 magnitude = 0;
+   for(U32 i = 0; i < count; i++)
+   {
+      const S32 delta = getSnapshotDelta(baseline, fields, i);
+      if(delta == 0)
+         continue;
+
+      changedCount++;
+      magnitude += (U32(delta) << 1) ^ U32(delta >> 31);
+   }
+
+   if(!stream->writeFlag(changedCount != 0))
+      return;
+
+   // Pick the code order that suits the average change.
+   const U64 average = magnitude / changedCount;
+   U32 order = 0;
+   while(order < (1 << GolombOrderBitSize) - 1 && (U64(2) << order) <= average)
+      order++;
+
+   stream->writeInt(order, GolombOrderBitSize);
+
+   for(U32 i = 0; i < count; i++)
+   {
+      const S32 delta = getSnapshotDelta(baseline, fields, i);
+      if(stream->writeFlag(delta != 0))
+         stream->writeGolombS32(delta, order);
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void GhostSnapshot::readDelta(BitStream *stream, const S32 *baseline, S32 *fields, U32 count)
+{
+   AssertFatal(count <= MaxFieldCount, "GhostSnapshot::readDelta() - Too many snapshot fields.");
+
+   if(!stream->readFlag())
+   {
+      for(U32 i = 0; i < count; i++)
+         fields[i] = baseline ? baseline[i] : 0;
+      return;
+   }
+
+   const U32 order = stream->readInt(GolombOrderBitSize);
+
+   for(U32 i = 0; i < count; i++)
+   {
+      const S32 delta = stream->readFlag() ? stream->readGolombS32(order) : 0;
+      fields[i] = S32(U32(baseline ? baseline[i] : 0) + U32(delta));
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+void GhostSnapshot::writeObject(BitStream *stream, NetConnection *conn, NetObject *object)
+{
+   const U32 count = object->getSnapshotFieldCount();
+   if(count == 0)
+      return;
+
+   S32 fields[MaxFieldCount];
+   object->packSnapshot(conn, fields);
+   writeDelta(stream, NULL, fields, count);
+}
+
+//-----------------------------------------------------------------------------
+
+void GhostSnapshot::readObject(BitStream *stream, NetConnection *conn, NetObject *object)
+{
+   const U32 count = object->getSnapshotFieldCount();
+   if(count == 0)
+      return;
+
+   S32 fields[MaxFieldCount];
+   readDelta(stream, NULL, fields, count);
+   if(stream->isValid())
+      object->unpackSnapshot(conn, fields);
+}
+
+//-----------------------------------------------------------------------------
+
+U32 GhostSnapshotBaseline::getAge(const U32 sequence) const
+{
+   if(mFields == NULL || sequence - mSequence >= GhostSnapshot::HistorySize)
+      return 0;
+
+   return sequence - mSequence;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 *GhostSnapshotBaseline::write(BitStream *stream, const S32 *fields, const U32 count, const U32 sequence, const bool keep) const
+{
+   const U32 age = getAge(sequence);
+   stream->writeInt(age, GhostSnapshot::HistoryBitSize);
+   GhostSnapshot::writeDelta(stream, age ? mFields : NULL, fields, count);
+
+   if(!keep)
+      return NULL;
+
+   S32 *copy = (S32 *)dMalloc(count * sizeof(S32));
+   dMemcpy(copy, fields, count * sizeof(S32));
+   return copy;
+}
+
+//-----------------------------------------------------------------------------
+
+void GhostSnapshotBaseline::acknowledge(S32 *fields, const U32 sequence)
+{
+   dFree(mFields);
+   mFields = fields;
+   mSequence = sequence;
+}
+
+//-----------------------------------------------------------------------------
+
+void GhostSnapshotBaseline::clear()
+{
+   dFree(mFields);
+   mFields = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+GhostSnapshotHistory::GhostSnapshotHistory(const U32 fieldCount) :
+   mFieldCount(fieldCount),
+   mNext(0)
+{
+   AssertFatal(fieldCount <= GhostSnapshot::MaxFieldCount, "GhostSnapshotHistory - Too many snapshot fields.");
+
+   for(U32 i = 0; i < GhostSnapshot::HistorySize; i++)
+      mValid[i] = false;
+
+   mFields = (S32 *)dMalloc(GhostSnapshot::HistorySize * mFieldCount * sizeof(S32));
+}
+
+//-----------------------------------------------------------------------------
+
+GhostSnapshotHistory::~GhostSnapshotHistory()
+{
+   dFree(mFields);
+}
+
+//-----------------------------------------------------------------------------
+
+const S32 *GhostSnapshotHistory::find(const U32 sequence) const
+{
+   for(U32 i = 0; i < GhostSnapshot::HistorySize; i++)
+   {
+      if(mValid[i] && mSequence[i] == sequence)
+         return mFields + i * mFieldCount;
+   }
+
+   return NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void GhostSnapshotHistory::add(const U32 sequence, const S32 *fields)
+{
+   const U32 slot = mNext;
+   mNext = (mNext + 1) % GhostSnapshot::HistorySize;
+
+   mValid[slot] = true;
+   mSequence[slot] = sequence;
+   dMemcpy(mFields + slot * mFieldCount, fields, mFieldCount * sizeof(S32));
+}
+
+//-----------------------------------------------------------------------------
+
+bool GhostSnapshotHistory::readUpdate(BitStream *stream, const U32 sequence, S32 *fields)
+{
+   const U32 age = stream->readInt(GhostSnapshot::HistoryBitSize);
+   const S32 *baseline = NULL;
+   if(age)
+   {
+      baseline = find(sequence - age);
+      if(baseline == NULL)
+         return false;
+   }
+
+   GhostSnapshot::readDelta(stream, baseline, fields, mFieldCount);
+   if(!stream->isValid())
+      return false;
+
+   add(sequence, fields);
+   return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void GhostSnapshotHistory::write(ResizeBitStream *stream) const
+{
+   // Oldest first so that reading them back keeps the order, each against the one before it.
+   const S32 *previous = NULL;
+   for(U32 i = 0; i < GhostSnapshot::HistorySize; i++)
+   {
+      const U32 slot = (mNext + i) % GhostSnapshot::HistorySize;
+      if(!mValid[slot])
+         continue;
+
+      const S32 *fields = mFields + slot * mFieldCount;
+      stream->writeFlag(true);
+      stream->writeInt(mSequence[slot], 32);
+      GhostSnapshot::writeDelta(stream, previous, fields, mFieldCount);
+      stream->validate();
+      previous = fields;
+   }
+
+   stream->writeFlag(false);
+}
+
+//-----------------------------------------------------------------------------
+
+void GhostSnapshotHistory::read(BitStream *stream)
+{
+   for(U32 i = 0; i < GhostSnapshot::HistorySize; i++)
+      mValid[i] = false;
+   mNext = 0;
+
+   S32 fields[GhostSnapshot::MaxFieldCount];
+   const S32 *previous = NULL;
+   while(stream->readFlag() && stream->isValid())
+   {
+      const U32 sequence = stream->readInt(32);
+      GhostSnapshot::readDelta(stream, previous, fields, mFieldCount);
+      add(sequence, fields);
+      previous = mFields + ((mNext + GhostSnapshot::HistorySize - 1) % GhostSnapshot::HistorySize) * mFieldCount;
+   }
+}
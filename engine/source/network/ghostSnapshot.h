@@ -0,0 +1,144 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _GHOSTSNAPSHOT_H_
+#define _GHOSTSNAPSHOT_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+class BitStream;
+class ResizeBitStream;
+class NetConnection;
+class NetObject;
+
+//-----------------------------------------------------------------------------
+/// Encoding for the snapshot fields of ghosted objects.
+///
+/// NetObjects that return a count from NetObject::getSnapshotFieldCount() send
+/// their state as quantized integer fields after each update.  The fields are
+/// written as differences against a baseline, the last snapshot the client
+/// acknowledged, and the differences are entropy coded with exponential Golomb
+/// codes so that small changes take only a few bits.  Without a baseline the
+/// fields are written as differences against zero.
+///
+/// @see NetConnection::setSnapshotUpdates()
+namespace GhostSnapshot
+{
+   enum Constants
+   {
+      HistorySize = 32,          ///< Number of snapshots the client keeps for each ghost.
+      HistoryBitSize = 5,        ///< Bits used to reference a baseline in the history.
+      MaxFieldCount = 64,        ///< Largest supported snapshot.
+      GolombOrderBitSize = 4,    ///< Bits used to write the Golomb code order.
+   };
+
+   /// Write the fields as deltas against the baseline, or against zero if the baseline is NULL.
+   void writeDelta(BitStream *stream, const S32 *baseline, const S32 *fields, U32 count);
+
+   /// Read fields written with writeDelta() using the same baseline.
+   void readDelta(BitStream *stream, const S32 *baseline, S32 *fields, U32 count);
+
+   /// Write the full snapshot of an object that has snapshot fields, for updates sent outside the ghost stream.
+   void writeObject(BitStream *stream, NetConnection *conn, NetObject *object);
+
+   /// Read a snapshot written with writeObject() into the object.
+   void readObject(BitStream *stream, NetConnection *conn, NetObject *object);
+}
+
+//-----------------------------------------------------------------------------
+/// The last snapshot of one ghost that the client acknowledged, kept by the server.
+///
+/// Each update is written against the baseline when the client still holds it,
+/// and the copy sent in a packet becomes the new baseline when that packet is
+/// acknowledged.  The copies travel with the packet notify and are released
+/// with drop() when the packet is lost.
+class GhostSnapshotBaseline
+{
+   S32 *mFields;
+   U32 mSequence;
+
+public:
+   GhostSnapshotBaseline() : mFields(NULL), mSequence(0) {}
+   ~GhostSnapshotBaseline() { clear(); }
+
+   const S32 *getFields() const { return mFields; }
+   U32 getSequence() const { return mSequence; }
+
+   /// Number of packets between the baseline and the packet with the given sequence, or zero if the client no longer holds it.
+   U32 getAge(const U32 sequence) const;
+
+   /// Write the age of the baseline and the fields as deltas against it.
+   ///
+   /// @return A copy of the fields to pass to acknowledge() or drop() once the
+   ///         packet is notified, or NULL if keep is false.
+   S32 *write(BitStream *stream, const S32 *fields, const U32 count, const U32 sequence, const bool keep) const;
+
+   /// Take ownership of the fields sent in the acknowledged packet with the given sequence.
+   void acknowledge(S32 *fields, const U32 sequence);
+
+   /// Release the fields sent in a lost packet.
+   static void drop(S32 *fields) { dFree(fields); }
+
+   void clear();
+};
+
+//-----------------------------------------------------------------------------
+/// The snapshots a client received for one ghost, indexed by packet sequence.
+///
+/// The server only references baselines from fewer than HistorySize packets
+/// ago, and at most one snapshot is sent per ghost in each packet, so the
+/// baseline is always still in the history.
+class GhostSnapshotHistory
+{
+   U32 mFieldCount;
+   U32 mNext;
+   U32 mSequence[GhostSnapshot::HistorySize];
+   bool mValid[GhostSnapshot::HistorySize];
+   S32 *mFields;
+
+public:
+   GhostSnapshotHistory(const U32 fieldCount);
+   ~GhostSnapshotHistory();
+
+   U32 getFieldCount() const { return mFieldCount; }
+
+   /// Find the snapshot received in the packet with the given sequence, or NULL if it is not held.
+   const S32 *find(const U32 sequence) const;
+
+   /// Store the snapshot received in the packet with the given sequence, replacing the oldest.
+   void add(const U32 sequence, const S32 *fields);
+
+   /// Read an update written with GhostSnapshotBaseline::write() in the packet with the given sequence and add it.
+   ///
+   /// @return False if the baseline is not held or the stream ran out.
+   bool readUpdate(BitStream *stream, const U32 sequence, S32 *fields);
+
+   /// @name Demo Recording
+   /// @{
+   void write(ResizeBitStream *stream) const;
+   void read(BitStream *stream);
+   /// @}
+};
+
+#endif // _GHOSTSNAPSHOT_H_
@@ -284,6 +284,8 @@ NetConnection::NetConnection()
    mGhostRefs = NULL;
    mGhostLookupTable = NULL;
    mLocalGhosts = NULL;
+   mLocalSnapshots = NULL;
+   mSnapshotUpdates = false;
 
    mGhostsActive = 0;
 
@@ -311,6 +313,12 @@ NetConnection::~NetConnection()
    if(mCurrentDownloadingFile)
       ResourceManager->closeStream(mCurrentDownloadingFile);
 
+   if(mLocalSnapshots)
+   {
+      for(U32 i = 0; i < MaxGhostCount; i++)
+         clearLocalSnapshots(i);
+   }
+   delete[] mLocalSnapshots;
    delete[] mLocalGhosts;
    delete[] mGhostLookupTable;
    delete[] mGhostRefs;
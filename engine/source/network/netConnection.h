@@ -42,6 +42,10 @@
 #ifndef _H_CONNECTIONSTRINGTABLE
 #include "network/connectionStringTable.h"
 #endif
+
+#ifndef _GHOSTSNAPSHOT_H_
+#include "network/ghostSnapshot.h"
+#endif
 //----------------------------------------------------------------------------
 // the sim connection encapsulates the packet stream,
 // ghost manager, event manager and playerPSC of the old tribes net code
@@ -421,6 +425,8 @@ public:
         GhostInfo *ghost;          ///< Reference to the GhostInfo we're from.
         GhostRef *nextRef;         ///< Next GhostRef in this packet.
         GhostRef *nextUpdateChain; ///< Next update we sent for this ghost.
+        S32 *snapshot;             ///< Snapshot fields we transmitted, if they may become the baseline.
+        U32 snapshotSeq;           ///< Packet sequence the snapshot was sent in.
     };
 
     enum Constants
@@ -776,6 +782,10 @@ protected:
     ///
     /// mLocalGhosts pointer is NULL if mGhostTo is false
 
+    GhostSnapshotHistory **mLocalSnapshots; ///< Snapshots received for each local ghost.
+
+    bool mSnapshotUpdates;     ///< Are snapshot fields sent against acknowledged baselines?
+
     GhostInfo *mGhostRefs;           ///< Allocated array of ghostInfos. Null if ghostFrom is false.
     GhostInfo **mGhostLookupTable;   ///< Table indexed by object id to GhostInfo. Null if ghostFrom is false.
 
@@ -795,6 +805,10 @@ protected:
     void ghostReadPacket(BitStream *bstream);
     void freeGhostInfo(GhostInfo *);
 
+    void ghostWriteSnapshot(BitStream *bstream, GhostInfo *ghost, GhostRef *update);
+    bool ghostReadSnapshot(BitStream *bstream, U32 index);
+    void clearLocalSnapshots(U32 index);
+
     void ghostWriteStartBlock(ResizeBitStream *stream);
     void ghostReadStartBlock(BitStream *stream);
 
@@ -879,6 +893,15 @@ public:
     /// Are we ghosting?
     bool isGhosting() { return mGhosting; }
 
+    /// Set whether object snapshots are sent as deltas against the last snapshot
+    /// the other side acknowledged, rather than against zero.
+    ///
+    /// This only affects objects that send snapshot fields, see NetObject::packSnapshot().
+    void setSnapshotUpdates(bool enabled) { mSnapshotUpdates = enabled; }
+
+    /// Are object snapshots sent against acknowledged baselines?
+    bool isSnapshotUpdates() { return mSnapshotUpdates; }
+
     /// Begin to stop ghosting an object.
     void detachObject(GhostInfo *info);
 
@@ -1057,6 +1080,8 @@ public:  // required for MSVC
     U32 index;
     U32 arrayIndex;
 
+    GhostSnapshotBaseline snapshotBaseline; ///< Last snapshot fields the client acknowledged.
+
     /// Flags relating to the state of the object.
     enum Flags
     {
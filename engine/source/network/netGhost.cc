@@ -26,6 +26,7 @@
 #include "network/netConnection.h"
 #include "io/bitStream.h"
 #include "network/netObject.h"
+#include "network/ghostSnapshot.h"
 #include "io/resource/resourceManager.h"
 #include "console/console.h"
 #include "console/consoleTypes.h"
@@ -63,6 +64,7 @@ public:
          S32 classId = obj->getClassId(ps->getNetClassGroup());
          bstream->writeClassId(classId, NetClassTypeObject, ps->getNetClassGroup());
          obj->packUpdate(ps, 0xFFFFFFFF, bstream);
+         GhostSnapshot::writeObject(bstream, ps, obj);
       }
    }
    void write(NetConnection *ps, BitStream *bstream)
@@ -73,6 +75,7 @@ public:
          S32 classId = object->getClassId(ps->getNetClassGroup());
          bstream->writeClassId(classId, NetClassTypeObject, ps->getNetClassGroup());
          object->packUpdate(ps, 0xFFFFFFFF, bstream);
+         GhostSnapshot::writeObject(bstream, ps, object);
       }
    }
    void unpack(NetConnection *ps, BitStream *bstream)
@@ -96,6 +99,7 @@ public:
          object->mNetFlags = NetObject::IsGhost;
          object->mNetIndex = ghostIndex;
          object->unpackUpdate(ps, bstream);
+         GhostSnapshot::readObject(bstream, ps, object);
          validObject = true;
       }
       else
@@ -122,6 +126,14 @@ ConsoleMethod( NetConnection, getGhostsActive, S32, 2, 2, "() Use the getGhostsA
     return object->getGhostsActive();
 }
 
+ConsoleMethod( NetConnection, setSnapshotUpdates, void, 3, 3, "( enabled ) Use the setSnapshotUpdates method to send object snapshots as deltas against the last snapshot the client acknowledged.\n"
+                                                                "This only affects objects that send snapshot fields, which otherwise send them in full with each update.\n"
+                                                                "@param enabled True to send snapshots against acknowledged baselines.\n"
+                                                                "@return No return value.")
+{
+    object->setSnapshotUpdates(dAtob(argv[2]));
+}
+
 void NetConnection::setGhostTo(bool ghostTo)
 {
    if(mLocalGhosts) // if ghosting to this is already enabled, silently return
@@ -130,8 +142,12 @@ void NetConnection::setGhostTo(bool ghostTo)
    if(ghostTo)
    {
       mLocalGhosts = new NetObject *[MaxGhostCount];
+      mLocalSnapshots = new GhostSnapshotHistory *[MaxGhostCount];
       for(S32 i = 0; i < MaxGhostCount; i++)
+      {
          mLocalGhosts[i] = NULL;
+         mLocalSnapshots[i] = NULL;
+      }
    }
 }
 
@@ -221,6 +237,7 @@ void NetConnection::ghostPacketDropped(PacketNotify *notify)
          packRef->ghost->flags &= ~GhostInfo::KillingGhost;
       }
 
+      GhostSnapshotBaseline::drop(packRef->snapshot);
       delete packRef;
       packRef = temp;
    }
@@ -247,6 +264,12 @@ void NetConnection::ghostPacketReceived(PacketNotify *notify)
 
       *walk = 0;
 
+      // the client now holds this snapshot, so later updates can be
+      // sent as deltas against it
+
+      if(packRef->snapshot)
+         packRef->ghost->snapshotBaseline.acknowledge(packRef->snapshot, packRef->snapshotSeq);
+
       // if this object was ghosting , it is now ghosted
 
       if(packRef->ghostInfoFlags & GhostInfo::Ghosting)
@@ -400,6 +423,7 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
 
       upd->ghost = walk;
       upd->ghostInfoFlags = 0;
+      upd->snapshot = NULL;
 
       if(walk->flags & GhostInfo::KillGhost)
       {
@@ -439,6 +463,9 @@ void NetConnection::ghostWritePacket(BitStream *bstream, PacketNotify *notify)
 
          AssertFatal((retMask & (~updateMask)) == 0, "Cannot set new bits in packUpdate return");
 
+         if(walk->obj->getSnapshotFieldCount())
+            ghostWriteSnapshot(bstream, walk, upd);
+
          walk->updateMask = retMask;
          if(!retMask)
             ghostPushToZero(walk);
@@ -491,12 +518,14 @@ void NetConnection::ghostReadPacket(BitStream *bstream)
          AssertFatal(mLocalGhosts[index] != NULL, "Error, NULL ghost encountered.");
          mLocalGhosts[index]->deleteObject();
          mLocalGhosts[index] = NULL;
+         clearLocalSnapshots(index);
       }
       else
       {
          if(!mLocalGhosts[index]) // it's a new ghost... cool
          {
             mGhostsActive++;
+            clearLocalSnapshots(index);
             S32 classId = bstream->readClassId(NetClassTypeObject, getNetClassGroup());
             if(classId == -1)
             {
@@ -526,6 +555,12 @@ void NetConnection::ghostReadPacket(BitStream *bstream)
 #endif
             mLocalGhosts[index]->unpackUpdate(this, bstream);
 
+            if(!ghostReadSnapshot(bstream, index))
+            {
+               setLastError("Invalid packet.");
+               return;
+            }
+
             if(!obj->registerObject())
             {
                if(!mErrorBuffer[0])
@@ -549,6 +584,12 @@ void NetConnection::ghostReadPacket(BitStream *bstream)
                   mLocalGhosts[index]->getClassName()) );
 #endif
             mLocalGhosts[index]->unpackUpdate(this, bstream);
+
+            if(!ghostReadSnapshot(bstream, index))
+            {
+               setLastError("Invalid packet.");
+               return;
+            }
          }
          //PacketStream::getStats()->addBits(PacketStats::Receive, bstream->getCurPos() - startPos, ghostRefs[index].localGhost->getPersistTag());
 #ifdef TORQUE_DEBUG_NET
@@ -623,6 +664,55 @@ void NetConnection::freeGhostInfo(GhostInfo *ghost)
    }
    ghostPushZeroToFree(ghost);
    AssertFatal(ghost->updateChain == NULL, "Ack!");
+
+   ghost->snapshotBaseline.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void NetConnection::ghostWriteSnapshot(BitStream *bstream, GhostInfo *ghost, GhostRef *update)
+{
+   const U32 count = ghost->obj->getSnapshotFieldCount();
+   AssertFatal(count <= GhostSnapshot::MaxFieldCount, "NetConnection::ghostWriteSnapshot - Too many snapshot fields.");
+
+   S32 fields[GhostSnapshot::MaxFieldCount];
+   ghost->obj->packSnapshot(this, fields);
+
+   // send against the acknowledged baseline if the client still holds it,
+   // otherwise send the whole snapshot, and keep the fields to become the
+   // baseline when this packet is acknowledged
+   if(!mSnapshotUpdates)
+      ghost->snapshotBaseline.clear();
+
+   update->snapshot = ghost->snapshotBaseline.write(bstream, fields, count, mLastSendSeq, mSnapshotUpdates);
+   update->snapshotSeq = mLastSendSeq;
+}
+
+bool NetConnection::ghostReadSnapshot(BitStream *bstream, U32 index)
+{
+   NetObject *obj = mLocalGhosts[index];
+   const U32 count = obj->getSnapshotFieldCount();
+   if(count == 0)
+      return true;
+   if(count > GhostSnapshot::MaxFieldCount)
+      return false;
+
+   if(!mLocalSnapshots[index])
+      mLocalSnapshots[index] = new GhostSnapshotHistory(count);
+
+   // the baseline is referenced by how many packets ago it was received
+   S32 fields[GhostSnapshot::MaxFieldCount];
+   if(!mLocalSnapshots[index]->readUpdate(bstream, mLastSeqRecvd, fields))
+      return false;
+
+   obj->unpackSnapshot(this, fields);
+   return true;
+}
+
+void NetConnection::clearLocalSnapshots(U32 index)
+{
+   delete mLocalSnapshots[index];
+   mLocalSnapshots[index] = NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -781,6 +871,7 @@ void NetConnection::handleConnectionMessage(U32 message, U32 sequence, U32 ghost
                mLocalGhosts[i]->deleteObject();
                mLocalGhosts[i] = NULL;
             }
+            clearLocalSnapshots(i);
          }
          while(mGhostAlwaysSaveList.size())
          {
@@ -1063,12 +1154,17 @@ void NetConnection::ghostWriteStartBlock(ResizeBitStream *stream)
 
    // then, for each ghost written into the start block, write the full pack update
    // into the start block.  For demos to work properly, packUpdate must
-   // be callable from client objects.
+   // be callable from client objects.  The same goes for packSnapshot, and the
+   // snapshots received so far are written too, since the recorded packets
+   // may send deltas against them.
    for(U32 i = 0; i < MaxGhostCount; i++)
    {
       if(mLocalGhosts[i])
       {
          mLocalGhosts[i]->packUpdate(this, 0xFFFFFFFF, stream);
+         GhostSnapshot::writeObject(stream, this, mLocalGhosts[i]);
+         if(stream->writeFlag(mLocalSnapshots[i] != NULL))
+            mLocalSnapshots[i]->write(stream);
          stream->validate();
       }
    }
@@ -1105,6 +1201,19 @@ void NetConnection::ghostReadStartBlock(BitStream *stream)
       if(mLocalGhosts[i])
       {
          mLocalGhosts[i]->unpackUpdate(this, stream);
+         GhostSnapshot::readObject(stream, this, mLocalGhosts[i]);
+         clearLocalSnapshots(i);
+         if(stream->readFlag())
+         {
+            const U32 count = mLocalGhosts[i]->getSnapshotFieldCount();
+            if(count == 0 || count > GhostSnapshot::MaxFieldCount)
+            {
+               setLastError("Invalid packet.");
+               return;
+            }
+            mLocalSnapshots[i] = new GhostSnapshotHistory(count);
+            mLocalSnapshots[i]->read(stream);
+         }
          if(!mLocalGhosts[i]->registerObject())
          {
             if(mErrorBuffer[0])
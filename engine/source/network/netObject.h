@@ -351,6 +351,36 @@ public:
    /// @param   stream  stream to read from
    virtual void unpackUpdate(NetConnection * conn, BitStream *stream);
 
+   /// @name Snapshot Updates
+   ///
+   /// Objects can send state that changes often, such as positions, as a snapshot of
+   /// quantized integer fields.  The snapshot is sent after packUpdate() each time the
+   /// object is updated, so the object should still set a mask bit when it changes.
+   /// On connections with snapshot updates enabled the fields are sent as deltas against
+   /// the last snapshot the client acknowledged, which is much smaller than sending the
+   /// fields at full precision.
+   ///
+   /// @see NetConnection::setSnapshotUpdates(), GhostSnapshot
+   /// @{
+
+   /// Get the number of snapshot fields this object sends, or zero if it does not
+   /// send a snapshot.  The count must be the same on the server and the client.
+   virtual U32 getSnapshotFieldCount() { return 0; }
+
+   /// Fill in the quantized snapshot fields for this object.
+   ///
+   /// @param   conn    Net connection being used
+   /// @param   fields  Storage for getSnapshotFieldCount() fields
+   virtual void packSnapshot(NetConnection * conn, S32 *fields) {}
+
+   /// Apply snapshot fields previously packed with packSnapshot.
+   ///
+   /// @param   conn    Net connection being used
+   /// @param   fields  The getSnapshotFieldCount() fields received
+   virtual void unpackSnapshot(NetConnection * conn, const S32 *fields) {}
+
+   /// @}
+
    /// Queries the object about information used to determine scope.
    ///
    /// Something that is 'in scope' is somehow interesting to the client.
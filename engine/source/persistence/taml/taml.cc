@@ -80,6 +80,9 @@
 // Debug Profiling.
 #include "debug/profiler.h"
 
+// Memory tracking.
+#include "memory/memoryTracker.h"
+
 //-----------------------------------------------------------------------------
 
 IMPLEMENT_CONOBJECT( Taml );
@@ -260,6 +263,8 @@ SimObject* Taml::read( const char* pFilename )
 
 bool Taml::write( FileStream& stream, SimObject* pSimObject, const TamlFormatMode formatMode )
 {
+    MEMORY_TAG_SCOPE(TagTaml);
+
     // Sanity!
     AssertFatal( pSimObject != NULL, "Cannot write a NULL object." );
 
@@ -305,6 +310,8 @@ bool Taml::write( FileStream& stream, SimObject* pSimObject, const TamlFormatMod
 
 SimObject* Taml::read( FileStream& stream, const TamlFormatMode formatMode )
 {
+    MEMORY_TAG_SCOPE(TagTaml);
+
     // Format appropriately.
     switch( formatMode )
     {
@@ -98,6 +98,31 @@ bool TamlXmlParser::parse( const char* pFilename, TamlXmlVisitor& visitor, const
 
 //-----------------------------------------------------------------------------
 
+bool TamlXmlParser::parse( const char* pFilename, TiXmlDocument& xmlDocument, TamlXmlVisitor& visitor )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlXmlParser_ParseDocument);
+
+    // Sanity!
+    AssertFatal( pFilename != NULL, "Cannot parse a NULL filename." );
+
+    char filenameBuffer[1024];
+    Con::expandPath( filenameBuffer, sizeof(filenameBuffer), pFilename );
+
+    // Set parsing filename.
+    mpParsingFilename = filenameBuffer;
+
+    // Parse root element.
+    parseElement( xmlDocument.RootElement(), visitor );
+
+    // Reset parsing filename.
+    mpParsingFilename = NULL;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
 bool TamlXmlParser::parseElement( TiXmlElement* pXmlElement, TamlXmlVisitor& visitor )
 {
     // Debug Profiling.
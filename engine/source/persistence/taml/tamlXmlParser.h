@@ -43,6 +43,9 @@ public:
     /// Parse.
     bool parse( const char* pFilename, TamlXmlVisitor& visitor, const bool writeDocument );
 
+    /// Parse an already loaded document.
+    bool parse( const char* pFilename, TiXmlDocument& xmlDocument, TamlXmlVisitor& visitor );
+
     /// Filename.
     inline const char* getParsingFilename( void ) const { return mpParsingFilename; }
 
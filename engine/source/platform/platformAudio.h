@@ -59,6 +59,7 @@ namespace Audio
    {
       F32  mVolume;    // 0-1    1=loudest volume
       S32  mVolumeChannel;
+      F32  mPriority;  // scales the audibility when competing for sources, 1=normal
       bool mIsLooping;
       bool mIsStreaming;
 
@@ -26,25 +26,38 @@
 #include "debug/profiler.h"
 #include "platform/threads/mutex.h"
 #include "math/mMath.h"
+#include "memory/memoryTracker.h"
 #include <stdlib.h>
 
 //-----------------------------------------------------------------------------
 
 void* dMalloc_r(dsize_t in_size, const char* fileName, const dsize_t line)
 {
+#ifdef TORQUE_TRACK_MEMORY
+   return Memory::trackedAlloc(in_size, fileName, (U32)line);
+#else
    return malloc(in_size);
+#endif
 }
 
 //-----------------------------------------------------------------------------
 
 void dFree(void* in_pFree)
 {
+#ifdef TORQUE_TRACK_MEMORY
+   Memory::trackedFree(in_pFree);
+#else
    free(in_pFree);
+#endif
 }
 
 //-----------------------------------------------------------------------------
 
 void* dRealloc_r(void* in_pResize, dsize_t in_size, const char* fileName, const dsize_t line)
 {
+#ifdef TORQUE_TRACK_MEMORY
+   return Memory::trackedRealloc(in_pResize, in_size, fileName, (U32)line);
+#else
    return realloc(in_pResize,in_size);
+#endif
 }
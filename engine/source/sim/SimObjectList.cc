@@ -21,33 +21,35 @@
 //-----------------------------------------------------------------------------
 
 #include "simObjectList.h"
-#include "collection/findIterator.h"
 #include "simObject.h"
 
 //-----------------------------------------------------------------------------
 
 void SimObjectList::pushBack(SimObject* obj)
 {
-   if (find(begin(),end(),obj) == end())
+   if (mIndex.find(obj) == mIndex.end())
+   {
+      mIndex.insert(obj, Parent::size() + mIndexBase);
       push_back(obj);
+   }
 }	
 
 //-----------------------------------------------------------------------------
 
 void SimObjectList::pushBackForce(SimObject* obj)
 {
-   iterator itr = find(begin(),end(),obj);
-   if (itr == end()) 
+   typeIndexHash::iterator itr = mIndex.find(obj);
+   if (itr == mIndex.end()) 
    {
+      mIndex.insert(obj, Parent::size() + mIndexBase);
       push_back(obj);
    }
-   else 
+   else if (itr->value - mIndexBase != (U32)(Parent::size() - 1))
    {
       // Move to the back...
       //
-      SimObject* pBack = *itr;
-      removeStable(pBack);
-      push_back(pBack);
+      removeStable(obj);
+      pushBack(obj);
    }
 }	
 
@@ -55,37 +57,196 @@ void SimObjectList::pushBackForce(SimObject* obj)
 
 void SimObjectList::pushFront(SimObject* obj)
 {
-   if (find(begin(),end(),obj) == end())
+   if (mIndex.find(obj) == mIndex.end())
+   {
+      // Every slot moves up one so rebase the index rather than refreshing it.
+      compact();
       push_front(obj);
+      mIndexBase--;
+      mIndex.insert(obj, mIndexBase);
+   }
 }	
 
 //-----------------------------------------------------------------------------
 
 void SimObjectList::remove(SimObject* obj)
 {
-   iterator ptr = find(begin(),end(),obj);
-   if (ptr != end()) 
-      erase(ptr);
+   removeStable(obj);
 }
 
 //-----------------------------------------------------------------------------
 
 void SimObjectList::removeStable(SimObject* obj)
 {
-   iterator ptr = find(begin(),end(),obj);
-   if (ptr != end()) 
-      erase(ptr);
+   typeIndexHash::iterator itr = mIndex.find(obj);
+   if (itr == mIndex.end())
+      return;
+
+   const S32 index = itr->value - mIndexBase;
+   mIndex.erase(itr);
+
+   // Removing the last slot needs no compaction.
+   if (index == Parent::size() - 1)
+   {
+      decrement();
+      trimBack();
+      return;
+   }
+
+   // Leave the slot empty until the list is next accessed.
+   Parent::operator[](index) = NULL;
+   if (mEmptySlots == 0 || index < mFirstEmptySlot)
+      mFirstEmptySlot = index;
+   mEmptySlots++;
+}
+
+//-----------------------------------------------------------------------------
+
+void SimObjectList::popBack()
+{
+   mIndex.erase(Parent::last());
+   decrement();
+   trimBack();
+}
+
+//-----------------------------------------------------------------------------
+
+void SimObjectList::clear()
+{
+   mIndex.clear();
+   Parent::clear();
+   mEmptySlots = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void SimObjectList::insertBefore(SimObject* obj, SimObject* target)
+{
+   AssertFatal(!contains(obj), "SimObjectList::insertBefore() - Object is already in the list.");
+
+   const S32 index = target ? getIndex(target) : -1;
+   if (index == -1)
+   {
+      pushBack(obj);
+      return;
+   }
+
+   insert(begin() + index, obj);
+   mIndex.insert(obj, index + mIndexBase);
+
+   // Refresh whichever side of the inserted slot is shorter.
+   if (index < Parent::size() - index - 1)
+   {
+      mIndexBase--;
+      reindex(0, index + 1);
+   }
+   else
+   {
+      reindex(index + 1, Parent::size());
+   }
+}
+
+//-----------------------------------------------------------------------------
+
+S32 SimObjectList::getIndex(SimObject* obj) const
+{
+   typeIndexHash::const_iterator itr = mIndex.find(obj);
+   if (itr == mIndex.end())
+      return -1;
+
+   compact();
+
+   const S32 index = itr->value - mIndexBase;
+   AssertFatal((*this)[index] == obj, "SimObjectList::getIndex() - Index is out of step with the list.");
+   return index;
+}
+
+//-----------------------------------------------------------------------------
+
+void SimObjectList::compact()
+{
+   if (mEmptySlots == 0)
+      return;
+
+   SimObject** list = Parent::address();
+   const S32 count = Parent::size();
+
+   // Find the last empty slot; the last slot is never empty.
+   S32 lastEmptySlot = count - 2;
+   while (list[lastEmptySlot] != NULL)
+      lastEmptySlot--;
+
+   // The slots after the last empty slot all move down by the number of empty slots
+   // so rebase the index if they outnumber the slots before the first empty slot.
+   const S32 tailStart = lastEmptySlot + 1;
+   const S32 tailCount = count - tailStart;
+   const bool rebase = tailCount > mFirstEmptySlot;
+   if (rebase)
+   {
+      mIndexBase += mEmptySlots;
+      reindex(0, mFirstEmptySlot);
+   }
+
+   // Pack the slots between the first and last empty slots.
+   S32 write = mFirstEmptySlot;
+   for (S32 read = mFirstEmptySlot + 1; read < lastEmptySlot; read++)
+   {
+      if (list[read] == NULL)
+         continue;
+
+      list[write] = list[read];
+      mIndex.find(list[write])->value = write + mIndexBase;
+      write++;
+   }
+
+   // Move the slots after the last empty slot down.
+   dMemmove(list + write, list + tailStart, tailCount * sizeof(SimObject*));
+   if (!rebase)
+      reindex(write, write + tailCount);
+
+   decrement(mEmptySlots);
+   mEmptySlots = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void SimObjectList::reindex(S32 start, S32 end)
+{
+   for (S32 i = start; i < end; i++)
+      mIndex.find(Parent::operator[](i))->value = i + mIndexBase;
+}
+
+//-----------------------------------------------------------------------------
+
+void SimObjectList::trimBack()
+{
+   while (mEmptySlots && Parent::last() == NULL)
+   {
+      decrement();
+      mEmptySlots--;
+   }
 }
 
 //-----------------------------------------------------------------------------
 
 void SimObjectList::sortId()
 {
+   compact();
    dQsort(address(),size(),sizeof(value_type),compareId);
+   reindex(0, size());
 }	
 
 //-----------------------------------------------------------------------------
 
+void SimObjectList::sort(S32 (QSORT_CALLBACK *compare)(const void*, const void*))
+{
+   compact();
+   dQsort(address(),size(),sizeof(value_type),compare);
+   reindex(0, size());
+}
+
+//-----------------------------------------------------------------------------
+
 S32 QSORT_CALLBACK SimObjectList::compareId(const void* a,const void* b)
 {
    return (*reinterpret_cast<const SimObject* const*>(a))->getId() -
@@ -27,28 +27,84 @@
 #include "collection/vector.h"
 #endif
 
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class SimObject;
 
 //-----------------------------------------------------------------------------
 
+/// A list of SimObject pointers that keeps an index from each object to its slot.
+///
+/// The index makes membership tests, duplicate checks on insertion and locating an
+/// object for removal constant time.  The list must be modified through the methods
+/// here rather than the inherited vector interface so that the index stays in step.
+///
+/// Removing an object leaves an empty slot which is compacted away the next time the
+/// list is accessed, so runs of removals cost a single pass.  The index holds each
+/// slot offset by a base so that compaction only has to re-index the objects on the
+/// shorter side of the removed slots; removing from either end re-indexes nothing.
 class SimObjectList : public VectorPtr<SimObject*>
 {
+   typedef VectorPtr<SimObject*> Parent;
+   typedef HashMap<SimObject*, U32> typeIndexHash;
+
    static S32 QSORT_CALLBACK compareId(const void* a,const void* b);
 
+   typeIndexHash mIndex;
+   U32 mIndexBase;                  ///< Subtracted from an indexed value to give the slot.
+   S32 mEmptySlots;                 ///< Number of removed slots awaiting compaction.
+   S32 mFirstEmptySlot;             ///< Lowest removed slot awaiting compaction.
+
+   void compact();                  ///< Remove any empty slots, preserving list order.
+   inline void compact() const { if (mEmptySlots) const_cast<SimObjectList*>(this)->compact(); }
+   void reindex(S32 start, S32 end);///< Refresh the index for the slots in the specified range.
+   void trimBack();                 ///< Remove any empty slots from the end of the list.
+
 public:
+   SimObjectList() : mIndexBase(0), mEmptySlots(0), mFirstEmptySlot(0) {}
+
+   /// @name Compacted vector interface
+   /// @{
+
+   inline S32 size() const { return Parent::size() - mEmptySlots; }
+   inline bool empty() const { return size() == 0; }
+   inline iterator begin() { compact(); return Parent::begin(); }
+   inline iterator end() { compact(); return Parent::end(); }
+   inline const_iterator begin() const { compact(); return Parent::begin(); }
+   inline const_iterator end() const { compact(); return Parent::end(); }
+   inline SimObject*& front() { compact(); return Parent::front(); }
+   inline SimObject*& first() { compact(); return Parent::first(); }
+   inline SimObject*& last() { compact(); return Parent::last(); }
+   inline SimObject*& operator[](U32 index) { compact(); return Parent::operator[](index); }
+   inline SimObject* const& operator[](U32 index) const { compact(); return Parent::operator[](index); }
+
+   /// @}
+
    void pushBack(SimObject*);       ///< Add the SimObject* to the end of the list, unless it's already in the list.
    void pushBackForce(SimObject*);  ///< Add the SimObject* to the end of the list, moving it there if it's already present in the list.
    void pushFront(SimObject*);      ///< Add the SimObject* to the start of the list.
-   void remove(SimObject*);         ///< Remove the SimObject* from the list; may disrupt order of the list.
+   void remove(SimObject*);         ///< Remove the SimObject* from the list; guaranteed to preserve list order.
+   void popBack();                  ///< Remove the last SimObject* from the list.
+   void clear();                    ///< Remove all the SimObject* from the list.
+
+   /// Insert the SimObject* before the target, or at the end of the list if the target isn't in the list.
+   void insertBefore(SimObject* pObject, SimObject* pTarget);
 
    inline SimObject* at(S32 index) const {  if(index >= 0 && index < size()) return (*this)[index]; return NULL; }
 
+   /// Get the slot of the SimObject* in the list or -1 if it's not in the list.
+   S32 getIndex(SimObject* pObject) const;
+   inline bool contains(SimObject* pObject) const { return getIndex(pObject) != -1; }
+
    /// Remove the SimObject* from the list; guaranteed to preserve list order.
    void removeStable(SimObject* pObject);
 
    void sortId();                   ///< Sort the list by object ID.
+   void sort(S32 (QSORT_CALLBACK *compare)(const void*, const void*)); ///< Sort the list with the specified comparison.
 };
 
 #endif // _SIM_OBJECT_LIST_H_
\ No newline at end of file
@@ -29,6 +29,7 @@
 //-----------------------------------------------------------------------------
 
 IMPLEMENT_CONOBJECT(ScriptObject);
+IMPLEMENT_CLASS_POOL(ScriptObject);
 
 //-----------------------------------------------------------------------------
 
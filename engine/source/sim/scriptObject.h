@@ -27,6 +27,10 @@
 #include "console/consoleInternal.h"
 #endif
 
+#ifndef _CLASS_POOL_H_
+#include "memory/classPool.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class ScriptObject : public SimObject
@@ -37,6 +41,7 @@ public:
    ScriptObject();
 
    DECLARE_CONOBJECT(ScriptObject);
+   DECLARE_CLASS_POOL(ScriptObject);
 };
 
 #endif // _SCRIPT_OBJECT_H_
\ No newline at end of file
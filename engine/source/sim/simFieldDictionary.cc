@@ -49,11 +49,33 @@ void SimFieldDictionary::freeEntry(SimFieldDictionary::Entry *ent)
    mFreeList = ent;
 }
 
+void SimFieldDictionary::setEntryValue(SimFieldDictionary::Entry *entry, const char *value)
+{
+   const U32 valueSize = dStrlen(value) + 1;
+   const U32 capacity = entry->valueCapacity ? entry->valueCapacity : InlineValueSize;
+
+   // Only reallocate when the value no longer fits.
+   if(valueSize > capacity)
+   {
+      if(entry->valueCapacity)
+         dFree(entry->value);
+
+      entry->value = (char *)dMalloc(valueSize);
+      entry->valueCapacity = valueSize;
+   }
+
+   // The value may be (part of) the current value.
+   dMemmove(entry->value, value, valueSize);
+}
+
 SimFieldDictionary::SimFieldDictionary()
 {
    for(U32 i = 0; i < HashTableSize; i++)
       mHashTable[i] = 0;
 
+   mIndex = NULL;
+   mIndexSize = 0;
+   mCount = 0;
    mVersion = 0;
 }
 
@@ -66,28 +88,91 @@ SimFieldDictionary::~SimFieldDictionary()
          Entry *temp = walk;
          walk = temp->next;
 
-         dFree(temp->value);
+         if(temp->valueCapacity)
+            dFree(temp->value);
          freeEntry(temp);
       }
    }
+
+   if(mIndex)
+      dFree(mIndex);
 }
 
-void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *value)
+SimFieldDictionary::Entry **SimFieldDictionary::findIndexSlot(StringTableEntry slotName) const
 {
-   U32 bucket = HashPointer(slotName) % HashTableSize;
-   Entry **walk = &mHashTable[bucket];
-   while(*walk && (*walk)->slotName != slotName)
-      walk = &((*walk)->next);
+   // Linear probing.  The index is never more than half full so this always
+   // finishes on either the entry or an empty slot.
+   const U32 mask = mIndexSize - 1;
+   U32 slot = U32(HashPointer(slotName)) & mask;
+   while(mIndex[slot] && mIndex[slot]->slotName != slotName)
+      slot = (slot + 1) & mask;
+
+   return &mIndex[slot];
+}
+
+void SimFieldDictionary::resizeIndex(U32 newSize)
+{
+   if(mIndex)
+      dFree(mIndex);
+
+   mIndexSize = newSize;
+   mIndex = (Entry **)dMalloc(sizeof(Entry *) * mIndexSize);
+   dMemset(mIndex, 0, sizeof(Entry *) * mIndexSize);
 
-   Entry *field = *walk;
+   for(U32 i = 0; i < HashTableSize; i++)
+      for(Entry *walk = mHashTable[i]; walk; walk = walk->next)
+         *findIndexSlot(walk->slotName) = walk;
+}
+
+void SimFieldDictionary::addToIndex(SimFieldDictionary::Entry *entry)
+{
+   // Keep the index at most half full.
+   if((mCount + 1) * 2 > mIndexSize)
+      resizeIndex(mIndexSize ? mIndexSize * 2 : (U32)MinIndexSize);
+
+   *findIndexSlot(entry->slotName) = entry;
+}
+
+void SimFieldDictionary::removeFromIndex(SimFieldDictionary::Entry *entry)
+{
+   const U32 mask = mIndexSize - 1;
+   U32 slot = (U32)(findIndexSlot(entry->slotName) - mIndex);
+   mIndex[slot] = NULL;
+
+   // Move back any following entries that could no longer be found
+   // past the empty slot.
+   for(U32 next = (slot + 1) & mask; mIndex[next]; next = (next + 1) & mask)
+   {
+      const U32 home = U32(HashPointer(mIndex[next]->slotName)) & mask;
+      if(((next - home) & mask) >= ((next - slot) & mask))
+      {
+         mIndex[slot] = mIndex[next];
+         mIndex[next] = NULL;
+         slot = next;
+      }
+   }
+}
+
+void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *value)
+{
+   Entry *field = mIndex ? *findIndexSlot(slotName) : NULL;
    if(!*value)
    {
       if(field)
       {
          mVersion++;
 
-         dFree(field->value);
+         U32 bucket = HashPointer(slotName) % HashTableSize;
+         Entry **walk = &mHashTable[bucket];
+         while(*walk != field)
+            walk = &((*walk)->next);
          *walk = field->next;
+
+         removeFromIndex(field);
+         mCount--;
+
+         if(field->valueCapacity)
+            dFree(field->value);
          freeEntry(field);
       }
    }
@@ -95,31 +180,39 @@ void SimFieldDictionary::setFieldValue(StringTableEntry slotName, const char *va
    {
       if(field)
       {
-         dFree(field->value);
-         field->value = dStrdup(value);
+         setEntryValue(field, value);
       }
       else
       {
          mVersion++;
 
          field = allocEntry();
-         field->value = dStrdup(value);
          field->slotName = slotName;
          field->next = NULL;
+         field->value = field->inlineValue;
+         field->valueCapacity = 0;
+         setEntryValue(field, value);
+
+         // New fields go at the end of their bucket.
+         U32 bucket = HashPointer(slotName) % HashTableSize;
+         Entry **walk = &mHashTable[bucket];
+         while(*walk)
+            walk = &((*walk)->next);
          *walk = field;
+
+         addToIndex(field);
+         mCount++;
       }
    }
 }
 
 const char *SimFieldDictionary::getFieldValue(StringTableEntry slotName)
 {
-   U32 bucket = HashPointer(slotName) % HashTableSize;
-
-   for(Entry *walk = mHashTable[bucket];walk;walk = walk->next)
-      if(walk->slotName == slotName)
-         return walk->value;
+   if(!mIndex)
+      return NULL;
 
-   return NULL;
+   Entry *field = *findIndexSlot(slotName);
+   return field ? field->value : NULL;
 }
 
 
@@ -40,23 +40,51 @@ class SimFieldDictionary
    friend class SimFieldDictionaryIterator;
 
   public:
+   enum
+   {
+      HashTableSize = 19,
+
+      /// Values up to this size (including the terminator) are stored in the entry itself.
+      InlineValueSize = 24,
+
+      /// Initial number of slots in the lookup index.
+      MinIndexSize = 16
+   };
+
    struct Entry
    {
       StringTableEntry slotName;
       char *value;
       Entry *next;
+
+      /// Size of the heap allocated value buffer or zero when the value is inline.
+      U32 valueCapacity;
+      char inlineValue[InlineValueSize];
    };
-   enum
-   {
-      HashTableSize = 19
-   };
+
+   /// The entries chained by bucket.  This defines the iteration order.
    Entry *mHashTable[HashTableSize];
+
   private:
 
    static Entry *mFreeList;
    static void freeEntry(Entry *entry);
    static Entry *allocEntry();
 
+   /// Sets the value of an entry reusing its storage where possible.
+   static void setEntryValue(Entry *entry, const char *value);
+
+   /// An open-addressed index of the entries used for lookups.
+   /// It's a power of two in size and is allocated with the first entry.
+   Entry **mIndex;
+   U32 mIndexSize;
+   U32 mCount;
+
+   Entry **findIndexSlot(StringTableEntry slotName) const;
+   void addToIndex(Entry *entry);
+   void removeFromIndex(Entry *entry);
+   void resizeIndex(U32 newSize);
+
    /// In order to efficiently detect when a dynamic field has been
    /// added or deleted, we increment this every time we add or
    /// remove a field.
@@ -64,6 +92,7 @@ class SimFieldDictionary
 
 public:
    const U32 getVersion() const { return mVersion; }
+   U32 getFieldCount() const { return mCount; }
 
    SimFieldDictionary();
    ~SimFieldDictionary();
@@ -420,6 +420,6 @@ void SimDataBlockGroup::sort()
    if(mLastModifiedKey != SimDataBlock::getNextModifiedKey())
    {
       mLastModifiedKey = SimDataBlock::getNextModifiedKey();
-        dQsort(objectList.address(),objectList.size(),sizeof(SimObject *),compareModifiedKey);
+        objectList.sort(compareModifiedKey);
    }
 }
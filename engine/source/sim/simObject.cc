@@ -33,6 +33,7 @@
 //-----------------------------------------------------------------------------
 
 IMPLEMENT_CONOBJECT(SimObject);
+IMPLEMENT_CLASS_POOL(SimObjectTimerEvent);
 
 namespace Sim
 {
@@ -250,6 +251,44 @@ void SimObject::assignDynamicFieldsFrom(SimObject* parent)
    }
 }
 
+//-----------------------------------------------------------------------------
+
+static void setStaticFieldData( SimObject* pObject, const AbstractClassRep::Field* pField, const S32 arrayIndex, const char* pValue )
+{
+   void* pFieldData = (void*)(((const char*)pObject) + pField->offset);
+
+   // Unprotected fields have nothing to notify so set the data directly.
+   if( pField->setDataFn == &defaultProtectedSetFn )
+   {
+      Con::setData( pField->type, pFieldData, arrayIndex, 1, &pValue, pField->table );
+      return;
+   }
+
+   ConsoleBaseType *cbt = ConsoleBaseType::getType( pField->type );
+   AssertFatal( cbt != NULL, "Could not resolve Type Id." );
+
+   FrameAllocatorMarker frameMarker;
+
+   // Prepare the data.
+   char* pPrepBuffer = (char*)frameMarker.alloc( 2048 );
+   const char* pPrepData = cbt->prepData( pValue, pPrepBuffer, 2048 );
+
+   // Make a copy of the prepared data so that if the set notify callback or any
+   // other function uses the string stack, the data is not corrupted.
+   const U32 prepLength = dStrlen( pPrepData ) + 1;
+   char* pSecureData = (char*)frameMarker.alloc( prepLength );
+   dMemcpy( pSecureData, pPrepData, prepLength );
+
+   // If the set data notify callback returns true, then go ahead and
+   // set the data, otherwise, assume the set notify callback has either
+   // already set the data, or has deemed that the data should not
+   // be set at all.
+   if( (*pField->setDataFn)( pObject, pSecureData ) )
+      Con::setData( pField->type, pFieldData, arrayIndex, 1, &pValue, pField->table );
+}
+
+//-----------------------------------------------------------------------------
+
 void SimObject::assignFieldsFrom(SimObject *parent)
 {
    // only allow field assigns from objects of the same class:
@@ -268,19 +307,7 @@ void SimObject::assignFieldsFrom(SimObject *parent)
             //if(fieldVal)
             //   Con::setData(f->type, (void *) (((const char *)this) + f->offset), j, 1, &fieldVal, f->table);
             if(fieldVal)
-            {
-               // code copied from SimObject::setDataField().
-               // TODO: paxorr: abstract this into a better setData / getData that considers prot fields.
-               FrameTemp<char> buffer(2048);
-               FrameTemp<char> bufferSecure(2048); // This buffer is used to make a copy of the data 
-               ConsoleBaseType *cbt = ConsoleBaseType::getType( f->type );
-               const char* szBuffer = cbt->prepData( fieldVal, buffer, 2048 );
-               dMemset( bufferSecure, 0, 2048 );
-               dMemcpy( bufferSecure, szBuffer, dStrlen( szBuffer ) );
-
-               if((*f->setDataFn)( this, bufferSecure ) )
-                  Con::setData(f->type, (void *) (((const char *)this) + f->offset), j, 1, &fieldVal, f->table);
-            }
+               setStaticFieldData( this, f, j, fieldVal );
          }
       }
    }
@@ -636,12 +663,8 @@ static S32 QSORT_CALLBACK compareFields(const void* a,const void* b)
 
 ConsoleMethod(SimObject, getDynamicFieldCount, S32, 2, 2, "obj.getDynamicFieldCount()")
 {
-   S32 count = 0;
    SimFieldDictionary* fieldDictionary = object->getFieldDictionary();
-   for (SimFieldDictionaryIterator itr(fieldDictionary); *itr; ++itr)
-      count++;
-
-   return count;
+   return fieldDictionary ? fieldDictionary->getFieldCount() : 0;
 }
 
 ConsoleMethod(SimObject, getDynamicField, const char*, 3, 3, "obj.getDynamicField(index)")
@@ -830,24 +853,7 @@ void SimObject::setDataField(StringTableEntry slotName, const char *array, const
 
          if(array1 >= 0 && array1 < fld->elementCount && fld->elementCount >= 1)
          {
-            // If the set data notify callback returns true, then go ahead and
-            // set the data, otherwise, assume the set notify callback has either
-            // already set the data, or has deemed that the data should not
-            // be set at all.
-            FrameTemp<char> buffer(2048);
-            FrameTemp<char> bufferSecure(2048); // This buffer is used to make a copy of the data 
-            // so that if the prep functions or any other functions use the string stack, the data
-            // is not corrupted.
-
-            ConsoleBaseType *cbt = ConsoleBaseType::getType( fld->type );
-            AssertFatal( cbt != NULL, "Could not resolve Type Id." );
-
-            const char* szBuffer = cbt->prepData( value, buffer, 2048 );
-            dMemset( bufferSecure, 0, 2048 );
-            dMemcpy( bufferSecure, szBuffer, dStrlen( szBuffer ) );
-
-            if( (*fld->setDataFn)( this, bufferSecure ) )
-               Con::setData(fld->type, (void *) (((const char *)this) + fld->offset), array1, 1, &value, fld->table);
+            setStaticFieldData( this, fld, array1, value );
 
             onStaticModified( slotName, value );
 
@@ -1294,18 +1300,39 @@ void SimObject::freeNotify(SimObject::Notify* note)
 
 //------------------------------------------------------------------------------
 
+void SimObject::linkNotify(SimObject::Notify* note)
+{
+   note->prev = NULL;
+   note->next = mNotifyList;
+   if(mNotifyList)
+      mNotifyList->prev = note;
+   mNotifyList = note;
+}
+
+void SimObject::unlinkNotify(SimObject::Notify* note)
+{
+   if(note->prev)
+      note->prev->next = note->next;
+   else
+      mNotifyList = note->next;
+
+   if(note->next)
+      note->next->prev = note->prev;
+
+   note->next = note->prev = NULL;
+}
+
+//------------------------------------------------------------------------------
+
 SimObject::Notify* SimObject::removeNotify(void *ptr, SimObject::Notify::Type type)
 {
-   Notify **list = &mNotifyList;
-   while(*list)
+   for(Notify *note = mNotifyList; note; note = note->next)
    {
-      if((*list)->ptr == ptr && (*list)->type == type)
+      if(note->ptr == ptr && note->type == type)
       {
-         SimObject::Notify *ret = *list;
-         *list = ret->next;
-         return ret;
+         unlinkNotify(note);
+         return note;
       }
-      list = &((*list)->next);
    }
    return NULL;
 }
@@ -1314,29 +1341,28 @@ void SimObject::deleteNotify(SimObject* obj)
 {
    AssertFatal(!obj->isDeleted(),
                "SimManager::deleteNotify: Object is being deleted");
-   Notify *note = allocNotify();
-   note->ptr = (void *) this;
-   note->next = obj->mNotifyList;
-   note->type = Notify::DeleteNotify;
-   obj->mNotifyList = note;
+   Notify *deleteNote = allocNotify();
+   deleteNote->ptr = (void *) this;
+   deleteNote->type = Notify::DeleteNotify;
+   obj->linkNotify(deleteNote);
 
-   note = allocNotify();
-   note->ptr = (void *) obj;
-   note->next = mNotifyList;
-   note->type = Notify::ClearNotify;
-   mNotifyList = note;
+   Notify *clearNote = allocNotify();
+   clearNote->ptr = (void *) obj;
+   clearNote->type = Notify::ClearNotify;
+   linkNotify(clearNote);
 
-   //obj->deleteNotifyList.pushBack(this);
-   //clearNotifyList.pushBack(obj);
+   // Pair the notifications so either can be removed without searching for the other.
+   deleteNote->partner = clearNote;
+   clearNote->partner = deleteNote;
 }
 
 void SimObject::registerReference(SimObject **ptr)
 {
    Notify *note = allocNotify();
    note->ptr = (void *) ptr;
-   note->next = mNotifyList;
    note->type = Notify::ObjectRef;
-   mNotifyList = note;
+   note->partner = NULL;
+   linkNotify(note);
 }
 
 void SimObject::unregisterReference(SimObject **ptr)
@@ -1348,13 +1374,15 @@ void SimObject::unregisterReference(SimObject **ptr)
 
 void SimObject::clearNotify(SimObject* obj)
 {
+   // Search the list of the watched object as it is typically much shorter than ours
+   // (a set holds a clear notification for every member) then drop the paired one.
    Notify *note = obj->removeNotify((void *) this, Notify::DeleteNotify);
    if(note)
+   {
+      unlinkNotify(note->partner);
+      freeNotify(note->partner);
       freeNotify(note);
-
-   note = removeNotify((void *) obj, Notify::ClearNotify);
-   if(note)
-      freeNotify(note);
+   }
 }
 
 void SimObject::processDeleteNotifies()
@@ -1365,14 +1393,15 @@ void SimObject::processDeleteNotifies()
    while(mNotifyList)
    {
       Notify *note = mNotifyList;
-      mNotifyList = note->next;
+      unlinkNotify(note);
 
       AssertFatal(note->type != Notify::ClearNotify, "Clear notes should be all gone.");
 
       if(note->type == Notify::DeleteNotify)
       {
          SimObject *obj = (SimObject *) note->ptr;
-         Notify *cnote = obj->removeNotify((void *)this, Notify::ClearNotify);
+         Notify *cnote = note->partner;
+         obj->unlinkNotify(cnote);
          obj->onDeleteNotify(this);
          freeNotify(cnote);
       }
@@ -1387,18 +1416,17 @@ void SimObject::processDeleteNotifies()
 
 void SimObject::clearAllNotifications()
 {
-   for(Notify **cnote = &mNotifyList; *cnote; )
+   for(Notify *cnote = mNotifyList; cnote; )
    {
-      Notify *temp = *cnote;
+      Notify *temp = cnote;
+      cnote = temp->next;
       if(temp->type == Notify::ClearNotify)
       {
-         *cnote = temp->next;
-         Notify *note = ((SimObject *) temp->ptr)->removeNotify((void *) this, Notify::DeleteNotify);
+         unlinkNotify(temp);
+         ((SimObject *) temp->ptr)->unlinkNotify(temp->partner);
+         freeNotify(temp->partner);
          freeNotify(temp);
-         freeNotify(note);
       }
-      else
-         cnote = &(temp->next);
    }
 }
 
@@ -263,6 +263,8 @@ public:
         } type;
         void *ptr;        ///< Data (typically referencing or interested object).
         Notify *next;     ///< Next notification in the linked list.
+        Notify *prev;     ///< Previous notification in the linked list.
+        Notify *partner;  ///< The matching clear/delete notification on the other object, if any.
     };
 
     /// @}
@@ -311,6 +313,9 @@ protected:
     static SimObject::Notify *allocNotify();     ///< Get a free Notify structure.
     static void freeNotify(SimObject::Notify*);  ///< Mark a Notify structure as free.
 
+    void linkNotify(SimObject::Notify*);         ///< Add a Notify structure to the front of the list.
+    void unlinkNotify(SimObject::Notify*);       ///< Remove a Notify structure from the list.
+
     /// @}
 
     private:
@@ -27,6 +27,10 @@
 #include "sim/simBase.h"
 #endif
 
+#ifndef _CLASS_POOL_H_
+#include "memory/classPool.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 class SimObjectTimerEvent : public SimEvent
@@ -59,6 +63,9 @@ public:
         Con::executef( object, 1, mCallbackFunction );
     }
 
+    /// Timer events are posted every period so are pooled.
+    DECLARE_CLASS_POOL( SimObjectTimerEvent );
+
 private:
     StringTableEntry mCallbackFunction;
     U32 mPeriod;
@@ -110,8 +110,8 @@ bool SimSet::reOrder( SimObject *obj, SimObject *target )
    MutexHandle handle;
    handle.lock(mMutex);
 
-   iterator itrS, itrD;
-   if ( (itrS = find(begin(),end(),obj)) == end() )
+   const S32 indexS = objectList.getIndex(obj);
+   if ( indexS == -1 )
    {
       return false;  // object must be in list
    }
@@ -123,22 +123,15 @@ bool SimSet::reOrder( SimObject *obj, SimObject *target )
 
    if ( !target )    // if no target, then put to back of list
    {
-      if ( itrS != (end()-1) )      // don't move if already last object
-      {
-         objectList.erase(itrS);    // remove object from its current location
-         objectList.push_back(obj); // push it to the back of the list
-      }
+      objectList.pushBackForce(obj); // push it to the back of the list
    }
    else              // if target, insert object in front of target
    {
-      if ( (itrD = find(begin(),end(),target)) == end() )
+      if ( !objectList.contains(target) )
          return false;              // target must be in list
 
-      objectList.erase(itrS);
-
-      //Tinman - once itrS has been erased, itrD won't be pointing at the same place anymore - re-find...
-      itrD = find(begin(),end(),target);
-      objectList.insert(itrD,obj);
+      objectList.removeStable(obj);
+      objectList.insertBefore(obj,target);
    }
 
    return true;
@@ -209,7 +202,7 @@ void SimSet::deleteObjects( void )
     lock();
         while(size() > 0 )
         {
-            objectList[0]->deleteObject();
+            objectList.last()->deleteObject();
         }
     unlock();
 }
@@ -331,7 +324,7 @@ SimGroup::~SimGroup()
    while (!objectList.empty()) 
    {
       delete objectList.last();
-      objectList.decrement();
+      objectList.popBack();
    }
 
    unlock();
@@ -359,7 +352,7 @@ void SimGroup::addObject(SimObject* obj)
          obj->mGroup->removeObject(obj);
       nameDictionary.insert(obj);
       obj->mGroup = this;
-      objectList.push_back(obj); // force it into the object list
+      objectList.pushBack(obj); // force it into the object list
       // doesn't get a delete notify
       obj->onGroupAdd();
    }
@@ -596,17 +589,10 @@ ConsoleMethod(SimSet, isMember, bool, 3, 3, "(object) @return Returns true if sp
    }
 
    object->lock();
-   for(SimSet::iterator i = object->begin(); i != object->end(); i++)
-   {
-      if(*i == testObject)
-      {
-         object->unlock();
-         return true;
-      }
-   }
+   const bool isMember = object->contains(testObject);
    object->unlock();
 
-   return false;
+   return isMember;
 }
 
 ConsoleMethod( SimSet, findObjectByInternalName, S32, 3, 4, "(string name, [bool searchChildren]) Returns the object with given internal name\n"
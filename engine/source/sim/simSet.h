@@ -138,7 +138,8 @@ public:
    value operator[] (S32 index) { return objectList[U32(index)]; }
 
    inline iterator find( iterator first, iterator last, SimObject *obj ) { return ::find(first, last, obj); }
-   inline iterator find( SimObject *obj ) { return ::find(begin(), end(), obj); }
+   inline iterator find( SimObject *obj ) { const S32 index = objectList.getIndex(obj); return index == -1 ? end() : begin() + index; }
+   inline bool contains( SimObject *obj ) const { return objectList.contains(obj); }
 
    template <typename T> inline bool containsType( void )
    {
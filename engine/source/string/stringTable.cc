@@ -80,13 +80,21 @@ U32 _StringTable::hashStringn(const char* str, S32 len)
 //--------------------------------------
 _StringTable::_StringTable()
 {
-   buckets = (Node **) dMalloc(csm_stInitSize * sizeof(Node *));
-   for(U32 i = 0; i < csm_stInitSize; i++) {
-      buckets[i] = 0;
-   }
+   // Initialize the hash table now rather than racing to do it on
+   // first use from several threads.
+   if (sgInitTable)
+      initTolowerTable();
+
+   for(U32 i = 0; i < ShardCount; i++) {
+      Shard& shard = mShards[i];
+      shard.buckets = (Node **) dMalloc(csm_stInitSize * sizeof(Node *));
+      for(U32 j = 0; j < csm_stInitSize; j++) {
+         shard.buckets[j] = 0;
+      }
 
-   numBuckets = csm_stInitSize;
-   itemCount = 0;
+      shard.numBuckets = csm_stInitSize;
+      shard.itemCount = 0;
+   }
 
    // Insert empty string.
    EmptyString = insert("");
@@ -95,7 +103,8 @@ _StringTable::_StringTable()
 //--------------------------------------
 _StringTable::~_StringTable()
 {
-   dFree(buckets);
+   for(U32 i = 0; i < ShardCount; i++)
+      dFree(mShards[i].buckets);
 }
 
 
@@ -117,36 +126,53 @@ void _StringTable::destroy()
    _gStringTable = NULL;
 }
 
+//--------------------------------------
+_StringTable::Node* _StringTable::findNode(Shard& shard, const char* val, const U32 hash, const bool caseSens)
+{
+   // Only strings with the same hash need comparing.
+   for(Node *walk = shard.buckets[hash % shard.numBuckets]; walk != NULL; walk = walk->next) {
+      if(walk->hash != hash)
+         continue;
+      if(caseSens && !dStrcmp(walk->val, val))
+         return walk;
+      else if(!caseSens && !dStricmp(walk->val, val))
+         return walk;
+   }
+   return NULL;
+}
+
 //--------------------------------------
 StringTableEntry _StringTable::insert(const char* val, const bool  caseSens)
 {
    if ( val == NULL )
        return StringTable->EmptyString;
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
+   const U32 key = hashString(val);
+   Shard& shard = getShard(key);
 
-   Node **walk, *temp;
-   U32 key = hashString(val);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL)   {
-      if(caseSens && !dStrcmp(temp->val, val))
-         return temp->val;
-      else if(!caseSens && !dStricmp(temp->val, val))
-         return temp->val;
-      walk = &(temp->next);
-   }
-   char *ret = 0;
-   if(!*walk) {
-      *walk = (Node *) mempool.alloc(sizeof(Node));
-      (*walk)->next = 0;
-      (*walk)->val = (char *) mempool.alloc(dStrlen(val) + 1);
-      dStrcpy((*walk)->val, val);
-      ret = (*walk)->val;
-      itemCount ++;
-   }
-   if(itemCount > 2 * numBuckets) {
-      resize(4 * numBuckets - 1);
+   MutexHandle mutex;
+   mutex.lock(&shard.mMutex, true);
+
+   Node *found = findNode(shard, val, key, caseSens);
+   if(found)
+      return found->val;
+
+   // New strings go at the end of the bucket list so that case sens
+   // strings are always after their corresponding case insens strings.
+   Node **walk = &shard.buckets[key % shard.numBuckets];
+   while(*walk)
+      walk = &((*walk)->next);
+
+   *walk = (Node *) shard.mempool.alloc(sizeof(Node));
+   (*walk)->next = 0;
+   (*walk)->hash = key;
+   (*walk)->val = (char *) shard.mempool.alloc(dStrlen(val) + 1);
+   dStrcpy((*walk)->val, val);
+   char *ret = (*walk)->val;
+   shard.itemCount ++;
+
+   if(shard.itemCount > 2 * shard.numBuckets) {
+      resizeShard(shard, 4 * shard.numBuckets - 1);
    }
    return ret;
 }
@@ -157,9 +183,6 @@ StringTableEntry _StringTable::insertn(const char* src, S32 len, const bool  cas
    if ( src == NULL )
        return StringTable->EmptyString;
 
-   MutexHandle mutex;
-   mutex.lock(&mMutex, true);
-
    char val[1024];
    AssertFatal(len < sizeof(val), "Invalid string to insertn");
    dStrncpy(val, src, len);
@@ -173,20 +196,14 @@ StringTableEntry _StringTable::lookup(const char* val, const bool  caseSens)
    if ( val == NULL )
        return StringTable->EmptyString;
 
+   const U32 key = hashString(val);
+   Shard& shard = getShard(key);
+
    MutexHandle mutex;
-   mutex.lock(&mMutex, true);
+   mutex.lock(&shard.mMutex, true);
 
-   Node **walk, *temp;
-   U32 key = hashString(val);
-   walk = &buckets[key % numBuckets];
-   while((temp = *walk) != NULL)   {
-      if(caseSens && !dStrcmp(temp->val, val))
-            return temp->val;
-      else if(!caseSens && !dStricmp(temp->val, val))
-         return temp->val;
-      walk = &(temp->next);
-   }
-   return NULL;
+   Node *found = findNode(shard, val, key, caseSens);
+   return found ? found->val : NULL;
 }
 
 //--------------------------------------
@@ -195,14 +212,21 @@ StringTableEntry _StringTable::lookupn(const char* val, S32 len, const bool  cas
    if ( val == NULL )
        return StringTable->EmptyString;
 
+   const U32 key = hashStringn(val, len);
+   Shard& shard = getShard(key);
+
+   MutexHandle mutex;
+   mutex.lock(&shard.mMutex, true);
+
    Node **walk, *temp;
-   U32 key = hashStringn(val, len);
-   walk = &buckets[key % numBuckets];
+   walk = &shard.buckets[key % shard.numBuckets];
    while((temp = *walk) != NULL) {
-      if(caseSens && !dStrncmp(temp->val, val, len) && temp->val[len] == 0)
-         return temp->val;
-      else if(!caseSens && !dStrnicmp(temp->val, val, len) && temp->val[len] == 0)
-         return temp->val;
+      if(temp->hash == key) {
+         if(caseSens && !dStrncmp(temp->val, val, len) && temp->val[len] == 0)
+            return temp->val;
+         else if(!caseSens && !dStrnicmp(temp->val, val, len) && temp->val[len] == 0)
+            return temp->val;
+      }
       walk = &(temp->next);
    }
    return NULL;
@@ -210,6 +234,19 @@ StringTableEntry _StringTable::lookupn(const char* val, S32 len, const bool  cas
 
 //--------------------------------------
 void _StringTable::resize(const U32 newSize)
+{
+   // Spread the requested size over the shards.
+   const U32 shardSize = getMax(newSize / ShardCount, csm_stInitSize);
+
+   for(U32 i = 0; i < ShardCount; i++) {
+      MutexHandle mutex;
+      mutex.lock(&mShards[i].mMutex, true);
+      resizeShard(mShards[i], shardSize);
+   }
+}
+
+//--------------------------------------
+void _StringTable::resizeShard(Shard& shard, const U32 newSize)
 {
    Node *head = NULL, *walk, *temp;
    U32 i;
@@ -218,8 +255,8 @@ void _StringTable::resize(const U32 newSize)
    // lists so that case sens strings are always after their
    // corresponding case insens strings
 
-   for(i = 0; i < numBuckets; i++) {
-      walk = buckets[i];
+   for(i = 0; i < shard.numBuckets; i++) {
+      walk = shard.buckets[i];
       while(walk)
       {
          temp = walk->next;
@@ -228,20 +265,17 @@ void _StringTable::resize(const U32 newSize)
          walk = temp;
       }
    }
-   buckets = (Node **) dRealloc(buckets, newSize * sizeof(Node));
+   shard.buckets = (Node **) dRealloc(shard.buckets, newSize * sizeof(Node *));
    for(i = 0; i < newSize; i++) {
-      buckets[i] = 0;
+      shard.buckets[i] = 0;
    }
-   numBuckets = newSize;
+   shard.numBuckets = newSize;
    walk = head;
    while(walk) {
-      U32 key;
       Node *temp = walk;
 
       walk = walk->next;
-      key = hashString(temp->val);
-      temp->next = buckets[key % newSize];
-      buckets[key % newSize] = temp;
+      temp->next = shard.buckets[temp->hash % newSize];
+      shard.buckets[temp->hash % newSize] = temp;
    }
 }
-
@@ -86,14 +86,41 @@ private:
    {
       char *val;
       Node *next;
+
+      /// The (case-insensitive) hash of the string.
+      U32 hash;
+   };
+
+   /// The table is split into shards, each with its own lock, so that
+   /// threads interning different strings rarely contend.
+   struct Shard
+   {
+      Node**      buckets;
+      U32         numBuckets;
+      U32         itemCount;
+      DataChunker mempool;
+
+      Mutex mMutex;
    };
 
-   Node**      buckets;
-   U32         numBuckets;
-   U32         itemCount;
-   DataChunker mempool;
+   enum
+   {
+      ShardCount = 16
+   };
+
+   Shard mShards[ShardCount];
+
+   /// Gets the shard for a string hash.
+   inline Shard& getShard(const U32 hash)
+   {
+      return mShards[(hash ^ (hash >> 8) ^ (hash >> 16)) & (ShardCount - 1)];
+   }
+
+   /// Finds a string in a shard, which must be locked.
+   static Node* findNode(Shard& shard, const char* val, const U32 hash, const bool caseSens);
 
-   Mutex mMutex;
+   /// Resizes a shard, which must be locked.
+   static void resizeShard(Shard& shard, const U32 newSize);
 
   protected:
    static const U32 csm_stInitSize;
@@ -0,0 +1,187 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _AUDIO_VIRTUAL_VOICE_H_
+#include "audio/audioVirtualVoice.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define AUDIO_UNITTEST_VIRTUALVOICE_COUNT       4000
+#define AUDIO_UNITTEST_VIRTUALVOICE_DURATION    2000
+
+//-----------------------------------------------------------------------------
+
+// Sets up a playing one-shot voice without a buffer.
+static AudioVirtualVoice* createVoice( AudioVirtualVoiceList& list, const AUDIOHANDLE handle, const U32 startTime, const F32 volume )
+{
+    AudioVirtualVoice* pVoice = list.create( handle );
+    pVoice->mDescription.mVolume = volume;
+    pVoice->mDescription.mPriority = 1.0f;
+    pVoice->mVolume = volume;
+    pVoice->mDuration = AUDIO_UNITTEST_VIRTUALVOICE_DURATION;
+    pVoice->mStartTime = startTime;
+    pVoice->mPlaying = true;
+    return pVoice;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioVirtualVoiceTests, CreateAndFindTest )
+{
+    AudioVirtualVoiceList list;
+
+    for( U32 index = 1; index <= AUDIO_UNITTEST_VIRTUALVOICE_COUNT; ++index )
+        createVoice( list, index, 0, 1.0f );
+
+    ASSERT_EQ( (U32)AUDIO_UNITTEST_VIRTUALVOICE_COUNT, list.size() ) << "Wrong voice count.";
+
+    // Destroy every other voice and check the rest are still found by handle.
+    for( U32 index = 1; index <= AUDIO_UNITTEST_VIRTUALVOICE_COUNT; index += 2 )
+        list.destroy( list.find( index ) );
+
+    ASSERT_EQ( (U32)AUDIO_UNITTEST_VIRTUALVOICE_COUNT / 2, list.size() ) << "Wrong voice count after destroy.";
+
+    for( U32 index = 1; index <= AUDIO_UNITTEST_VIRTUALVOICE_COUNT; ++index )
+    {
+        AudioVirtualVoice* pVoice = list.find( index );
+        if ( index & 1 )
+        {
+            ASSERT_TRUE( pVoice == NULL ) << "Destroyed voice was found.";
+        }
+        else
+        {
+            ASSERT_TRUE( pVoice != NULL ) << "Voice was not found.";
+            ASSERT_EQ( index, pVoice->mHandle ) << "Wrong voice found.";
+            ASSERT_TRUE( list[pVoice->mListIndex] == pVoice ) << "Stale list index.";
+        }
+    }
+
+    list.clear();
+    ASSERT_EQ( 0U, list.size() ) << "List not cleared.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioVirtualVoiceTests, OffsetTest )
+{
+    AudioVirtualVoiceList list;
+
+    AudioVirtualVoice* pOneShot = createVoice( list, 1, 1000, 1.0f );
+    AudioVirtualVoice* pLooper = createVoice( list, 2, 1000, 1.0f );
+    pLooper->mDescription.mIsLooping = true;
+
+    ASSERT_FLOAT_EQ( 0.5f, pOneShot->getOffset( 1500 ) ) << "One-shot offset did not advance.";
+    ASSERT_FLOAT_EQ( 0.5f, pLooper->getOffset( 1500 ) ) << "Looper offset did not advance.";
+
+    // One-shots stop at the end, loopers wrap.
+    ASSERT_FLOAT_EQ( 2.0f, pOneShot->getOffset( 4500 ) ) << "One-shot offset ran past the end.";
+    ASSERT_FLOAT_EQ( 1.5f, pLooper->getOffset( 4500 ) ) << "Looper offset did not wrap.";
+
+    ASSERT_FALSE( pOneShot->isFinished( 2999 ) ) << "One-shot finished early.";
+    ASSERT_TRUE( pOneShot->isFinished( 3000 ) ) << "One-shot did not finish.";
+    ASSERT_FALSE( pLooper->isFinished( 100000 ) ) << "Looper finished.";
+
+    // Voices that have not been played don't advance.
+    pOneShot->mPlaying = false;
+    ASSERT_FLOAT_EQ( 0.0f, pOneShot->getOffset( 1500 ) ) << "Unplayed voice advanced.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioVirtualVoiceTests, RetireFinishedTest )
+{
+    AudioVirtualVoiceList list;
+
+    // Stagger the start times so half have finished.
+    for( U32 index = 1; index <= AUDIO_UNITTEST_VIRTUALVOICE_COUNT; ++index )
+        createVoice( list, index, (index & 1) ? 0 : AUDIO_UNITTEST_VIRTUALVOICE_DURATION, 1.0f );
+
+    const U32 retired = list.retireFinished( AUDIO_UNITTEST_VIRTUALVOICE_DURATION + 1 );
+
+    ASSERT_EQ( (U32)AUDIO_UNITTEST_VIRTUALVOICE_COUNT / 2, retired ) << "Wrong number of voices retired.";
+    ASSERT_EQ( (U32)AUDIO_UNITTEST_VIRTUALVOICE_COUNT / 2, list.size() ) << "Wrong voice count after retiring.";
+
+    for( U32 index = 0; index < list.size(); ++index )
+        ASSERT_EQ( 0U, list[index]->mHandle & 1 ) << "Unfinished voice was retired.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AudioVirtualVoiceTests, PromotionCandidatesTest )
+{
+    AudioVirtualVoiceList list;
+    Vector<AudioVirtualVoice*> candidates;
+
+    F32 channelVolumes[Audio::AudioVolumeChannels];
+    for( U32 index = 0; index < Audio::AudioVolumeChannels; ++index )
+        channelVolumes[index] = 1.0f;
+
+    const Point3F listener( 0.0f, 0.0f, 0.0f );
+
+    createVoice( list, 1, 0, 0.2f );
+    createVoice( list, 2, 0, 0.8f );
+    createVoice( list, 3, 0, 0.5f );
+
+    // A quiet voice with a high priority beats louder ones.
+    AudioVirtualVoice* pImportant = createVoice( list, 4, 0, 0.3f );
+    pImportant->mDescription.mPriority = 4.0f;
+
+    // A voice beyond its max distance is inaudible.
+    AudioVirtualVoice* pDistant = createVoice( list, 5, 0, 1.0f );
+    pDistant->mDescription.mIs3D = true;
+    pDistant->mDescription.mReferenceDistance = 1.0f;
+    pDistant->mDescription.mMaxDistance = 10.0f;
+    pDistant->mPosition.set( 20.0f, 0.0f, 0.0f );
+
+    // A voice that has only just been culled must wait.
+    AudioVirtualVoice* pCulled = createVoice( list, 6, 0, 1.0f );
+    pCulled->mCullTime = 900;
+
+    // A voice whose buffer is still loading must wait.
+    AudioVirtualVoice* pLoading = createVoice( list, 7, 0, 1.0f );
+    pLoading->mLoading = true;
+
+    list.getPromotionCandidates( 1000, listener, channelVolumes, 0.05f, 500, candidates );
+
+    ASSERT_EQ( 4, candidates.size() ) << "Wrong number of candidates.";
+    ASSERT_EQ( 4U, candidates[0]->mHandle ) << "Priority was not applied.";
+    ASSERT_EQ( 2U, candidates[1]->mHandle ) << "Candidates not ordered by score.";
+    ASSERT_EQ( 3U, candidates[2]->mHandle ) << "Candidates not ordered by score.";
+    ASSERT_EQ( 1U, candidates[3]->mHandle ) << "Candidates not ordered by score.";
+
+    // Once the cull period has passed the culled voice competes again.
+    list.getPromotionCandidates( 1400, listener, channelVolumes, 0.05f, 500, candidates );
+
+    ASSERT_EQ( 5, candidates.size() ) << "Culled voice did not become a candidate.";
+    ASSERT_EQ( 4U, candidates[0]->mHandle ) << "Priority was not applied.";
+    ASSERT_EQ( 6U, candidates[1]->mHandle ) << "Culled voice has the wrong score.";
+}
+
+#endif // TORQUE_SHIPPING
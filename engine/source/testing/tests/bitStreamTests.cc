@@ -0,0 +1,197 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define IO_UNITTEST_BITSTREAM_BUFFERSIZE    1500
+#define IO_UNITTEST_BITSTREAM_ITERATIONS    20000
+#define IO_UNITTEST_BITSTREAM_OBJECTS       16
+
+//-----------------------------------------------------------------------------
+
+// Writes a representative object update: dirty mask flags, a class id, a position,
+// a heading, a normal, a ranged value and a name.
+static void writeObjectUpdate( BitStream& stream, const U32 index )
+{
+    stream.writeInt( index & 0x3FF, 10 );
+    if ( stream.writeFlag( (index & 1) != 0 ) )
+    {
+        stream.writeSignedInt( S32(index * 7) - 5000, 16 );
+        stream.writeSignedInt( S32(index * 3) - 2000, 16 );
+        stream.writeFloat( (index % 100) / 100.0f, 9 );
+    }
+    if ( stream.writeFlag( (index & 2) != 0 ) )
+    {
+        stream.writeNormalVector( Point3F( 0.0f, 0.6f, 0.8f ), 8 );
+        stream.writeRangedU32( index % 50, 0, 49 );
+    }
+    if ( stream.writeFlag( (index & 4) != 0 ) )
+        stream.writeString( "ObjectName" );
+}
+
+//-----------------------------------------------------------------------------
+
+static bool readObjectUpdate( BitStream& stream, const U32 index )
+{
+    if ( stream.readInt( 10 ) != S32(index & 0x3FF) )
+        return false;
+    if ( stream.readFlag() )
+    {
+        if ( stream.readSignedInt( 16 ) != S32(index * 7) - 5000 ) return false;
+        if ( stream.readSignedInt( 16 ) != S32(index * 3) - 2000 ) return false;
+        if ( mFabs( stream.readFloat( 9 ) - (index % 100) / 100.0f ) > 0.01f ) return false;
+    }
+    if ( stream.readFlag() )
+    {
+        Point3F normal;
+        stream.readNormalVector( &normal, 8 );
+        if ( mFabs( normal.z - 0.8f ) > 0.02f ) return false;
+        if ( stream.readRangedU32( 0, 49 ) != index % 50 ) return false;
+    }
+    if ( stream.readFlag() )
+    {
+        char nameBuffer[256];
+        stream.readString( nameBuffer );
+        if ( dStrcmp( nameBuffer, "ObjectName" ) != 0 ) return false;
+    }
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BitStreamTests, BitsRoundTripTest )
+{
+    U8 buffer[IO_UNITTEST_BITSTREAM_BUFFERSIZE];
+    U8 source[64];
+    U8 result[64];
+
+    for( U32 index = 0; index < sizeof(source); ++index )
+        source[index] = U8(index * 37 + 11);
+
+    // Write and read back every length at every bit alignment.
+    for( S32 offset = 0; offset < 8; ++offset )
+    {
+        for( S32 bitCount = 1; bitCount <= 300; ++bitCount )
+        {
+            dMemset( buffer, 0xFF, sizeof(buffer) );
+            BitStream stream( buffer, sizeof(buffer) );
+
+            stream.setCurPos( offset );
+            stream.writeBits( bitCount, source );
+            ASSERT_EQ( offset + bitCount, stream.getCurPos() ) << "Wrong position after write.";
+
+            // Bits either side of the write must be untouched.
+            for( S32 bit = 0; bit < offset; ++bit )
+                ASSERT_TRUE( stream.testBit( bit ) ) << "Write clobbered a preceding bit.";
+            ASSERT_TRUE( stream.testBit( offset + bitCount ) ) << "Write clobbered a following bit.";
+
+            dMemset( result, 0, sizeof(result) );
+            stream.setCurPos( offset );
+            stream.readBits( bitCount, result );
+            ASSERT_TRUE( stream.isValid() ) << "Read failed.";
+
+            for( S32 bit = 0; bit < bitCount; ++bit )
+            {
+                ASSERT_EQ( (source[bit >> 3] >> (bit & 0x7)) & 1, (result[bit >> 3] >> (bit & 0x7)) & 1 ) << "Bit mismatch.";
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BitStreamTests, IntRoundTripTest )
+{
+    U8 buffer[IO_UNITTEST_BITSTREAM_BUFFERSIZE];
+    BitStream stream( buffer, sizeof(buffer) );
+
+    for( S32 bitCount = 1; bitCount <= 32; ++bitCount )
+    {
+        stream.writeFlag( true );
+        stream.writeInt( S32(0xDEADBEEF), bitCount );
+    }
+
+    stream.setCurPos( 0 );
+
+    for( S32 bitCount = 1; bitCount <= 32; ++bitCount )
+    {
+        const S32 expected = bitCount == 32 ? S32(0xDEADBEEF) : S32(0xDEADBEEF & ((1U << bitCount) - 1));
+        ASSERT_TRUE( stream.readFlag() ) << "Flag mismatch.";
+        ASSERT_EQ( expected, stream.readInt( bitCount ) ) << "Integer mismatch.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BitStreamTests, ObjectUpdateBenchmarkTest )
+{
+    U8 buffer[IO_UNITTEST_BITSTREAM_BUFFERSIZE];
+    BitStream stream( buffer, sizeof(buffer) );
+
+    // Time packing packets of object updates.
+    U32 startTime = Platform::getRealMilliseconds();
+    for( U32 iteration = 0; iteration < IO_UNITTEST_BITSTREAM_ITERATIONS; ++iteration )
+    {
+        stream.setPosition( 0 );
+        for( U32 index = 0; index < IO_UNITTEST_BITSTREAM_OBJECTS; ++index )
+            writeObjectUpdate( stream, iteration + index );
+    }
+    const U32 writeTime = Platform::getRealMilliseconds() - startTime;
+    const S32 packetBits = stream.getCurPos();
+
+    // Time unpacking them.
+    bool valid = true;
+    startTime = Platform::getRealMilliseconds();
+    for( U32 iteration = 0; iteration < IO_UNITTEST_BITSTREAM_ITERATIONS; ++iteration )
+    {
+        // Only the last packet is still in the buffer.
+        const U32 base = IO_UNITTEST_BITSTREAM_ITERATIONS - 1;
+
+        stream.setPosition( 0 );
+        for( U32 index = 0; index < IO_UNITTEST_BITSTREAM_OBJECTS; ++index )
+            valid &= readObjectUpdate( stream, base + index );
+    }
+    const U32 readTime = Platform::getRealMilliseconds() - startTime;
+
+    ASSERT_TRUE( valid ) << "Object updates did not round trip.";
+    ASSERT_TRUE( stream.isValid() ) << "Stream error.";
+
+    Con::printf( ">> BitStream: %d packets of %d updates (%d bits) written in %dms, read in %dms.",
+        IO_UNITTEST_BITSTREAM_ITERATIONS, IO_UNITTEST_BITSTREAM_OBJECTS, packetBits, writeTime, readTime );
+}
+
+#endif // TORQUE_SHIPPING
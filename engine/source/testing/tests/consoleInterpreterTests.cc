@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _COMPILER_H_
+#include "console/compiler.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Representative script kernels used both to check the interpreter and to time it.
+#define CONSOLE_UNITTEST_INTERPRETER_KERNELS \
+    "function _unitTestLoopKernel( %count ) { %sum = 0; for( %i = 0; %i < %count; %i++ ) %sum += %i; return %sum; }" \
+    "function _unitTestBranchKernel( %count ) { %odd = 0; for( %i = 0; %i < %count; %i++ ) { if ( %i % 2 == 1 ) %odd++; else if ( %i > %count ) %odd = -1; } return %odd; }" \
+    "function _unitTestFieldKernel( %count ) { %object = new ScriptObject() { value = 3; }; %sum = 0; for( %i = 0; %i < %count; %i++ ) %sum += %object.value; %object.delete(); return %sum; }" \
+    "function _unitTestConditionalKernel( %count ) { %sum = 0; for( %i = 0; %i < %count; %i++ ) %sum += %i >= 5 ? 1 : 0; return %sum; }" \
+    "function _unitTestStringKernel( %count ) { %text = \"\"; for( %i = 0; %i < %count; %i++ ) %text = %text @ \"x\"; return strlen( %text ); }"
+
+#define CONSOLE_UNITTEST_INTERPRETER_ITERATIONS     100000
+
+//-----------------------------------------------------------------------------
+
+static S32 executeKernel( const char* pKernelName, const S32 count )
+{
+    char countBuffer[32];
+    dSprintf( countBuffer, sizeof(countBuffer), "%d", count );
+    return dAtoi( Con::executef( 2, pKernelName, countBuffer ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleInterpreterTests, KernelResultTest )
+{
+    Con::evaluate( CONSOLE_UNITTEST_INTERPRETER_KERNELS, false, NULL );
+
+    // Check the kernels compute the expected results.
+    ASSERT_EQ( 4950, executeKernel( "_unitTestLoopKernel", 100 ) ) << "Loop kernel failed.";
+    ASSERT_EQ( 50, executeKernel( "_unitTestBranchKernel", 100 ) ) << "Branch kernel failed.";
+    ASSERT_EQ( 300, executeKernel( "_unitTestFieldKernel", 100 ) ) << "Field kernel failed.";
+    ASSERT_EQ( 95, executeKernel( "_unitTestConditionalKernel", 100 ) ) << "Conditional kernel failed.";
+    ASSERT_EQ( 100, executeKernel( "_unitTestStringKernel", 100 ) ) << "String kernel failed.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleInterpreterTests, KernelBenchmarkTest )
+{
+    const char* kernelNames[] =
+    {
+        "_unitTestLoopKernel",
+        "_unitTestBranchKernel",
+        "_unitTestFieldKernel",
+        "_unitTestConditionalKernel",
+        "_unitTestStringKernel",
+    };
+
+    // Time the kernels.
+    for( U32 index = 0; index < sizeof(kernelNames) / sizeof(kernelNames[0]); ++index )
+    {
+        // The string kernel is quadratic so keep it short.
+        const S32 iterations = index == 4 ? CONSOLE_UNITTEST_INTERPRETER_ITERATIONS / 100 : CONSOLE_UNITTEST_INTERPRETER_ITERATIONS;
+
+        // Run the kernel compiled with superinstructions.
+        Compiler::gSuperInstructions = true;
+        Con::evaluate( CONSOLE_UNITTEST_INTERPRETER_KERNELS, false, NULL );
+
+        U32 startTime = Platform::getRealMilliseconds();
+        const S32 fusedResult = executeKernel( kernelNames[index], iterations );
+        const U32 fusedTime = Platform::getRealMilliseconds() - startTime;
+
+        // Run it again compiled with the plain instruction sequences.
+        Compiler::gSuperInstructions = false;
+        Con::evaluate( CONSOLE_UNITTEST_INTERPRETER_KERNELS, false, NULL );
+
+        startTime = Platform::getRealMilliseconds();
+        const S32 plainResult = executeKernel( kernelNames[index], iterations );
+        const U32 plainTime = Platform::getRealMilliseconds() - startTime;
+
+        Compiler::gSuperInstructions = true;
+
+        ASSERT_EQ( plainResult, fusedResult ) << "Kernel '" << kernelNames[index] << "' differs with superinstructions.";
+
+        Con::printf( ">> Kernel '%s' x %d took %dms fused, %dms unfused (result %d).", kernelNames[index], iterations, fusedTime, plainTime, fusedResult );
+    }
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,113 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _DISPATCHER_H_
+#include "messaging/dispatcher.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define MESSAGING_UNITTEST_DISPATCHER_QUEUE     "DispatcherTestQueue"
+#define MESSAGING_UNITTEST_DISPATCHER_TYPE      7
+
+//-----------------------------------------------------------------------------
+
+// Records the typed messages delivered to it.
+class DispatcherTestListener : public Dispatcher::IMessageListener
+{
+public:
+    Vector<U32> mReceived;
+
+    virtual bool onMessageReceived( StringTableEntry queue, const char* msg, const char* data ) { return true; }
+    virtual bool onMessageObjectReceived( StringTableEntry queue, Message* msg ) { return true; }
+
+    virtual bool onMessageDataReceived( StringTableEntry queue, U32 type, const void* data, U32 size )
+    {
+        if ( type == MESSAGING_UNITTEST_DISPATCHER_TYPE && size == sizeof(U32) )
+            mReceived.push_back( *(const U32*)data );
+
+        return true;
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( DispatcherTests, PostDeliverTest )
+{
+    Dispatcher::registerMessageQueue( MESSAGING_UNITTEST_DISPATCHER_QUEUE );
+
+    DispatcherTestListener listener;
+    ASSERT_TRUE( Dispatcher::registerMessageListener( MESSAGING_UNITTEST_DISPATCHER_QUEUE, &listener ) );
+
+    for( U32 value = 1; value <= 3; ++value )
+        ASSERT_TRUE( Dispatcher::postMessage( MESSAGING_UNITTEST_DISPATCHER_QUEUE, MESSAGING_UNITTEST_DISPATCHER_TYPE, value ) );
+
+    // Nothing is delivered until the posted messages are.
+    ASSERT_EQ( 0, listener.mReceived.size() );
+
+    Dispatcher::deliverPostedMessages();
+    ASSERT_EQ( 3, listener.mReceived.size() ) << "Posted messages were not delivered.";
+    for( S32 index = 0; index < listener.mReceived.size(); ++index )
+        ASSERT_EQ( U32(index + 1), listener.mReceived[index] ) << "Posted messages were delivered out of order.";
+
+    Dispatcher::unregisterMessageListener( MESSAGING_UNITTEST_DISPATCHER_QUEUE, &listener );
+    Dispatcher::unregisterMessageQueue( MESSAGING_UNITTEST_DISPATCHER_QUEUE );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( DispatcherTests, ReregisterPostTest )
+{
+    // Unregister a queue with a message still waiting to be delivered.
+    Dispatcher::registerMessageQueue( MESSAGING_UNITTEST_DISPATCHER_QUEUE );
+    ASSERT_TRUE( Dispatcher::postMessage( MESSAGING_UNITTEST_DISPATCHER_QUEUE, MESSAGING_UNITTEST_DISPATCHER_TYPE, U32(1) ) );
+    Dispatcher::unregisterMessageQueue( MESSAGING_UNITTEST_DISPATCHER_QUEUE );
+
+    // Register it again and post before the next delivery.
+    Dispatcher::registerMessageQueue( MESSAGING_UNITTEST_DISPATCHER_QUEUE );
+
+    DispatcherTestListener listener;
+    ASSERT_TRUE( Dispatcher::registerMessageListener( MESSAGING_UNITTEST_DISPATCHER_QUEUE, &listener ) );
+    ASSERT_TRUE( Dispatcher::postMessage( MESSAGING_UNITTEST_DISPATCHER_QUEUE, MESSAGING_UNITTEST_DISPATCHER_TYPE, U32(2) ) );
+
+    // The discarded message is gone but the new one arrives.
+    Dispatcher::deliverPostedMessages();
+    ASSERT_EQ( 1, listener.mReceived.size() ) << "Posted message was not delivered after the queue was registered again.";
+    ASSERT_EQ( 2U, listener.mReceived[0] );
+
+    // Later posts keep being delivered.
+    ASSERT_TRUE( Dispatcher::postMessage( MESSAGING_UNITTEST_DISPATCHER_QUEUE, MESSAGING_UNITTEST_DISPATCHER_TYPE, U32(3) ) );
+    Dispatcher::deliverPostedMessages();
+    ASSERT_EQ( 2, listener.mReceived.size() ) << "Later posted message was not delivered.";
+    ASSERT_EQ( 3U, listener.mReceived[1] );
+
+    Dispatcher::unregisterMessageListener( MESSAGING_UNITTEST_DISPATCHER_QUEUE, &listener );
+    Dispatcher::unregisterMessageQueue( MESSAGING_UNITTEST_DISPATCHER_QUEUE );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,196 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _FLATHASHMAP_H_
+#include "collection/flatHashMap.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define COLLECTION_UNITTEST_FLATHASHMAP_KEYS           4096
+#define COLLECTION_UNITTEST_FLATHASHMAP_ITERATIONS     200
+
+//-----------------------------------------------------------------------------
+
+static U32 flatHashMapKey( const U32 index )
+{
+    // Spread the keys out like object ids and pointers are.
+    return index * 2654435761u;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FlatHashMapTests, InsertFindEraseTest )
+{
+    FlatHashMap<U32, U32> map;
+    ASSERT_TRUE( map.isEmpty() );
+
+    for( U32 index = 0; index < COLLECTION_UNITTEST_FLATHASHMAP_KEYS; ++index )
+        ASSERT_TRUE( map.insert( flatHashMapKey(index), index ) != map.end() );
+
+    ASSERT_EQ( COLLECTION_UNITTEST_FLATHASHMAP_KEYS, map.size() );
+
+    // Inserting an existing key fails and keeps the value.
+    ASSERT_TRUE( map.insert( flatHashMapKey(0), 1234 ) == map.end() );
+    ASSERT_EQ( 0, map[flatHashMapKey(0)] );
+
+    for( U32 index = 0; index < COLLECTION_UNITTEST_FLATHASHMAP_KEYS; ++index )
+    {
+        FlatHashMap<U32, U32>::iterator itr = map.find( flatHashMapKey(index) );
+        ASSERT_TRUE( itr != map.end() );
+        ASSERT_EQ( index, itr->value );
+    }
+    ASSERT_FALSE( map.contains( flatHashMapKey(COLLECTION_UNITTEST_FLATHASHMAP_KEYS) ) );
+
+    // Erase every other key.  The rest must still be found after the backward shifts.
+    for( U32 index = 0; index < COLLECTION_UNITTEST_FLATHASHMAP_KEYS; index += 2 )
+        map.erase( flatHashMapKey(index) );
+
+    ASSERT_EQ( COLLECTION_UNITTEST_FLATHASHMAP_KEYS / 2, map.size() );
+    for( U32 index = 0; index < COLLECTION_UNITTEST_FLATHASHMAP_KEYS; ++index )
+        ASSERT_EQ( (index & 1) != 0, map.contains( flatHashMapKey(index) ) );
+
+    // Clearing keeps the table.
+    const U32 tableSize = map.tableSize();
+    map.clear();
+    ASSERT_TRUE( map.isEmpty() );
+    ASSERT_EQ( tableSize, map.tableSize() );
+    ASSERT_TRUE( map.begin() == map.end() );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FlatHashMapTests, IterateAndCopyTest )
+{
+    FlatHashMap<U32, U32> map;
+    for( U32 index = 0; index < COLLECTION_UNITTEST_FLATHASHMAP_KEYS; ++index )
+        map[flatHashMapKey(index)] = index;
+
+    // Every entry is visited once.
+    U32 count = 0;
+    U64 total = 0;
+    for( FlatHashMap<U32, U32>::iterator itr = map.begin(); itr != map.end(); ++itr )
+    {
+        ASSERT_EQ( flatHashMapKey(itr->value), itr->key );
+        total += itr->value;
+        ++count;
+    }
+    ASSERT_EQ( COLLECTION_UNITTEST_FLATHASHMAP_KEYS, count );
+    ASSERT_EQ( (U64)COLLECTION_UNITTEST_FLATHASHMAP_KEYS * (COLLECTION_UNITTEST_FLATHASHMAP_KEYS - 1) / 2, total );
+
+    // Erasing through an iterator.
+    FlatHashMap<U32, U32>::iterator itr = map.find( flatHashMapKey(7) );
+    map.erase( itr );
+    ASSERT_FALSE( map.contains( flatHashMapKey(7) ) );
+
+    // Copies are independent.
+    FlatHashMap<U32, U32> copy( map );
+    ASSERT_EQ( map.size(), copy.size() );
+    copy[flatHashMapKey(7)] = 7;
+    ASSERT_FALSE( map.contains( flatHashMapKey(7) ) );
+    ASSERT_TRUE( copy.contains( flatHashMapKey(7) ) );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FlatHashMapTests, StringKeyTest )
+{
+    // String keys hash and compare without case, as HashMap does.
+    FlatHashMap<const char*, U32> map;
+    map.insert( "Scene", 1 );
+    map.insert( "SceneObject", 2 );
+
+    ASSERT_TRUE( map.contains( "scene" ) );
+    ASSERT_EQ( 2, map["SCENEOBJECT"] );
+    ASSERT_TRUE( map.insert( "SCENE", 3 ) == map.end() );
+}
+
+//-----------------------------------------------------------------------------
+
+template<class Map> static U32 flatHashMapBenchmark( U32& insertTime, U32& findTime, U32& iterateTime, U32& eraseTime )
+{
+    U32 total = 0;
+    insertTime = findTime = iterateTime = eraseTime = 0;
+
+    for( U32 iteration = 0; iteration < COLLECTION_UNITTEST_FLATHASHMAP_ITERATIONS; ++iteration )
+    {
+        Map map;
+
+        U32 startTime = Platform::getRealMilliseconds();
+        for( U32 index = 0; index < COLLECTION_UNITTEST_FLATHASHMAP_KEYS; ++index )
+            map.insert( flatHashMapKey(index), index );
+        insertTime += Platform::getRealMilliseconds() - startTime;
+
+        startTime = Platform::getRealMilliseconds();
+        for( U32 pass = 0; pass < 4; ++pass )
+        {
+            for( U32 index = 0; index < COLLECTION_UNITTEST_FLATHASHMAP_KEYS; ++index )
+                total += map.find( flatHashMapKey(index) )->value;
+        }
+        findTime += Platform::getRealMilliseconds() - startTime;
+
+        startTime = Platform::getRealMilliseconds();
+        for( typename Map::iterator itr = map.begin(); itr != map.end(); ++itr )
+            total += itr->value;
+        iterateTime += Platform::getRealMilliseconds() - startTime;
+
+        startTime = Platform::getRealMilliseconds();
+        for( U32 index = 0; index < COLLECTION_UNITTEST_FLATHASHMAP_KEYS; ++index )
+            map.erase( flatHashMapKey(index) );
+        eraseTime += Platform::getRealMilliseconds() - startTime;
+    }
+
+    return total;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FlatHashMapTests, HashMapBenchmarkTest )
+{
+    U32 insertTime, findTime, iterateTime, eraseTime;
+
+    const U32 hashTotal = flatHashMapBenchmark< HashMap<U32, U32> >( insertTime, findTime, iterateTime, eraseTime );
+    Con::printf( ">> HashMap: %d keys x %d iterations, insert %dms, find %dms, iterate %dms, erase %dms.",
+        COLLECTION_UNITTEST_FLATHASHMAP_KEYS, COLLECTION_UNITTEST_FLATHASHMAP_ITERATIONS, insertTime, findTime, iterateTime, eraseTime );
+
+    const U32 flatTotal = flatHashMapBenchmark< FlatHashMap<U32, U32> >( insertTime, findTime, iterateTime, eraseTime );
+    Con::printf( ">> FlatHashMap: %d keys x %d iterations, insert %dms, find %dms, iterate %dms, erase %dms.",
+        COLLECTION_UNITTEST_FLATHASHMAP_KEYS, COLLECTION_UNITTEST_FLATHASHMAP_ITERATIONS, insertTime, findTime, iterateTime, eraseTime );
+
+    ASSERT_EQ( hashTotal, flatTotal ) << "Maps disagree.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,279 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _GHOSTSNAPSHOT_H_
+#include "network/ghostSnapshot.h"
+#endif
+
+#ifndef _BITSTREAM_H_
+#include "io/bitStream.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define NETWORK_UNITTEST_SNAPSHOT_BUFFERSIZE    8192
+#define NETWORK_UNITTEST_SNAPSHOT_OBJECTS       64
+#define NETWORK_UNITTEST_SNAPSHOT_FIELDS        6
+#define NETWORK_UNITTEST_SNAPSHOT_PACKETS       2000
+#define NETWORK_UNITTEST_SNAPSHOT_ACK_DELAY     4
+
+//-----------------------------------------------------------------------------
+
+// Quantized state of a moving object: position, velocity, angle and health.
+static void getObjectSnapshot( S32* pFields, const U32 object, const U32 tick )
+{
+    const S32 speedX = S32(object % 7) - 3;
+    const S32 speedY = S32(object % 5) - 2;
+    pFields[0] = S32(object * 1000) + speedX * S32(tick) * 12;
+    pFields[1] = S32(object * 500) - 20000 + speedY * S32(tick) * 12;
+    pFields[2] = speedX * 12;
+    pFields[3] = speedY * 12;
+    pFields[4] = S32((object * 31 + tick * (object % 3)) % 360);
+    pFields[5] = 100 - S32((tick / 50 + object) % 100);
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( GhostSnapshotTests, GolombRoundTripTest )
+{
+    U8 buffer[NETWORK_UNITTEST_SNAPSHOT_BUFFERSIZE];
+    const S32 values[] = { 0, 1, -1, 2, -2, 7, -8, 100, -1000, 65535, -65536, S32(0x7FFFFFFF), S32(0x80000000) };
+    const U32 valueCount = sizeof(values) / sizeof(S32);
+
+    for( U32 order = 0; order < 16; ++order )
+    {
+        BitStream stream( buffer, sizeof(buffer) );
+        for( U32 index = 0; index < valueCount; ++index )
+            stream.writeGolombS32( values[index], order );
+
+        stream.setCurPos( 0 );
+        for( U32 index = 0; index < valueCount; ++index )
+            ASSERT_EQ( values[index], stream.readGolombS32( order ) ) << "Golomb code mismatch.";
+
+        ASSERT_TRUE( stream.isValid() ) << "Stream error.";
+    }
+
+    // Zero takes a single bit with order zero.
+    BitStream stream( buffer, sizeof(buffer) );
+    stream.writeGolombS32( 0, 0 );
+    ASSERT_EQ( 1, stream.getCurPos() ) << "Zero should take one bit.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( GhostSnapshotTests, HistoryTest )
+{
+    S32 fields[NETWORK_UNITTEST_SNAPSHOT_FIELDS];
+    GhostSnapshotHistory history( NETWORK_UNITTEST_SNAPSHOT_FIELDS );
+
+    for( U32 sequence = 1; sequence <= GhostSnapshot::HistorySize * 2; ++sequence )
+    {
+        getObjectSnapshot( fields, 3, sequence );
+        history.add( sequence, fields );
+    }
+
+    // Only the newest snapshots are kept.
+    ASSERT_TRUE( history.find( GhostSnapshot::HistorySize ) == NULL ) << "Oldest snapshot should be replaced.";
+
+    const S32* pFound = history.find( GhostSnapshot::HistorySize + 1 );
+    ASSERT_TRUE( pFound != NULL ) << "Snapshot should be held.";
+
+    getObjectSnapshot( fields, 3, GhostSnapshot::HistorySize + 1 );
+    ASSERT_EQ( 0, dMemcmp( pFound, fields, sizeof(fields) ) ) << "Snapshot mismatch.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( GhostSnapshotTests, HistoryDemoTest )
+{
+    S32 fields[NETWORK_UNITTEST_SNAPSHOT_FIELDS];
+    GhostSnapshotHistory history( NETWORK_UNITTEST_SNAPSHOT_FIELDS );
+
+    for( U32 sequence = 1; sequence <= GhostSnapshot::HistorySize; ++sequence )
+    {
+        getObjectSnapshot( fields, 60, sequence * 100 );
+        history.add( sequence, fields );
+    }
+
+    // Start with less room than the whole history needs so that it has to grow as it is written.
+    ResizeBitStream stream( 64, 64 );
+    history.write( &stream );
+    ASSERT_TRUE( stream.isValid() ) << "Stream error.";
+
+    GhostSnapshotHistory readHistory( NETWORK_UNITTEST_SNAPSHOT_FIELDS );
+    stream.setCurPos( 0 );
+    readHistory.read( &stream );
+    ASSERT_TRUE( stream.isValid() ) << "Stream error.";
+
+    for( U32 sequence = 1; sequence <= GhostSnapshot::HistorySize; ++sequence )
+    {
+        const S32* pFound = readHistory.find( sequence );
+        ASSERT_TRUE( pFound != NULL ) << "Snapshot should be held.";
+        ASSERT_EQ( 0, dMemcmp( pFound, history.find( sequence ), sizeof(fields) ) ) << "Snapshot mismatch.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( GhostSnapshotTests, BaselineTest )
+{
+    S32 fields[NETWORK_UNITTEST_SNAPSHOT_FIELDS];
+    U8 buffer[NETWORK_UNITTEST_SNAPSHOT_BUFFERSIZE];
+    GhostSnapshotBaseline baseline;
+
+    // Without an acknowledged snapshot there is no baseline.
+    ASSERT_EQ( 0U, baseline.getAge( 1 ) ) << "Baseline should not be set.";
+
+    getObjectSnapshot( fields, 5, 10 );
+    BitStream stream( buffer, sizeof(buffer) );
+    S32* pSent = baseline.write( &stream, fields, NETWORK_UNITTEST_SNAPSHOT_FIELDS, 10, true );
+    ASSERT_TRUE( pSent != NULL ) << "Sent fields should be kept.";
+    ASSERT_EQ( 0, dMemcmp( pSent, fields, sizeof(fields) ) ) << "Kept fields mismatch.";
+
+    // Acknowledging the packet adopts the fields sent in it.
+    baseline.acknowledge( pSent, 10 );
+    ASSERT_TRUE( baseline.getFields() == pSent ) << "Acknowledged fields should become the baseline.";
+    ASSERT_EQ( 1U, baseline.getAge( 11 ) ) << "Baseline age mismatch.";
+    ASSERT_EQ( U32(GhostSnapshot::HistorySize - 1), baseline.getAge( 10 + GhostSnapshot::HistorySize - 1 ) ) << "Baseline age mismatch.";
+
+    // The client no longer holds snapshots this old.
+    ASSERT_EQ( 0U, baseline.getAge( 10 + GhostSnapshot::HistorySize ) ) << "Baseline should be too old.";
+
+    // Nothing is kept unless requested.
+    ASSERT_TRUE( baseline.write( &stream, fields, NETWORK_UNITTEST_SNAPSHOT_FIELDS, 11, false ) == NULL ) << "Sent fields should not be kept.";
+
+    baseline.clear();
+    ASSERT_TRUE( baseline.getFields() == NULL ) << "Baseline should be cleared.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( GhostSnapshotTests, LoopbackBenchmarkTest )
+{
+    U8 buffer[NETWORK_UNITTEST_SNAPSHOT_BUFFERSIZE];
+
+    // Server state: the acknowledged baseline for each object, and the fields kept for packets awaiting notification.
+    GhostSnapshotBaseline baselines[NETWORK_UNITTEST_SNAPSHOT_OBJECTS];
+    S32* pSent[GhostSnapshot::HistorySize][NETWORK_UNITTEST_SNAPSHOT_OBJECTS];
+    bool delivered[GhostSnapshot::HistorySize];
+
+    // Client state.
+    GhostSnapshotHistory* histories[NETWORK_UNITTEST_SNAPSHOT_OBJECTS];
+    for( U32 object = 0; object < NETWORK_UNITTEST_SNAPSHOT_OBJECTS; ++object )
+        histories[object] = new GhostSnapshotHistory( NETWORK_UNITTEST_SNAPSHOT_FIELDS );
+
+    S32 fields[NETWORK_UNITTEST_SNAPSHOT_FIELDS];
+    S32 received[NETWORK_UNITTEST_SNAPSHOT_FIELDS];
+    U32 deltaBits = 0;
+    U32 fullBits = 0;
+    U32 random = 1;
+    bool valid = true;
+    bool adopted = true;
+
+    const U32 startTime = Platform::getRealMilliseconds();
+
+    // The sequences follow NetConnection: the send sequence is advanced before the packet is
+    // written, and the client reads each packet with the sequence it was sent with.
+    U32 lastSendSeq = 0;
+    for( U32 packet = 0; packet < NETWORK_UNITTEST_SNAPSHOT_PACKETS; ++packet )
+    {
+        lastSendSeq++;
+
+        // Notify the packet sent a few packets ago, as ghostPacketReceived() and ghostPacketDropped() do.
+        if ( lastSendSeq > NETWORK_UNITTEST_SNAPSHOT_ACK_DELAY )
+        {
+            const U32 notifySequence = lastSendSeq - NETWORK_UNITTEST_SNAPSHOT_ACK_DELAY;
+            const U32 slot = notifySequence % GhostSnapshot::HistorySize;
+            for( U32 object = 0; object < NETWORK_UNITTEST_SNAPSHOT_OBJECTS; ++object )
+            {
+                if ( delivered[slot] )
+                {
+                    baselines[object].acknowledge( pSent[slot][object], notifySequence );
+                    adopted &= baselines[object].getFields() == pSent[slot][object];
+                }
+                else
+                {
+                    GhostSnapshotBaseline::drop( pSent[slot][object] );
+                }
+            }
+        }
+
+        // Write a packet of snapshots against the baselines, as ghostWriteSnapshot() does.
+        BitStream stream( buffer, sizeof(buffer) );
+        const U32 slot = lastSendSeq % GhostSnapshot::HistorySize;
+        for( U32 object = 0; object < NETWORK_UNITTEST_SNAPSHOT_OBJECTS; ++object )
+        {
+            getObjectSnapshot( fields, object, lastSendSeq );
+            pSent[slot][object] = baselines[object].write( &stream, fields, NETWORK_UNITTEST_SNAPSHOT_FIELDS, lastSendSeq, true );
+        }
+        deltaBits += stream.getCurPos();
+        fullBits += NETWORK_UNITTEST_SNAPSHOT_OBJECTS * NETWORK_UNITTEST_SNAPSHOT_FIELDS * 32;
+
+        // Drop about one packet in eight.
+        random = random * 1664525 + 1013904223;
+        delivered[slot] = (random >> 29) != 0;
+        if ( !delivered[slot] )
+            continue;
+
+        // Read the packet back as ghostReadSnapshot() does.
+        const U32 lastSeqRecvd = lastSendSeq;
+        stream.setCurPos( 0 );
+        for( U32 object = 0; object < NETWORK_UNITTEST_SNAPSHOT_OBJECTS; ++object )
+        {
+            valid &= histories[object]->readUpdate( &stream, lastSeqRecvd, received );
+
+            getObjectSnapshot( fields, object, lastSeqRecvd );
+            valid &= dMemcmp( fields, received, sizeof(fields) ) == 0;
+        }
+    }
+
+    const U32 elapsedTime = Platform::getRealMilliseconds() - startTime;
+
+    // Release the fields of packets that were never notified, as the connection does when it closes.
+    for( U32 sequence = lastSendSeq - NETWORK_UNITTEST_SNAPSHOT_ACK_DELAY + 1; sequence <= lastSendSeq; ++sequence )
+    {
+        for( U32 object = 0; object < NETWORK_UNITTEST_SNAPSHOT_OBJECTS; ++object )
+            GhostSnapshotBaseline::drop( pSent[sequence % GhostSnapshot::HistorySize][object] );
+    }
+
+    for( U32 object = 0; object < NETWORK_UNITTEST_SNAPSHOT_OBJECTS; ++object )
+        delete histories[object];
+
+    ASSERT_TRUE( valid ) << "Snapshots did not round trip.";
+    ASSERT_TRUE( adopted ) << "Acknowledged snapshots should become the baselines.";
+    ASSERT_LT( deltaBits, fullBits / 4 ) << "Delta snapshots should be much smaller than full precision fields.";
+
+    Con::printf( ">> GhostSnapshot: %d packets of %d objects sent in %d bits against %d bits at full precision (%.1f%%), written and read in %dms.",
+        NETWORK_UNITTEST_SNAPSHOT_PACKETS, NETWORK_UNITTEST_SNAPSHOT_OBJECTS, deltaBits, fullBits, 100.0f * deltaBits / fullBits, elapsedTime );
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,186 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_PREFAB_H_
+#include "2d/sceneobject/ScenePrefab.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENE_UNITTEST_PREFAB_INSTANCES     2000
+
+// The fields of the template object, as a script would set them.
+static const char* scenePrefabFields[][2] =
+{
+    { "Size", "2 3" },
+    { "Angle", "30" },
+    { "BodyType", "static" },
+    { "LinearDamping", "0.5" },
+    { "DefaultFriction", "0.4" },
+    { "SceneLayer", "5" },
+    { "health", "100" },
+};
+
+#define SCENE_UNITTEST_PREFAB_SCRIPT_KERNEL \
+    "function _unitTestPrefabScriptKernel( %scene, %count ) { for( %i = 0; %i < %count; %i++ ) { %object = new SceneObject() { Size = \"2 3\"; Angle = 30; BodyType = \"static\"; LinearDamping = 0.5; DefaultFriction = 0.4; SceneLayer = 5; health = 100; }; %scene.add( %object ); } }"
+
+//-----------------------------------------------------------------------------
+
+static SceneObject* createPrefabTemplate( void )
+{
+    SceneObject* pTemplate = new SceneObject();
+    pTemplate->registerObject();
+
+    for( U32 index = 0; index < sizeof(scenePrefabFields) / sizeof(scenePrefabFields[0]); ++index )
+        pTemplate->setDataField( StringTable->insert( scenePrefabFields[index][0] ), NULL, scenePrefabFields[index][1] );
+
+    return pTemplate;
+}
+
+//-----------------------------------------------------------------------------
+
+static Scene* createPrefabScene( void )
+{
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ScenePrefabTests, SpawnTest )
+{
+    SceneObject* pTemplate = createPrefabTemplate();
+    Scene* pScene = createPrefabScene();
+
+    ScenePrefab* pPrefab = new ScenePrefab();
+    pPrefab->registerObject();
+    ASSERT_TRUE( pPrefab->setTemplate( pTemplate ) ) << "Template was not set.";
+
+    // Changing the source object afterwards does not affect the prefab.
+    pTemplate->setSize( Vector2( 7.0f, 7.0f ) );
+
+    const Vector2 position( 10.0f, -4.0f );
+    SceneObject* pInstance = pPrefab->spawn( pScene, &position );
+    ASSERT_TRUE( pInstance != NULL ) << "Instance was not spawned.";
+    ASSERT_EQ( pScene, pInstance->getScene() ) << "Instance was not added to the scene.";
+    ASSERT_TRUE( pInstance->getPosition() == position ) << "Instance position mismatch.";
+    ASSERT_TRUE( pInstance->getSize() == Vector2( 2.0f, 3.0f ) ) << "Instance size mismatch.";
+    ASSERT_EQ( b2_staticBody, pInstance->getBodyType() ) << "Instance body type mismatch.";
+    ASSERT_STREQ( "100", pInstance->getDataField( StringTable->insert( "health" ), NULL ) ) << "Instance dynamic field mismatch.";
+
+    // Spawn a batch into a set.
+    SimSet* pInstanceSet = new SimSet();
+    pInstanceSet->registerObject();
+    ASSERT_EQ( 10U, pPrefab->spawn( pScene, 10, NULL, pInstanceSet ) ) << "Batch was not spawned.";
+    ASSERT_EQ( 10, pInstanceSet->size() ) << "Batch was not added to the instance set.";
+    ASSERT_EQ( 11U, pScene->getSceneObjectCount() ) << "Batch was not added to the scene.";
+
+    pInstanceSet->deleteObject();
+    pPrefab->deleteObject();
+    pScene->deleteObject();
+    pTemplate->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ScenePrefabTests, SpawnBenchmarkTest )
+{
+    SceneObject* pTemplate = createPrefabTemplate();
+
+    // Spawn from a prefab.
+    ScenePrefab* pPrefab = new ScenePrefab();
+    pPrefab->registerObject();
+    pPrefab->setTemplate( pTemplate );
+
+    Scene* pScene = createPrefabScene();
+    U32 startTime = Platform::getRealMilliseconds();
+    const U32 prefabCount = pPrefab->spawn( pScene, SCENE_UNITTEST_PREFAB_INSTANCES );
+    const U32 prefabTime = Platform::getRealMilliseconds() - startTime;
+    const U32 prefabSceneCount = pScene->getSceneObjectCount();
+    pScene->deleteObject();
+
+    // Construct in script.
+    Con::evaluate( SCENE_UNITTEST_PREFAB_SCRIPT_KERNEL, false, NULL );
+
+    char countBuffer[32];
+    dSprintf( countBuffer, sizeof(countBuffer), "%d", SCENE_UNITTEST_PREFAB_INSTANCES );
+
+    pScene = createPrefabScene();
+    startTime = Platform::getRealMilliseconds();
+    Con::executef( 3, "_unitTestPrefabScriptKernel", pScene->getIdString(), countBuffer );
+    const U32 scriptTime = Platform::getRealMilliseconds() - startTime;
+    const U32 scriptSceneCount = pScene->getSceneObjectCount();
+    pScene->deleteObject();
+
+    // Read with Taml.
+    char filename[1024];
+    dSprintf( filename, sizeof(filename), "%s/scenePrefabTest.taml", Platform::getTemporaryDirectory() );
+
+    Taml taml;
+    ASSERT_TRUE( taml.write( pTemplate, filename ) ) << "Template was not written.";
+
+    pScene = createPrefabScene();
+    startTime = Platform::getRealMilliseconds();
+    for( U32 index = 0; index < SCENE_UNITTEST_PREFAB_INSTANCES; ++index )
+    {
+        SceneObject* pInstance = taml.read<SceneObject>( filename );
+        if ( pInstance != NULL )
+            pScene->addToScene( pInstance );
+    }
+    const U32 tamlTime = Platform::getRealMilliseconds() - startTime;
+    const U32 tamlSceneCount = pScene->getSceneObjectCount();
+    pScene->deleteObject();
+
+    Platform::fileDelete( filename );
+
+    pPrefab->deleteObject();
+    pTemplate->deleteObject();
+
+    ASSERT_EQ( U32(SCENE_UNITTEST_PREFAB_INSTANCES), prefabCount ) << "Prefab did not spawn every instance.";
+    ASSERT_EQ( U32(SCENE_UNITTEST_PREFAB_INSTANCES), prefabSceneCount ) << "Prefab instances were not added to the scene.";
+    ASSERT_EQ( U32(SCENE_UNITTEST_PREFAB_INSTANCES), scriptSceneCount ) << "Script did not construct every instance.";
+    ASSERT_EQ( U32(SCENE_UNITTEST_PREFAB_INSTANCES), tamlSceneCount ) << "Taml did not read every instance.";
+
+    Con::printf( ">> ScenePrefab: %d instances spawned in %dms from a prefab, %dms constructed in script, %dms read with Taml.",
+        SCENE_UNITTEST_PREFAB_INSTANCES, prefabTime, scriptTime, tamlTime );
+}
+
+#endif // TORQUE_SHIPPING
@@ -83,6 +83,11 @@
 /// 'TORQUE_GATHER_METRICS'
 /// When defined, Torque will gather additional performance metrics.
 ///
+/// 'TORQUE_TRACK_MEMORY'
+/// When defined, Torque will track the size, allocation site and subsystem tag of each
+/// allocation made through dMalloc so that live memory, high-water marks and growth
+/// between snapshots can be dumped to the console.
+///
 /// 'TORQUE_MULTITHREAD'
 /// When defined, Torque will attempt to make select systems thread-safe.  This does not
 /// make the entire engine thread-safe nor is it a magic bullet that will make the engine